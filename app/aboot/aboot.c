@@ -58,6 +58,7 @@
 #include <boot_device.h>
 #include <boot_verifier.h>
 #include <decompress.h>
+#include <lib/lz4.h>
 #include <platform/timer.h>
 #include <sys/types.h>
 #if USE_RPMB_FOR_DEVINFO
@@ -77,7 +78,7 @@
 #include "recovery.h"
 #include "bootimg.h"
 #include "fastboot.h"
-#include "sparse_format.h"
+#include <lib/sparse.h>
 #include "meta_format.h"
 #include "mmc.h"
 #include "devinfo.h"
@@ -86,9 +87,14 @@
 #include "secapp_loader.h"
 #include <menu_keys_detect.h>
 #include <display_menu.h>
+#if WITH_APP_BOOTBENCH
+#include <app/bootbench.h>
+#else
+#define bootbench_start()
+#define bootbench_phase(phase)
+#endif
 
 extern  bool target_use_signed_kernel(void);
-extern void platform_uninit(void);
 extern void target_uninit(void);
 extern int get_target_boot_params(const char *cmdline, const char *part,
 				  char *buf, int buflen);
@@ -819,6 +825,11 @@ void boot_linux(void *kernel, unsigned *tags,
 
 	ramdisk = PA(ramdisk);
 
+#ifdef LK2ND_SMP_WORKERS
+	/* Power down the secondary CPUs before the device tree sets up SMP */
+	smp_workers_stop();
+#endif
+
 	final_cmdline = update_cmdline((const char*)cmdline);
 
 #if DEVICE_TREE
@@ -834,6 +845,7 @@ void boot_linux(void *kernel, unsigned *tags,
 		ASSERT(0);
 	}
 	dprintf(INFO, "Updating device tree: done\n");
+	bootbench_phase("fdt");
 #else
 	/* Generating the Atags */
 	generate_atags(tags, final_cmdline, ramdisk, ramdisk_size);
@@ -880,7 +892,7 @@ void boot_linux(void *kernel, unsigned *tags,
 #if DISPLAY_SPLASH_SCREEN
 	target_display_shutdown();
 #endif
-
+	bootbench_phase("uninit");
 
 	dprintf(INFO, "booting linux @ %p, ramdisk @ %p (%d), tags/device tree @ %p\n",
 		entry, ramdisk, ramdisk_size, tags_phys);
@@ -951,6 +963,52 @@ int check_ddr_addr_range_bound(uintptr_t start, uint32_t size)
 
 BUF_DMA_ALIGN(buf, BOOT_IMG_MAX_PAGE_SIZE); //Equal to max-supported pagesize
 
+/* Boot images are read in chunks of this size so hashing can overlap reads */
+#define BOOT_IMG_READ_CHUNK (1024 * 1024)
+
+/*
+ * Start hashing the boot image while it is being read if the digest is
+ * needed later on. verify_signed_bootimg() and aboot_save_boot_hash_mmc()
+ * get the result through hash_find() without another pass over the image.
+ */
+static void boot_img_hash_start(unsigned char *image_addr)
+{
+#if IMAGE_VERIF_ALGO_SHA1 && !VERIFIED_BOOT
+	uint32_t auth_algo = CRYPTO_AUTH_ALG_SHA1;
+#else
+	uint32_t auth_algo = CRYPTO_AUTH_ALG_SHA256;
+#endif
+
+	if (!target_use_signed_kernel() || device.is_unlocked) {
+#ifdef TZ_SAVE_KERNEL_HASH
+		target_crypto_init_params();
+#else
+		return;
+#endif
+	}
+
+	hash_stream_start(image_addr, auth_algo);
+}
+
+static int boot_img_read_hashed(unsigned long long ptn, unsigned char *addr,
+				unsigned size)
+{
+	unsigned chunk;
+
+	while (size) {
+		chunk = MIN(size, BOOT_IMG_READ_CHUNK);
+		if (mmc_read(ptn, (void *)addr, chunk))
+			return -1;
+
+		hash_stream_update(chunk);
+		ptn += chunk;
+		addr += chunk;
+		size -= chunk;
+	}
+
+	return 0;
+}
+
 static void verify_signed_bootimg(uint32_t bootimg_addr, uint32_t bootimg_size)
 {
 	int ret;
@@ -1115,6 +1173,189 @@ void boot_verifier_init()
 }
 #endif
 
+/*
+ * Images that are neither signed nor hashed do not need to be present
+ * contiguously in memory, so read each section straight to its final
+ * address instead of staging the whole image in the scratch region.
+ */
+static bool boot_img_can_scatter_load(void)
+{
+#if VERIFIED_BOOT || defined(MDTP_SUPPORT) || defined(TZ_SAVE_KERNEL_HASH)
+	return false;
+#else
+	return !target_use_signed_kernel() || device.is_unlocked;
+#endif
+}
+
+/* Read len bytes at offset of the boot image, returns 0 on success */
+typedef int (*boot_img_read_t)(void *arg, uint64_t offset, void *buf, unsigned len);
+
+static int boot_img_read_mmc(void *arg, uint64_t offset, void *buf, unsigned len)
+{
+	unsigned long long *ptn = arg;
+
+	return mmc_read(*ptn + offset, buf, len) ? -1 : 0;
+}
+
+/*
+ * Load kernel, ramdisk and device tree of the boot image read through
+ * read directly to the addresses from the boot image header.
+ * Returns 0 on success, 1 if the image needs the regular contiguous load
+ * (e.g. gzip compressed kernel) and -1 on error.
+ */
+static int boot_img_scatter_load(boot_img_read_t read, void *arg,
+				 struct boot_img_hdr *hdr, unsigned char *image_addr)
+{
+	unsigned kernel_actual = ROUND_TO_PAGE(hdr->kernel_size, page_mask);
+	unsigned ramdisk_actual = ROUND_TO_PAGE(hdr->ramdisk_size, page_mask);
+	unsigned second_actual = ROUND_TO_PAGE(hdr->second_size, page_mask);
+	unsigned char *kernel_page = image_addr + page_size;
+	struct kernel64_hdr *kptr = (struct kernel64_hdr *)kernel_page;
+#if DEVICE_TREE
+	uint32_t kernel_addr = hdr->kernel_addr;
+	uint32_t ramdisk_addr = hdr->ramdisk_addr;
+	uint32_t tags_addr = hdr->tags_addr;
+	unsigned dt_offset = page_size + kernel_actual + ramdisk_actual + second_actual;
+	uint32_t dt_actual = ROUND_TO_PAGE(dt_size, page_mask);
+	struct dt_table *table;
+	struct dt_entry dt_entry;
+	uint32_t dt_hdr_size;
+#endif
+
+	if (!kernel_actual)
+		return 1;
+
+	/* The kernel header decides about decompression and the load address */
+	if (read(arg, page_size, (void *)kernel_page, page_size)) {
+		dprintf(CRITICAL, "ERROR: Cannot read kernel header\n");
+		return -1;
+	}
+
+	if (is_gzip_package(kernel_page, hdr->kernel_size))
+		return 1;
+
+	update_ker_tags_rdisk_addr(hdr, kptr);
+
+	/* Get virtual addresses since the hdr saves physical addresses. */
+	hdr->kernel_addr = VA((addr_t)(hdr->kernel_addr));
+	hdr->ramdisk_addr = VA((addr_t)(hdr->ramdisk_addr));
+	hdr->tags_addr = VA((addr_t)(hdr->tags_addr));
+
+	/* Check if the addresses in the header are valid. */
+	if (check_aboot_addr_range_overlap(hdr->kernel_addr, kernel_actual) ||
+		check_ddr_addr_range_bound(hdr->kernel_addr, kernel_actual) ||
+		check_aboot_addr_range_overlap(hdr->ramdisk_addr, ramdisk_actual) ||
+		check_ddr_addr_range_bound(hdr->ramdisk_addr, ramdisk_actual))
+	{
+		dprintf(CRITICAL, "kernel/ramdisk addresses are not valid.\n");
+		return -1;
+	}
+
+#ifndef DEVICE_TREE
+	if (check_aboot_addr_range_overlap(hdr->tags_addr, MAX_TAGS_SIZE) ||
+		check_ddr_addr_range_bound(hdr->tags_addr, MAX_TAGS_SIZE))
+	{
+		dprintf(CRITICAL, "Tags addresses are not valid.\n");
+		return -1;
+	}
+#endif
+
+#if DEVICE_TREE
+	if (dt_size) {
+		/*
+		 * The device tree table is small, stage it in the scratch region
+		 * and only copy the matching entry to tags_addr. This happens
+		 * before the kernel is read in case the two regions overlap.
+		 */
+		table = (struct dt_table *)(kernel_page + page_size);
+		if (read(arg, dt_offset, (void *)table, dt_actual)) {
+			dprintf(CRITICAL, "ERROR: Cannot read device tree table\n");
+			return -1;
+		}
+
+		if (dev_tree_validate(table, hdr->page_size, &dt_hdr_size) != 0) {
+			dprintf(CRITICAL, "ERROR: Cannot validate Device Tree Table \n");
+			return -1;
+		}
+
+		if (dt_hdr_size > ROUND_TO_PAGE(dt_size, hdr->page_size)) {
+			dprintf(CRITICAL, "ERROR: Invalid Device Tree size \n");
+			return -1;
+		}
+
+		if (dev_tree_get_entry_info(table, &dt_entry) != 0) {
+			dprintf(CRITICAL, "ERROR: Getting device tree address failed\n");
+			return -1;
+		}
+
+		if (dt_entry.offset > (UINT_MAX - dt_entry.size) ||
+		    (dt_entry.offset + dt_entry.size) > dt_size) {
+			dprintf(CRITICAL, "ERROR: Device tree contents are Invalid\n");
+			return -1;
+		}
+
+		/* Compressed device trees are rare, leave them to the slow path */
+		if (is_gzip_package((unsigned char *)table + dt_entry.offset, dt_entry.size))
+			goto fallback;
+
+		if (check_aboot_addr_range_overlap(hdr->tags_addr, dt_entry.size) ||
+			check_ddr_addr_range_bound(hdr->tags_addr, dt_entry.size))
+		{
+			dprintf(CRITICAL, "Device tree addresses are not valid\n");
+			return -1;
+		}
+
+		memmove((void *)hdr->tags_addr, (char *)table + dt_entry.offset,
+			dt_entry.size);
+	} else if (check_aboot_addr_range_overlap(hdr->tags_addr, kernel_actual) ||
+		   check_ddr_addr_range_bound(hdr->tags_addr, kernel_actual)) {
+		dprintf(CRITICAL, "Device tree addresses are not valid.\n");
+		return -1;
+	}
+#endif
+
+	/* Reuse the kernel page that was already read */
+	memmove((void *)hdr->kernel_addr, kernel_page, page_size);
+	if (kernel_actual > page_size &&
+	    read(arg, page_size * 2, (void *)(hdr->kernel_addr + page_size),
+		 kernel_actual - page_size)) {
+		dprintf(CRITICAL, "ERROR: Cannot read kernel\n");
+		return -1;
+	}
+
+#if DEVICE_TREE
+	if (!dt_size) {
+		/*
+		 * If appended dev tree is found, update the atags with
+		 * memory address to the DTB appended location on RAM.
+		 */
+		if (!dev_tree_appended((void *)hdr->kernel_addr, hdr->kernel_size,
+				       0, (void *)hdr->tags_addr)) {
+			dprintf(CRITICAL, "ERROR: Appended Device Tree Blob not found\n");
+			return -1;
+		}
+	}
+#endif
+
+	if (ramdisk_actual &&
+	    read(arg, page_size + kernel_actual, (void *)hdr->ramdisk_addr,
+		 ramdisk_actual)) {
+		dprintf(CRITICAL, "ERROR: Cannot read ramdisk\n");
+		return -1;
+	}
+
+	return 0;
+
+#if DEVICE_TREE
+fallback:
+	/* The regular load path translates the addresses on its own */
+	hdr->kernel_addr = kernel_addr;
+	hdr->ramdisk_addr = ramdisk_addr;
+	hdr->tags_addr = tags_addr;
+	return 1;
+#endif
+}
+
 int boot_linux_from_mmc(void)
 {
 	struct boot_img_hdr *hdr = (void*) buf;
@@ -1259,11 +1500,26 @@ int boot_linux_from_mmc(void)
 	dprintf(INFO, "Loading boot image (%d): start\n", imagesize_actual);
 	bs_set_timestamp(BS_KERNEL_LOAD_START);
 
+	if (boot_img_can_scatter_load()) {
+		rc = boot_img_scatter_load(boot_img_read_mmc, &ptn, hdr, image_addr);
+		if (rc < 0)
+			return -1;
+		if (rc == 0) {
+			dprintf(INFO, "Loading boot image (%d): done\n", imagesize_actual);
+			bs_set_timestamp(BS_KERNEL_LOAD_DONE);
+			goto loaded;
+		}
+	}
+
+	boot_img_hash_start(image_addr);
+	hash_stream_update(page_size);
+
 	offset = page_size;
 	/* Read image without signature and header*/
-	if (mmc_read(ptn + offset, (void *)(image_addr + offset), imagesize_actual - page_size))
+	if (boot_img_read_hashed(ptn + offset, image_addr + offset, imagesize_actual - page_size))
 	{
 		dprintf(CRITICAL, "ERROR: Cannot read boot image\n");
+		hash_stream_stop();
 		return -1;
 	}
 
@@ -1282,6 +1538,7 @@ int boot_linux_from_mmc(void)
 		if (check_aboot_addr_range_overlap((uintptr_t)image_addr + offset, page_size))
 		{
 			dprintf(CRITICAL, "Signature read buffer address overlaps with aboot addresses.\n");
+			hash_stream_stop();
 			return -1;
 		}
 
@@ -1289,6 +1546,7 @@ int boot_linux_from_mmc(void)
 		if(mmc_read(ptn + offset, (void *)(image_addr + offset), page_size))
 		{
 			dprintf(CRITICAL, "ERROR: Cannot read boot image signature\n");
+			hash_stream_stop();
 			return -1;
 		}
 
@@ -1333,6 +1591,8 @@ int boot_linux_from_mmc(void)
 #endif /* MDTP_SUPPORT */
 	}
 
+	hash_stream_stop();
+
 #if VERIFIED_BOOT
 #if !VBOOT_MOTA
 	// send root of trust
@@ -1493,6 +1753,7 @@ int boot_linux_from_mmc(void)
 	memmove((void*) hdr->kernel_addr, kernel_start_addr, kernel_size);
 	memmove((void*) hdr->ramdisk_addr, (char *)(image_addr + page_size + kernel_actual), hdr->ramdisk_size);
 
+loaded:
 	if (boot_into_recovery && !device.is_unlocked && !device.is_tampered)
 		target_load_ssd_keystore();
 
@@ -2365,6 +2626,8 @@ void cmd_boot(const char *arg, void *data, unsigned sz)
 	}
 #endif
 
+	bootbench_start();
+
 	if (sz < sizeof(hdr)) {
 		fastboot_fail("invalid bootimage header");
 		return;
@@ -2472,6 +2735,7 @@ void cmd_boot(const char *arg, void *data, unsigned sz)
 		kernel_start_addr = (unsigned char *)((char *)data + page_size);
 		kernel_size = hdr->kernel_size;
 	}
+	bootbench_phase("kernel");
 
 	/*
 	 * Update the kernel/ramdisk/tags address if the boot image header
@@ -2535,11 +2799,13 @@ void cmd_boot(const char *arg, void *data, unsigned sz)
 			return;
 		}
 	}
+	bootbench_phase("dtb");
 #endif
 
 	/* Load ramdisk & kernel */
 	memmove((void*) hdr->ramdisk_addr, ptr + page_size + kernel_actual, hdr->ramdisk_size);
 	memmove((void*) hdr->kernel_addr, (char*) (kernel_start_addr), kernel_size);
+	bootbench_phase("load");
 
 	fastboot_okay("");
 	fastboot_stop();
@@ -2549,6 +2815,112 @@ void cmd_boot(const char *arg, void *data, unsigned sz)
 		   (void*) hdr->ramdisk_addr, hdr->ramdisk_size);
 }
 
+struct boot_img_fs {
+	filehandle *handle;
+	off_t size;
+	bool scratch;	/* staged in scratch for cmd_boot() */
+};
+
+static int boot_img_read_fs(void *arg, uint64_t offset, void *buf, unsigned len)
+{
+	struct boot_img_fs *fs = arg;
+	ssize_t ret;
+
+	ret = fs_read_file(fs->handle, buf, offset, len);
+
+	/* The last section may not be padded to a full page in the file */
+	if (ret < 0 || ((size_t)ret < len && offset + ret < (uint64_t)fs->size))
+		return -1;
+	return 0;
+}
+
+/*
+ * fs-boot loader: read the sections of boot.img straight to their load
+ * addresses like boot_linux_from_mmc(). Images that need hashing,
+ * verification or decompression are staged in scratch for cmd_boot().
+ */
+static int boot_img_load_fs(filehandle *handle, off_t size, void *arg)
+{
+	struct boot_img_fs *fs = arg;
+	struct boot_img_hdr *hdr = (void *)buf;
+	unsigned char *image_addr = (unsigned char *)target_get_scratch_address();
+	uint64_t imagesize_actual;
+	unsigned fs_page_size;
+	int rc;
+
+	fs->handle = handle;
+	fs->size = size;
+	fs->scratch = false;
+
+	if (!boot_img_can_scatter_load())
+		goto staged;
+
+	if (boot_img_read_fs(fs, 0, buf, sizeof(*hdr)) ||
+	    memcmp(hdr->magic, BOOT_MAGIC, BOOT_MAGIC_SIZE))
+		goto staged;
+
+	fs_page_size = hdr->page_size ? hdr->page_size : page_size;
+	if (fs_page_size > BOOT_IMG_MAX_PAGE_SIZE || (fs_page_size & (fs_page_size - 1)))
+		goto staged;
+	page_size = fs_page_size;
+	page_mask = page_size - 1;
+
+	/* ensure commandline is terminated */
+	hdr->cmdline[BOOT_ARGS_SIZE-1] = 0;
+
+#if DEVICE_TREE
+#ifndef OSVERSION_IN_BOOTIMAGE
+	dt_size = hdr->dt_size;
+#endif
+#endif
+
+	imagesize_actual = (uint64_t)page_size + ROUND_TO_PAGE(hdr->kernel_size, page_mask) +
+			   ROUND_TO_PAGE(hdr->ramdisk_size, page_mask) +
+			   ROUND_TO_PAGE(hdr->second_size, page_mask);
+#if DEVICE_TREE
+	imagesize_actual += ROUND_TO_PAGE(dt_size, page_mask);
+#endif
+	if (imagesize_actual > ROUND_TO_PAGE((uint64_t)size, page_mask)) {
+		dprintf(CRITICAL, "ERROR: boot.img is truncated\n");
+		return -1;
+	}
+
+	rc = boot_img_scatter_load(boot_img_read_fs, fs, hdr, image_addr);
+	if (rc < 0)
+		return -1;
+	if (rc == 0)
+		return size;
+
+staged:
+	rc = fs_read_file(handle, image_addr, 0,
+			  MIN((size_t)size, target_get_max_flash_size()));
+	if (rc > 0)
+		fs->scratch = true;
+	return rc;
+}
+
+/* Boot the first boot.img found on a filesystem, returns if there is none */
+void boot_linux_from_fs(void)
+{
+	struct boot_img_hdr *hdr = (void *)buf;
+	struct boot_img_fs fs;
+
+	bootbench_start();
+
+	if (fsboot_load_first(boot_img_load_fs, &fs) <= 0)
+		return;
+	bootbench_phase("fs-boot");
+
+	if (fs.scratch) {
+		cmd_boot(NULL, target_get_scratch_address(), target_get_max_flash_size());
+		return;
+	}
+
+	boot_linux((void *)hdr->kernel_addr, (void *)hdr->tags_addr,
+		   (const char *)hdr->cmdline, board_machtype(),
+		   (void *)hdr->ramdisk_addr, hdr->ramdisk_size);
+}
+
 void cmd_erase_nand(const char *arg, void *data, unsigned sz)
 {
 	struct ptentry *ptn;
@@ -2755,6 +3127,159 @@ void cmd_flash_mmc_img(const char *arg, void *data, unsigned sz)
 	return;
 }
 
+#define FLASH_STREAM_BUF_SIZE (8 * 1024 * 1024)
+
+struct flash_stream {
+	unsigned long long ptn;
+	unsigned long long size;
+	unsigned long long written;
+	bool boot_img;
+	const char *error;
+};
+
+static int flash_stream_write(void *arg, unsigned char *buf, unsigned int len)
+{
+	struct flash_stream *stream = arg;
+
+	if (stream->boot_img && !stream->written &&
+	    (len < BOOT_MAGIC_SIZE || memcmp(buf, BOOT_MAGIC, BOOT_MAGIC_SIZE))) {
+		stream->error = "image is not a boot image";
+		return -1;
+	}
+
+	if (ROUND_TO_PAGE(stream->written + len, mmc_blocksize_mask) > stream->size) {
+		stream->error = "size too large";
+		return -1;
+	}
+
+	if (mmc_write(stream->ptn + stream->written, len, (unsigned int *)buf)) {
+		stream->error = "flash write failure";
+		return -1;
+	}
+
+	stream->written += len;
+	return 0;
+}
+
+static int flash_stream_check(void *arg, unsigned char *buf, unsigned int len)
+{
+	return 0;
+}
+
+/* Free part of the download buffer behind the compressed data */
+static unsigned flash_stream_buf(void *data, unsigned sz, unsigned char **buf)
+{
+	addr_t end = (addr_t)target_get_scratch_address() + target_get_max_flash_size();
+
+	*buf = (unsigned char *)ROUNDUP((addr_t)data + sz, DECOMPRESS_STREAM_ALIGN);
+	if ((addr_t)*buf >= end)
+		return 0;
+
+	return MIN(end - (addr_t)*buf, FLASH_STREAM_BUF_SIZE);
+}
+
+static int flash_decompress(void *data, unsigned sz, unsigned char *buf,
+			    unsigned buf_len, decompress_write_t write,
+			    void *arg, unsigned long long *out_len)
+{
+	if (is_gzip_package(data, sz))
+		return decompress_stream(data, sz, buf, buf_len, write, arg, out_len);
+
+	return lz4_decompress_stream(data, sz, buf, buf_len, write, arg, out_len);
+}
+
+/*
+ * Check if the payload should be flashed decompressed. Partitions that
+ * cmd_flash_mmc_img() handles by name always get the data as is. Anything
+ * else is only treated as compressed if the whole gzip or LZ4 stream
+ * decodes with valid checksums, so raw images that happen to start with
+ * one of the magics are still flashed unchanged.
+ */
+static bool flash_is_compressed(const char *arg, void *data, unsigned sz)
+{
+	unsigned long long out_len = 0;
+	size_t len = strcspn(arg, ":");
+	unsigned char *buf;
+	unsigned buf_len;
+
+#if !DISABLE_LOCK
+	if (!strncmp(arg, "frp-unlock", strlen("frp-unlock")))
+		return false;
+#endif
+#if !WITH_LK2ND
+	if (len == strlen("partition") && !strncmp(arg, "partition", len))
+		return false;
+#endif
+#if VERIFIED_BOOT
+	if (len == strlen(KEYSTORE_PTN_NAME) && !strncmp(arg, KEYSTORE_PTN_NAME, len))
+		return false;
+#endif
+
+	if (!is_gzip_package(data, sz) && !is_lz4_frame(data, sz))
+		return false;
+
+	buf_len = flash_stream_buf(data, sz, &buf);
+	if (!buf_len ||
+	    flash_decompress(data, sz, buf, buf_len, flash_stream_check, NULL, &out_len)) {
+		dprintf(INFO, "Not a valid compressed image, flashing it as is\n");
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * Flash a gzip or LZ4 compressed raw image that flash_is_compressed()
+ * accepted. It is decompressed in chunks into the free part of the
+ * download buffer behind the compressed data and written out chunk by
+ * chunk, so the image itself may be larger than the download buffer.
+ */
+static void cmd_flash_mmc_compressed_img(const char *arg, void *data, unsigned sz)
+{
+	struct flash_stream stream = {0};
+	unsigned long long out_len = 0;
+	unsigned char *buf;
+	unsigned buf_len;
+	char *token, *pname, *sp;
+	int index;
+	bool lun_set = false;
+
+	pname = strtok_r((char *)arg, ":", &sp);
+	token = strtok_r(NULL, ":", &sp);
+	if (token) {
+		mmc_set_lun(atoi(token));
+		lun_set = true;
+	}
+
+	if (!pname) {
+		fastboot_fail("invalid partition name");
+		return;
+	}
+
+	index = partition_get_index(pname);
+	stream.ptn = partition_get_offset(index);
+	if (stream.ptn == 0) {
+		fastboot_fail("partition table doesn't exist");
+		return;
+	}
+
+	if (!lun_set)
+		mmc_set_lun(partition_get_lun(index));
+
+	stream.size = partition_get_size(index);
+	stream.boot_img = !strcmp(pname, "boot") || !strcmp(pname, "recovery");
+
+	buf_len = flash_stream_buf(data, sz, &buf);
+	if (flash_decompress(data, sz, buf, buf_len, flash_stream_write,
+			     &stream, &out_len)) {
+		fastboot_fail(stream.error ? stream.error : "image decompression failed");
+		return;
+	}
+
+	dprintf(INFO, "Flashed %llu bytes decompressed from %u bytes\n", out_len, sz);
+	fastboot_okay("");
+}
+
 void cmd_flash_meta_img(const char *arg, void *data, unsigned sz)
 {
 #if DISABLE_DEVINFO
@@ -2835,24 +3360,23 @@ void cmd_flash_meta_img(const char *arg, void *data, unsigned sz)
 #endif
 }
 
+static int sparse_write_mmc(void *arg, uint64_t offset, void *buf, uint32_t len)
+{
+	unsigned long long ptn = *(unsigned long long *)arg;
+
+	return mmc_write(ptn + offset, len, buf);
+}
+
 void cmd_flash_mmc_sparse_img(const char *arg, void *data, unsigned sz)
 {
-	unsigned int chunk;
-	unsigned int chunk_data_sz;
-	uint32_t *fill_buf = NULL;
-	uint32_t fill_val;
-	uint32_t chunk_blk_cnt = 0;
-	uint32_t blk_sz_actual = 0;
-	sparse_header_t *sparse_header;
-	chunk_header_t *chunk_header;
-	uint32_t total_blocks = 0;
 	unsigned long long ptn = 0;
-	unsigned long long size = 0;
 	int index = INVALID_PTN;
-	int i;
 	uint8_t lun = 0;
-	/*End of the sparse image address*/
-	uint32_t data_end = (uint32_t)data + sz;
+	const char *err;
+	struct sparse_dest dest = {
+		.write = sparse_write_mmc,
+		.arg = &ptn,
+	};
 
 	index = partition_get_index(arg);
 	ptn = partition_get_offset(index);
@@ -2861,244 +3385,17 @@ void cmd_flash_mmc_sparse_img(const char *arg, void *data, unsigned sz)
 		return;
 	}
 
-	size = partition_get_size(index);
+	dest.size = partition_get_size(index);
 
 	lun = partition_get_lun(index);
 	mmc_set_lun(lun);
 
-	if (sz < sizeof(sparse_header_t)) {
-		fastboot_fail("size too low");
+	if (sparse_write(&dest, data, sz, &err)) {
+		fastboot_fail(err);
 		return;
 	}
 
-	/* Read and skip over sparse image header */
-	sparse_header = (sparse_header_t *) data;
-
-	if (!sparse_header->blk_sz || (sparse_header->blk_sz % 4)){
-		fastboot_fail("Invalid block size\n");
-		return;
-	}
-
-	if (((uint64_t)sparse_header->total_blks * (uint64_t)sparse_header->blk_sz) > size) {
-		fastboot_fail("size too large");
-		return;
-	}
-
-	data += sizeof(sparse_header_t);
-
-	if (data_end < (uint32_t)data) {
-		fastboot_fail("buffer overreads occured due to invalid sparse header");
-		return;
-	}
-
-	if(sparse_header->file_hdr_sz != sizeof(sparse_header_t))
-	{
-		fastboot_fail("sparse header size mismatch");
-		return;
-	}
-
-	dprintf (SPEW, "=== Sparse Image Header ===\n");
-	dprintf (SPEW, "magic: 0x%x\n", sparse_header->magic);
-	dprintf (SPEW, "major_version: 0x%x\n", sparse_header->major_version);
-	dprintf (SPEW, "minor_version: 0x%x\n", sparse_header->minor_version);
-	dprintf (SPEW, "file_hdr_sz: %d\n", sparse_header->file_hdr_sz);
-	dprintf (SPEW, "chunk_hdr_sz: %d\n", sparse_header->chunk_hdr_sz);
-	dprintf (SPEW, "blk_sz: %d\n", sparse_header->blk_sz);
-	dprintf (SPEW, "total_blks: %d\n", sparse_header->total_blks);
-	dprintf (SPEW, "total_chunks: %d\n", sparse_header->total_chunks);
-
-	/* Start processing chunks */
-	for (chunk=0; chunk<sparse_header->total_chunks; chunk++)
-	{
-		/* Make sure the total image size does not exceed the partition size */
-		if(((uint64_t)total_blocks * (uint64_t)sparse_header->blk_sz) >= size) {
-			fastboot_fail("size too large");
-			return;
-		}
-		/* Read and skip over chunk header */
-		chunk_header = (chunk_header_t *) data;
-		data += sizeof(chunk_header_t);
-
-		if (data_end < (uint32_t)data) {
-			fastboot_fail("buffer overreads occured due to invalid sparse header");
-			return;
-		}
-
-		dprintf (SPEW, "=== Chunk Header ===\n");
-		dprintf (SPEW, "chunk_type: 0x%x\n", chunk_header->chunk_type);
-		dprintf (SPEW, "chunk_data_sz: 0x%x\n", chunk_header->chunk_sz);
-		dprintf (SPEW, "total_size: 0x%x\n", chunk_header->total_sz);
-
-		if(sparse_header->chunk_hdr_sz != sizeof(chunk_header_t))
-		{
-			fastboot_fail("chunk header size mismatch");
-			return;
-		}
-
-		chunk_data_sz = sparse_header->blk_sz * chunk_header->chunk_sz;
-
-		switch (chunk_header->chunk_type)
-		{
-			case CHUNK_TYPE_RAW:
-			/* Make sure multiplication does not overflow uint32 size */
-			if (sparse_header->blk_sz && (chunk_header->chunk_sz != chunk_data_sz / sparse_header->blk_sz))
-			{
-			  fastboot_fail("Bogus size sparse and chunk header");
-			  return;
-			}
-
-			/* Make sure that the chunk size calculated from sparse image does not
-			 * exceed partition size
-			 */
-			if ((uint64_t)total_blocks * (uint64_t)sparse_header->blk_sz + chunk_data_sz > size)
-			{
-			  fastboot_fail("Chunk data size exceeds partition size");
-			  return;
-			}
-
-			if(chunk_header->total_sz != (sparse_header->chunk_hdr_sz +
-											chunk_data_sz))
-			{
-				fastboot_fail("Bogus chunk size for chunk type Raw");
-				return;
-			}
-
-			if (data_end < (uint32_t)data + chunk_data_sz) {
-				fastboot_fail("buffer overreads occured due to invalid sparse header");
-				return;
-			}
-
-			if(mmc_write(ptn + ((uint64_t)total_blocks*sparse_header->blk_sz),
-						chunk_data_sz,
-						(unsigned int*)data))
-			{
-				fastboot_fail("flash write failure");
-				return;
-			}
-			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz)) {
-				fastboot_fail("Bogus size for RAW chunk type");
-				return;
-			}
-			total_blocks += chunk_header->chunk_sz;
-			data += chunk_data_sz;
-			break;
-
-			case CHUNK_TYPE_FILL:
-			if(chunk_header->total_sz != (sparse_header->chunk_hdr_sz +
-											sizeof(uint32_t)))
-			{
-				fastboot_fail("Bogus chunk size for chunk type FILL");
-				return;
-			}
-
-			blk_sz_actual = ROUNDUP(sparse_header->blk_sz, CACHE_LINE);
-			/* Integer overflow detected */
-			if (blk_sz_actual < sparse_header->blk_sz)
-			{
-				fastboot_fail("Invalid block size");
-				return;
-			}
-
-			fill_buf = (uint32_t *)memalign(CACHE_LINE, blk_sz_actual);
-			if (!fill_buf)
-			{
-				fastboot_fail("Malloc failed for: CHUNK_TYPE_FILL");
-				return;
-			}
-
-			if (data_end < (uint32_t)data + sizeof(uint32_t)) {
-				fastboot_fail("buffer overreads occured due to invalid sparse header");
-				free(fill_buf);
-				return;
-			}
-			fill_val = *(uint32_t *)data;
-			data = (char *) data + sizeof(uint32_t);
-			chunk_blk_cnt = chunk_data_sz / sparse_header->blk_sz;
-
-			for (i = 0; i < (sparse_header->blk_sz / sizeof(fill_val)); i++)
-			{
-				fill_buf[i] = fill_val;
-			}
-
-			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz))
-			{
-				fastboot_fail("bogus size for chunk FILL type");
-				free(fill_buf);
-				return;
-			}
-
-			for (i = 0; i < chunk_blk_cnt; i++)
-			{
-				/* Make sure that the data written to partition does not exceed partition size */
-				if ((uint64_t)total_blocks * (uint64_t)sparse_header->blk_sz + sparse_header->blk_sz > size)
-				{
-					fastboot_fail("Chunk data size for fill type exceeds partition size");
-					free(fill_buf);
-					return;
-				}
-
-				if(mmc_write(ptn + ((uint64_t)total_blocks*sparse_header->blk_sz),
-							sparse_header->blk_sz,
-							fill_buf))
-				{
-					fastboot_fail("flash write failure");
-					free(fill_buf);
-					return;
-				}
-
-				total_blocks++;
-			}
-
-			free(fill_buf);
-			break;
-
-			case CHUNK_TYPE_DONT_CARE:
-			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz)) {
-				fastboot_fail("bogus size for chunk DONT CARE type");
-				return;
-			}
-			total_blocks += chunk_header->chunk_sz;
-			break;
-
-			case CHUNK_TYPE_CRC:
-			if(chunk_header->total_sz != sparse_header->chunk_hdr_sz)
-			{
-				fastboot_fail("Bogus chunk size for chunk type Dont Care");
-				return;
-			}
-			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz)) {
-				fastboot_fail("bogus size for chunk CRC type");
-				return;
-			}
-			total_blocks += chunk_header->chunk_sz;
-			if ((uint32_t)data > UINT_MAX - chunk_data_sz) {
-				fastboot_fail("integer overflow occured");
-				return;
-			}
-			data += chunk_data_sz;
-			if (data_end < (uint32_t)data) {
-				fastboot_fail("buffer overreads occured due to invalid sparse header");
-				return;
-			}
-			break;
-
-			default:
-			dprintf(CRITICAL, "Unkown chunk type: %x\n",chunk_header->chunk_type);
-			fastboot_fail("Unknown chunk type");
-			return;
-		}
-	}
-
-	dprintf(INFO, "Wrote %d blocks, expected to write %d blocks\n",
-					total_blocks, sparse_header->total_blks);
-
-	if(total_blocks != sparse_header->total_blks)
-	{
-		fastboot_fail("sparse image write failure");
-	}
-
 	fastboot_okay("");
-	return;
 }
 
 void cmd_flash_mmc(const char *arg, void *data, unsigned sz)
@@ -3204,6 +3501,8 @@ void cmd_flash_mmc(const char *arg, void *data, unsigned sz)
                 cmd_flash_mmc_sparse_img(arg, data, sz);
         else if (meta_header->magic == META_HEADER_MAGIC)
                 cmd_flash_meta_img(arg, data, sz);
+        else if (flash_is_compressed(arg, data, sz))
+                cmd_flash_mmc_compressed_img(arg, data, sz);
         else
                 cmd_flash_mmc_img(arg, data, sz);
 
@@ -3345,10 +3644,7 @@ void cmd_continue(const char *arg, void *data, unsigned sz)
 #endif
 
 		/* Try to boot from first fs we can find */
-		ssize_t loaded_file = fsboot_boot_first(target_get_scratch_address(), target_get_max_flash_size());
-
-		if (loaded_file > 0)
-			cmd_boot(NULL, target_get_scratch_address(), target_get_max_flash_size());
+		boot_linux_from_fs();
 
 		dprintf(CRITICAL, "Unable to load boot.img from ext2. Continuing legacy boot\n");
 
@@ -3535,6 +3831,15 @@ int splash_screen_check_header(logo_img_header *header)
 	return 0;
 }
 
+/* Clear the screen around a logo that is smaller than the screen */
+static void splash_screen_clear(struct fbcon_config *fb_display)
+{
+	fbcon_clear();
+	arch_clean_cache_range((addr_t)fb_display->base,
+			       fb_display->width * fb_display->height *
+			       (fb_display->bpp / 8));
+}
+
 int splash_screen_flash()
 {
 	struct ptentry *ptn;
@@ -3576,7 +3881,7 @@ int splash_screen_flash()
 			/* if the logo is full-screen size, remove "fbcon_clear()" */
 			if ((header->width != fb_display->width)
 						|| (header->height != fb_display->height))
-					fbcon_clear();
+					splash_screen_clear(fb_display);
 
 			if (flash_read(ptn + LOGO_IMG_HEADER_SIZE, 0,
 				(uint32_t *)base,
@@ -3612,17 +3917,21 @@ int splash_screen_flash()
 			dprintf(CRITICAL, "ERROR: Cannot read splash image from partition\n");
 			return -1;
 		}
+		arch_clean_cache_range((addr_t)base, splash_size);
 	}
 
 	return 0;
 }
 
+#define SPLASH_READ_CHUNK (128 * 1024)
+
 int splash_screen_mmc()
 {
 	int index = INVALID_PTN;
 	unsigned long long ptn = 0;
 	struct fbcon_config *fb_display = NULL;
 	struct logo_img_header *header;
+	struct fbcon_splash splash;
 	uint32_t blocksize, realsize, readsize;
 	uint8_t *base;
 
@@ -3667,32 +3976,42 @@ int splash_screen_mmc()
 			(UINT_MAX >= header->blocks * 512 + LOGO_IMG_HEADER_SIZE) &&
 			((header->blocks * 512) <=  (fb_display->width *
 			fb_display->height * (fb_display->bpp / 8)))) {
-			/* 1 RLE24 compressed data */
-			base += LOGO_IMG_OFFSET;
+			/* 1 RLE24 compressed data, decoded as it is read in chunks */
+			uint8_t *chunk = base + LOGO_IMG_OFFSET;
+			uint32_t len, remaining;
+			int ret;
 
-			realsize =  header->blocks * 512;
-			readsize =  ROUNDUP((realsize + LOGO_IMG_HEADER_SIZE), blocksize) - blocksize;
+			if (fbcon_splash_start(&splash, header))
+				return -1;
 
 			/* if the logo is not full-screen size, clean screen */
 			if ((header->width != fb_display->width)
 						|| (header->height != fb_display->height))
-				fbcon_clear();
-
-			uint32_t fb_size = ROUNDUP(fb_display->width *
-					fb_display->height *
-					(fb_display->bpp / 8), 4096);
+				splash_screen_clear(fb_display);
+
+			/* the first block may already hold some data after the header */
+			remaining = header->blocks * 512;
+			len = MIN(remaining, blocksize - LOGO_IMG_HEADER_SIZE);
+			ret = fbcon_splash_decode(&splash, chunk + LOGO_IMG_HEADER_SIZE, len);
+			remaining -= len;
+			ptn += blocksize;
+
+			while (ret == 0 && remaining) {
+				len = MIN(remaining, SPLASH_READ_CHUNK);
+				if (mmc_read(ptn, (uint32_t *)chunk, ROUNDUP(len, blocksize))) {
+					dprintf(CRITICAL, "ERROR: Cannot read splash image from partition\n");
+					return -1;
+				}
 
-			if (readsize > fb_size) {
-				dprintf(CRITICAL, "ERROR: Splash image size invalid\n");
-				return -1;
+				ret = fbcon_splash_decode(&splash, chunk, len);
+				remaining -= len;
+				ptn += len;
 			}
 
-			if (mmc_read(ptn + blocksize, (uint32_t *)(base + blocksize), readsize)) {
-				dprintf(CRITICAL, "ERROR: Cannot read splash image from partition\n");
+			if (ret != 1) {
+				dprintf(CRITICAL, "ERROR: Splash image data invalid\n");
 				return -1;
 			}
-
-			fbcon_extract_to_screen(header, (base + LOGO_IMG_HEADER_SIZE));
 		} else { /* 2 Raw BGR data */
 
 			if ((header->width != fb_display->width) || (header->height != fb_display->height)) {
@@ -3716,6 +4035,7 @@ int splash_screen_mmc()
 					return -1;
 				}
 				memmove(base, (base + LOGO_IMG_OFFSET + LOGO_IMG_HEADER_SIZE), realsize);
+				arch_clean_cache_range((addr_t)base, realsize);
 			}
 		}
 	}
@@ -3737,26 +4057,17 @@ int fetch_image_from_partition()
 #endif
 }
 
-/* Get the size from partiton name */
-static void get_partition_size(const char *arg, char *response)
+/* Get the size of the partition at index in the partition table */
+static void get_partition_size(int index, char *response)
 {
 	uint64_t ptn = 0;
 	uint64_t size;
-	int index = INVALID_PTN;
-
-	index = partition_get_index(arg);
-
-	if (index == INVALID_PTN)
-	{
-		dprintf(CRITICAL, "Invalid partition index\n");
-		return;
-	}
 
 	ptn = partition_get_offset(index);
 
 	if(!ptn)
 	{
-		dprintf(CRITICAL, "Invalid partition name %s\n", arg);
+		dprintf(CRITICAL, "Invalid partition index %d\n", index);
 		return;
 	}
 
@@ -3796,7 +4107,8 @@ static void publish_getvar_partition_info(struct getvar_partition_info *info, ui
 			}
 		}
 
-		get_partition_size(info[i].part_name, info[i].size_response);
+		/* info[i] describes partition i, no need to look it up by name */
+		get_partition_size(i, info[i].size_response);
 
 		if (strlcat(info[i].getvar_size, info[i].part_name, MAX_GET_VAR_NAME_SIZE) >= MAX_GET_VAR_NAME_SIZE)
 		{
@@ -4052,10 +4364,7 @@ normal_boot:
 		{
 			if (!boot_into_recovery) {
 				/* Try to boot from first fs we can find */
-				ssize_t loaded_file = fsboot_boot_first(target_get_scratch_address(), target_get_max_flash_size());
-
-				if (loaded_file > 0)
-					cmd_boot(NULL, target_get_scratch_address(), target_get_max_flash_size());
+				boot_linux_from_fs();
 
 				dprintf(CRITICAL, "Unable to load boot.img from ext2. Continuing legacy boot\n");
 			}
@@ -4139,7 +4448,7 @@ static int aboot_save_boot_hash_mmc(uint32_t image_addr, uint32_t image_size)
 #endif
 
 	target_crypto_init_params();
-	hash_find(image_addr, image_size, (unsigned char *)&digest, auth_algo);
+	hash_find((unsigned char *)image_addr, image_size, (unsigned char *)&digest, auth_algo);
 
 	save_kernel_hash_cmd(digest);
 	dprintf(INFO, "aboot_save_boot_hash_mmc: imagesize_actual size %d bytes.\n", (int) image_size);
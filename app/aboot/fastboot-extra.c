@@ -1,6 +1,7 @@
 #include <arch/ops.h>
 #include <debug.h>
 #include <dev/fbcon.h>
+#include <limits.h>
 #include <malloc.h>
 #include <mdp5.h>
 #include <mmc.h>
@@ -88,68 +89,300 @@ static void cmd_oem_writeb(const char *arg, void *data, unsigned sz)
 	fastboot_okay("");
 }
 
+static bool parse_u64(const char *str, uint64_t *out)
+{
+	uint64_t val = 0;
+	unsigned base = 10, digit;
+
+	if (str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) {
+		base = 16;
+		str += 2;
+	}
+	if (!*str)
+		return false;
+
+	for (; *str; str++) {
+		if (*str >= '0' && *str <= '9')
+			digit = *str - '0';
+		else if (base == 16 && *str >= 'a' && *str <= 'f')
+			digit = *str - 'a' + 10;
+		else if (base == 16 && *str >= 'A' && *str <= 'F')
+			digit = *str - 'A' + 10;
+		else
+			return false;
+		val = val * base + digit;
+	}
+
+	*out = val;
+	return true;
+}
+
+static int dump_partition_read(void *cookie, unsigned offset, void *buf, unsigned len)
+{
+	uint64_t *start = cookie;
+
+	return mmc_read(*start + offset, buf, len) ? -1 : 0;
+}
+
+/* oem dump <partition> [offset [length]], offset and length in bytes */
 static void cmd_oem_dump_partition(const char *arg, void *data, unsigned sz)
 {
-	struct partition_info part = partition_get_info(arg);
-	int ret;
+	static uint64_t start;
+	struct partition_info part;
+	uint32_t block_size = mmc_get_device_blocksize();
+	uint64_t offset = 0, length;
+	char *args, *name, *offset_str, *length_str, *saveptr;
+	bool valid = true;
+
+	args = strdup(arg);
+	if (!args) {
+		fastboot_fail("out of memory");
+		return;
+	}
+
+	name = strtok_r(args, " ", &saveptr);
+	offset_str = strtok_r(NULL, " ", &saveptr);
+	length_str = strtok_r(NULL, " ", &saveptr);
+
+	part = partition_get_info(name ? name : "");
+	if (offset_str)
+		valid = parse_u64(offset_str, &offset);
+	length = part.size - offset;
+	if (valid && length_str)
+		valid = parse_u64(length_str, &length);
+	free(args);
 
 	if (!part.offset) {
 		fastboot_fail("partition not found");
 		return;
 	}
-	if (part.size > target_get_max_flash_size()) {
-		fastboot_fail("partition too large");
+	if (!valid || !length || offset > part.size || length > part.size - offset ||
+	    offset % block_size || length % block_size) {
+		fastboot_fail("invalid offset/length");
 		return;
 	}
-
-	if (mmc_read(part.offset, data, part.size)) {
-		fastboot_fail("failed to read partition");
+	if (length > ROUNDDOWN(UINT_MAX, block_size)) {
+		fastboot_fail("too large, dump it in parts with offset/length");
 		return;
 	}
 
-	fastboot_stage(data, part.size);
-	fastboot_okay("");
+	start = part.offset + offset;
+	fastboot_stage_stream(dump_partition_read, &start, length);
 }
 
 #if WITH_DEBUG_LOG_BUF
+/* oem lk_log [seq], only returns the records since seq if given */
 static void cmd_oem_lk_log(const char *arg, void *data, unsigned sz)
 {
-	fastboot_stage(lk_log_getbuf(), lk_log_getsize());
+	char response[MAX_RSP_SIZE];
+	unsigned next_seq;
+
+	sz = lk_log_read(atoui(arg), data, target_get_max_flash_size(), &next_seq);
+
+	snprintf(response, sizeof(response), "next-seq: %u", next_seq);
+	fastboot_info(response);
+
+	fastboot_stage(data, sz);
 }
 #endif
 
+/*
+ * Convert one framebuffer row to packed RGB888. The framebuffer stores the
+ * 24/32 bpp formats as BGR(X), 24 bpp rows use the NEON swap if possible.
+ */
+static void screenshot_read_row(struct fbcon_config *fb, unsigned y, uint8_t *rgb)
+{
+	unsigned bytes = fb->bpp / 8;
+	const uint8_t *row = (const uint8_t *)fb->base +
+			     y * (fb->stride ? fb->stride : fb->width) * bytes;
+	const uint16_t *row16 = (const uint16_t *)row;
+	unsigned x = 0, r, g, b;
+
+	switch (fb->bpp) {
+	case 16:
+		for (x = 0; x < fb->width; x++, rgb += 3) {
+			r = (row16[x] >> 11) & 0x1f;
+			g = (row16[x] >> 5) & 0x3f;
+			b = row16[x] & 0x1f;
+			rgb[0] = (r << 3) | (r >> 2);
+			rgb[1] = (g << 2) | (g >> 4);
+			rgb[2] = (b << 3) | (b >> 2);
+		}
+		break;
+	case 24:
+		x = ROUNDDOWN(fb->width, 8);
+		if (x)
+			rgb888_swap(row, rgb, x / 8);
+		row += x * 3;
+		rgb += x * 3;
+		/* fallthrough */
+	case 32:
+		for (; x < fb->width; x++, row += bytes, rgb += 3) {
+			rgb[0] = row[2];
+			rgb[1] = row[1];
+			rgb[2] = row[0];
+		}
+		break;
+	}
+}
+
+/* QOI image encoder, see https://qoiformat.org/qoi-specification.pdf */
+#define QOI_OP_INDEX	0x00
+#define QOI_OP_DIFF	0x40
+#define QOI_OP_LUMA	0x80
+#define QOI_OP_RUN	0xc0
+#define QOI_OP_RGB	0xfe
+
+#define QOI_HEADER_SIZE	14
+#define QOI_END_SIZE	8
+
+struct qoi_encoder {
+	uint8_t *out;
+	uint8_t index[64][3];
+	uint64_t index_valid;	/* unused entries are zero with alpha 0 */
+	uint8_t prev[3];
+	unsigned run;
+};
+
+static void qoi_put32(uint8_t *out, uint32_t val)
+{
+	out[0] = val >> 24;
+	out[1] = val >> 16;
+	out[2] = val >> 8;
+	out[3] = val;
+}
+
+static void qoi_encode_row(struct qoi_encoder *qoi, const uint8_t *px, unsigned width)
+{
+	uint8_t *out = qoi->out;
+	int dr, dg, db, dr_dg, db_dg;
+	unsigned i, h;
+
+	for (; width; width--, px += 3) {
+		if (px[0] == qoi->prev[0] && px[1] == qoi->prev[1] &&
+		    px[2] == qoi->prev[2]) {
+			if (++qoi->run == 62) {
+				*out++ = QOI_OP_RUN | (qoi->run - 1);
+				qoi->run = 0;
+			}
+			continue;
+		}
+
+		if (qoi->run) {
+			*out++ = QOI_OP_RUN | (qoi->run - 1);
+			qoi->run = 0;
+		}
+
+		/* Alpha is always 255 */
+		h = (px[0] * 3 + px[1] * 5 + px[2] * 7 + 255 * 11) % 64;
+		if ((qoi->index_valid & (1ULL << h)) && !memcmp(qoi->index[h], px, 3)) {
+			*out++ = QOI_OP_INDEX | h;
+		} else {
+			memcpy(qoi->index[h], px, 3);
+			qoi->index_valid |= 1ULL << h;
+
+			dr = (int8_t)(px[0] - qoi->prev[0]);
+			dg = (int8_t)(px[1] - qoi->prev[1]);
+			db = (int8_t)(px[2] - qoi->prev[2]);
+			dr_dg = dr - dg;
+			db_dg = db - dg;
+
+			if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 &&
+			    db >= -2 && db <= 1) {
+				*out++ = QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2);
+			} else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 &&
+				   db_dg >= -8 && db_dg <= 7) {
+				*out++ = QOI_OP_LUMA | (dg + 32);
+				*out++ = (dr_dg + 8) << 4 | (db_dg + 8);
+			} else {
+				*out++ = QOI_OP_RGB;
+				for (i = 0; i < 3; i++)
+					*out++ = px[i];
+			}
+		}
+
+		memcpy(qoi->prev, px, 3);
+	}
+
+	qoi->out = out;
+}
+
+static unsigned screenshot_qoi(struct fbcon_config *fb, uint8_t *rgb, uint8_t *out)
+{
+	struct qoi_encoder qoi = { .out = out + QOI_HEADER_SIZE };
+	unsigned y;
+
+	memcpy(out, "qoif", 4);
+	qoi_put32(out + 4, fb->width);
+	qoi_put32(out + 8, fb->height);
+	out[12] = 3;	/* RGB */
+	out[13] = 0;	/* sRGB with linear alpha */
+
+	for (y = 0; y < fb->height; y++) {
+		screenshot_read_row(fb, y, rgb);
+		qoi_encode_row(&qoi, rgb, fb->width);
+	}
+	if (qoi.run)
+		*qoi.out++ = QOI_OP_RUN | (qoi.run - 1);
+
+	memset(qoi.out, 0, QOI_END_SIZE - 1);
+	qoi.out[QOI_END_SIZE - 1] = 1;
+	qoi.out += QOI_END_SIZE;
+
+	return qoi.out - out;
+}
+
+static unsigned screenshot_ppm(struct fbcon_config *fb, uint8_t *out)
+{
+	/* PPM image header, see http://netpbm.sourceforge.net/doc/ppm.html */
+	unsigned hdr = sprintf((char *)out, "P6\n%u %u\n255\n", fb->width, fb->height);
+	unsigned y;
+
+	for (y = 0; y < fb->height; y++)
+		screenshot_read_row(fb, y, out + hdr + y * fb->width * 3);
+
+	return hdr + fb->width * fb->height * 3;
+}
+
+/* oem screenshot [ppm], the image is QOI compressed by default */
 static void cmd_oem_screenshot(const char *arg, void *data, unsigned sz)
 {
 	struct fbcon_config *fb = fbcon_display();
-	unsigned hdr;
+	bool ppm = !strcmp(arg, "ppm");
+	uint8_t *rgb;
 
 	if (!fb) {
 		fastboot_fail("display not initialized");
 		return;
 	}
 
-	if (fb->format != FB_FORMAT_RGB888 || fb->bpp != 24) {
-		fastboot_fail("unsupported fb format\n");
+	if (fb->bpp != 16 && fb->bpp != 24 && fb->bpp != 32) {
+		fastboot_fail("unsupported fb format");
 		return;
 	}
 
-	sz = fb->width * fb->height;
-	if (sz % sizeof(uint64_t) != 0) {
-		fastboot_fail("unsupported display resolution\n");
+	/* Worst case for QOI is 4 bytes per pixel */
+	if ((uint64_t)fb->width * fb->height * 4 + QOI_HEADER_SIZE + QOI_END_SIZE >
+	    target_get_max_flash_size()) {
+		fastboot_fail("display too large");
 		return;
 	}
 
-	/* PPM image header, see http://netpbm.sourceforge.net/doc/ppm.html */
-	hdr = sprintf(data, "P6\n\n%7u %7u\n255\n", fb->width, fb->height);
-	ASSERT(hdr % sizeof(uint64_t) == 0);
+	if (ppm) {
+		fastboot_stage(data, screenshot_ppm(fb, data));
+		return;
+	}
 
-	sz = fb->width * fb->height;
+	rgb = malloc(fb->width * 3);
+	if (!rgb) {
+		fastboot_fail("out of memory");
+		return;
+	}
 
-	/* PPM expects RGB but this seems to be BGR, so do some fancy swapping! */
-	//memcpy(data + hdr, fb->base, sz * 3);
-	rgb888_swap(fb->base, data + hdr, sz / sizeof(uint64_t));
+	sz = screenshot_qoi(fb, rgb, data);
+	free(rgb);
 
-	fastboot_stage(data, hdr + sz*3);
+	fastboot_stage(data, sz);
 }
 
 #define MDP_PP_SYNC_CONFIG_VSYNC	0x004
@@ -1,5 +1,7 @@
+#include <kernel/profile.h>
 #include <libfdt.h>
 #include <lk2nd.h>
+#include <stdlib.h>
 #include <string.h>
 #include "fastboot.h"
 
@@ -13,6 +15,30 @@ static void cmd_oem_cmdline(const char *arg, void *data, unsigned sz)
 	fastboot_stage(lk2nd_dev.cmdline, strlen(lk2nd_dev.cmdline));
 }
 
+/* oem bench [name], the table is sent as INFO lines */
+static void cmd_oem_bench(const char *arg, void *data, unsigned sz)
+{
+	lk2nd_bench(*arg ? arg : NULL, fastboot_info);
+	fastboot_okay("");
+}
+
+/* oem profile <start [ms]|stop|threads|hist [n]|folded> */
+static void cmd_oem_profile(const char *arg, void *data, unsigned sz)
+{
+	char cmd[16];
+	const char *param;
+	unsigned len;
+
+	param = strchr(arg, ' ');
+	len = param ? (unsigned)(param - arg) : strlen(arg);
+	strlcpy(cmd, arg, MIN(len + 1, sizeof(cmd)));
+
+	if (profile_command(cmd, param ? atoi(param + 1) : 0, fastboot_info))
+		fastboot_fail("");
+	else
+		fastboot_okay("");
+}
+
 #if TARGET_MSM8916
 extern status_t smb1360_reload(const struct smb1360 *smb);
 
@@ -29,6 +55,9 @@ static void cmd_oem_smb1360_reload(const char *arg, void *data, unsigned sz)
 #endif
 
 void fastboot_lk2nd_register_commands(void) {
+	fastboot_register("oem bench", cmd_oem_bench);
+	fastboot_register("oem profile", cmd_oem_profile);
+
 	if (lk2nd_dev.fdt)
 		fastboot_register("oem dtb", cmd_oem_dtb);
 
@@ -54,6 +54,8 @@ typedef struct
 	struct udc_request *(*udc_request_alloc)(void);
 	void (*udc_request_free)(struct udc_request *req);
 
+	int (*udc_request_queue)(struct udc_endpoint *ept, struct udc_request *req);
+
 	int (*usb_read)(void *buf, unsigned len);
 	int (*usb_write)(void *buf, unsigned len);
 } usb_controller_interface_t;
@@ -62,6 +64,9 @@ usb_controller_interface_t usb_if;
 
 #define MAX_USBFS_BULK_SIZE (32 * 1024)
 
+/* Size of each half of the double buffer used for streamed uploads */
+#define UPLOAD_STREAM_CHUNK (1024 * 1024)
+
 void boot_linux(void *bootimg, unsigned sz);
 static void fastboot_notify(struct udc_gadget *gadget, unsigned event);
 static struct udc_endpoint *fastboot_endpoints[2];
@@ -120,9 +125,9 @@ struct fastboot_cmd {
 };
 
 struct fastboot_var {
-	struct fastboot_var *next;
 	const char *name;
 	const char *value;
+	unsigned seq;
 };
 
 static struct fastboot_cmd *cmdlist;
@@ -141,18 +146,92 @@ void fastboot_register(const char *prefix,
 	}
 }
 
-static struct fastboot_var *varlist;
+/*
+ * Published variables in one contiguous table. It is sorted by name on
+ * the first lookup after a change, so getvar is a binary search.
+ */
+static struct fastboot_var *vars;
+static unsigned vars_count;
+static unsigned vars_size;
+static unsigned vars_seq;
+static bool vars_sorted;
 
 void fastboot_publish(const char *name, const char *value)
 {
 	struct fastboot_var *var;
-	var = malloc(sizeof(*var));
-	if (var) {
-		var->name = name;
-		var->value = value;
-		var->next = varlist;
-		varlist = var;
+	unsigned size;
+
+	if (vars_count == vars_size) {
+		size = vars_size ? vars_size * 2 : 64;
+		var = realloc(vars, size * sizeof(*vars));
+		if (!var)
+			return;
+		vars = var;
+		vars_size = size;
+	}
+
+	var = &vars[vars_count++];
+	var->name = name;
+	var->value = value;
+	var->seq = vars_seq++;
+	vars_sorted = false;
+}
+
+/* Order by name, the most recently published first for equal names */
+static int fastboot_var_cmp(const struct fastboot_var *a, const struct fastboot_var *b)
+{
+	int r = strcmp(a->name, b->name);
+
+	if (r)
+		return r;
+	return a->seq > b->seq ? -1 : 1;
+}
+
+static void fastboot_sort_vars(void)
+{
+	struct fastboot_var tmp;
+	unsigned gap, i, j, n = 0;
+
+	for (gap = vars_count / 2; gap; gap /= 2) {
+		for (i = gap; i < vars_count; i++) {
+			tmp = vars[i];
+			for (j = i; j >= gap && fastboot_var_cmp(&vars[j - gap], &tmp) > 0; j -= gap)
+				vars[j] = vars[j - gap];
+			vars[j] = tmp;
+		}
+	}
+
+	/* Publishing a name again replaces the earlier value */
+	for (i = 0; i < vars_count; i++) {
+		if (!n || strcmp(vars[n - 1].name, vars[i].name))
+			vars[n++] = vars[i];
+	}
+
+	vars_count = n;
+	vars_sorted = true;
+}
+
+static struct fastboot_var *fastboot_find_var(const char *name)
+{
+	unsigned lo = 0, hi, mid;
+	int r;
+
+	if (!vars_sorted)
+		fastboot_sort_vars();
+
+	hi = vars_count;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		r = strcmp(name, vars[mid].name);
+		if (!r)
+			return &vars[mid];
+		if (r < 0)
+			hi = mid;
+		else
+			lo = mid + 1;
 	}
+
+	return NULL;
 }
 
 
@@ -167,6 +246,12 @@ static void *download_base;
 static unsigned download_max;
 static unsigned download_size;
 
+/* Data staged for the next upload, see fastboot_stage() */
+static const void *upload_data;
+static unsigned upload_size;
+static fastboot_stage_read_fn upload_read;
+static void *upload_cookie;
+
 #define STATE_OFFLINE	0
 #define STATE_COMMAND	1
 #define STATE_COMPLETE	2
@@ -414,30 +499,45 @@ void fastboot_okay(const char *info)
 
 void fastboot_stage(const void *data, unsigned sz)
 {
-	download_size = 0;
-	if (sz > download_max) {
-		fastboot_fail("data too large");
+	upload_read = NULL;
+	upload_data = data;
+	upload_size = sz;
+
+	/* Keep the staged data available to handlers if it is already there */
+	download_size = (data == download_base) ? sz : 0;
+
+	fastboot_okay("");
+}
+
+void fastboot_stage_stream(fastboot_stage_read_fn read, void *cookie, unsigned sz)
+{
+	if (download_max < 2 * UPLOAD_STREAM_CHUNK) {
+		fastboot_fail("download buffer too small");
 		return;
 	}
 
-	if (data != download_base)
-		memcpy(download_base, data, sz);
-	download_size = sz;
+	download_size = 0;
+	upload_data = NULL;
+	upload_read = read;
+	upload_cookie = cookie;
+	upload_size = sz;
 
 	fastboot_okay("");
 }
 
+static void cmd_getvar_all(void);
+
 static void cmd_getvar(const char *arg, void *data, unsigned sz)
 {
 	struct fastboot_var *var;
 
-	for (var = varlist; var; var = var->next) {
-		if (!strcmp(var->name, arg)) {
-			fastboot_okay(var->value);
-			return;
-		}
+	if (!strcmp(arg, "all")) {
+		cmd_getvar_all();
+		return;
 	}
-	fastboot_okay("");
+
+	var = fastboot_find_var(arg);
+	fastboot_okay(var ? var->value : "");
 }
 
 static void cmd_help(const char *arg, void *data, unsigned sz)
@@ -469,6 +569,8 @@ static void cmd_download(const char *arg, void *data, unsigned sz)
 	int r;
 
 	download_size = 0;
+	upload_data = NULL;
+	upload_read = NULL;
 	if (len > download_max) {
 		fastboot_fail("data too large");
 		return;
@@ -491,11 +593,155 @@ static void cmd_download(const char *arg, void *data, unsigned sz)
 	fastboot_okay("");
 }
 
+/*
+ * Queue a write without waiting for it, so the CPU can prepare the next
+ * chunk while the controller sends this one. Complete it with
+ * usb_write_finish() before starting another transfer.
+ */
+static int usb_write_start(void *buf, unsigned len)
+{
+	if (fastboot_state == STATE_ERROR)
+		return -1;
+
+	/* flush buffer to main memory before giving to udc */
+	arch_clean_invalidate_cache_range((addr_t) buf, len);
+
+	req->buf      = (void*) PA((addr_t)buf);
+	req->length   = len;
+	req->complete = req_complete;
+
+	if (usb_if.udc_request_queue(in, req) < 0) {
+		dprintf(CRITICAL, "usb_write_start() queue failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int usb_write_finish(unsigned len)
+{
+	event_wait(&txn_done);
+
+	if (txn_status < 0 || req->length != len) {
+		dprintf(CRITICAL, "usb_write_finish() transaction failed. txn_status = %d\n",
+				txn_status);
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Send the staged stream, reading the next chunk into the other half of
+ * the download buffer while the previous one is still being transferred.
+ */
+static void upload_stream(void)
+{
+	STACKBUF_DMA_ALIGN(response, MAX_RSP_SIZE);
+	uint8_t *buf[2] = { download_base, (uint8_t *)download_base + UPLOAD_STREAM_CHUNK };
+	unsigned offset = 0, len, next_len;
+	int cur = 0, r = 0;
+
+	len = MIN(upload_size, UPLOAD_STREAM_CHUNK);
+	if (upload_read(upload_cookie, 0, buf[cur], len)) {
+		fastboot_fail("failed to read data");
+		return;
+	}
+
+	snprintf(response, MAX_RSP_SIZE, "DATA%08x", upload_size);
+	if (usb_if.usb_write(response, strlen(response)) < 0)
+		return;
+
+	while (len) {
+		if (usb_write_start(buf[cur], len))
+			goto err;
+
+		next_len = MIN(upload_size - offset - len, UPLOAD_STREAM_CHUNK);
+		if (next_len)
+			r = upload_read(upload_cookie, offset + len, buf[!cur], next_len);
+
+		if (usb_write_finish(len) || r)
+			goto err;
+
+		offset += len;
+		len = next_len;
+		cur = !cur;
+	}
+
+	fastboot_okay("");
+	return;
+
+err:
+	/* The host already expects the data, there is no way to fail cleanly */
+	dprintf(CRITICAL, "upload failed at offset %u\n", offset);
+	fastboot_state = STATE_ERROR;
+}
+
+static unsigned getvar_all_format(char *buf, const struct fastboot_var *var)
+{
+	/* Skip the padding some values carry for the single getvar reply */
+	snprintf(buf, MAX_RSP_SIZE, "INFO%s:%s", var->name,
+		 var->value + strspn(var->value, " \t"));
+	return strlen(buf);
+}
+
+/*
+ * Send all variables as "INFO<name>:<value>" lines, answering with a
+ * single command what would otherwise take one getvar round trip per
+ * variable. Every line still has to be a transfer of its own, so the
+ * next one is formatted while the previous one is being sent.
+ */
+static void cmd_getvar_all(void)
+{
+	STACKBUF_DMA_ALIGN(buf0, MAX_RSP_SIZE);
+	STACKBUF_DMA_ALIGN(buf1, MAX_RSP_SIZE);
+	char *buf[2] = { (char *)buf0, (char *)buf1 };
+	unsigned i, len = 0, next_len = 0;
+	int cur = 0;
+
+	if (!vars_sorted)
+		fastboot_sort_vars();
+
+	if (vars_count)
+		len = getvar_all_format(buf[cur], &vars[0]);
+
+	for (i = 0; i < vars_count; i++) {
+		if (usb_write_start(buf[cur], len))
+			goto err;
+
+		if (i + 1 < vars_count)
+			next_len = getvar_all_format(buf[!cur], &vars[i + 1]);
+
+		if (usb_write_finish(len))
+			goto err;
+
+		len = next_len;
+		cur = !cur;
+	}
+
+	fastboot_okay("");
+	return;
+
+err:
+	dprintf(CRITICAL, "getvar:all failed at %u of %u\n", i, vars_count);
+	fastboot_state = STATE_ERROR;
+}
+
 static void cmd_upload(const char *arg, void *data, unsigned sz)
 {
 	STACKBUF_DMA_ALIGN(response, MAX_RSP_SIZE);
 	int r;
 
+	if (upload_read) {
+		upload_stream();
+		return;
+	}
+
+	if (upload_data) {
+		data = (void *)upload_data;
+		sz = upload_size;
+	}
+
 	if (!sz) {
 		fastboot_fail("no data staged");
 		return;
@@ -619,6 +865,7 @@ int fastboot_init(void *base, unsigned size)
 		usb_if.udc_endpoint_alloc  = usb30_udc_endpoint_alloc;
 		usb_if.udc_request_alloc   = usb30_udc_request_alloc;
 		usb_if.udc_request_free    = usb30_udc_request_free;
+		usb_if.udc_request_queue   = usb30_udc_request_queue;
 
 		usb_if.usb_read            = usb30_usb_read;
 		usb_if.usb_write           = usb30_usb_write;
@@ -638,6 +885,7 @@ int fastboot_init(void *base, unsigned size)
 		usb_if.udc_endpoint_alloc  = udc_endpoint_alloc;
 		usb_if.udc_request_alloc   = udc_request_alloc;
 		usb_if.udc_request_free    = udc_request_free;
+		usb_if.udc_request_queue   = udc_request_queue;
 
 		usb_if.usb_read            = hsusb_usb_read;
 		usb_if.usb_write           = hsusb_usb_write;
@@ -55,7 +55,16 @@ void fastboot_publish(const char *name, const char *value);
 void fastboot_okay(const char *result);
 void fastboot_fail(const char *reason);
 void fastboot_info(const char *reason);
+
+/* stage data for the next upload command
+ * - data is not copied, it must stay valid until it is uploaded
+ */
 void fastboot_stage(const void *data, unsigned sz);
 
+/* stage sz bytes that are read in chunks by read() during the upload */
+typedef int (*fastboot_stage_read_fn)(void *cookie, unsigned offset,
+				      void *buf, unsigned len);
+void fastboot_stage_stream(fastboot_stage_read_fn read, void *cookie, unsigned sz);
+
 
 #endif
@@ -2,6 +2,7 @@
 
 #include <debug.h>
 #include <target.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <lib/bio.h>
@@ -58,11 +59,25 @@ static enum rproc_mode fsboot_load_rproc_mode(const char *path)
 	return RPROC_MODE_UNKNOWN;
 }
 
-/* Only iterate through files if target is NULL */
-static int fsboot_fs_load_img(char *dev_name, void* target, size_t sz)
+struct fsboot_buf {
+	void *target;
+	size_t sz;
+};
+
+static int fsboot_load_buf(filehandle *handle, off_t size, void *arg)
+{
+	struct fsboot_buf *buf = arg;
+
+	return fs_read_file(handle, buf->target, 0, MIN((size_t)size, buf->sz));
+}
+
+/* Only iterate through files if load is NULL */
+static int fsboot_fs_load_img(char *dev_name, fsboot_load_t load, void *arg)
 {
 	struct dirhandle *dirh;
 	struct dirent dirent;
+	struct file_stat stat;
+	filehandle *handle;
 
 	char image_path[128] = "/mnt/";
 	int ret = -1;
@@ -78,7 +93,7 @@ static int fsboot_fs_load_img(char *dev_name, void* target, size_t sz)
 	}
 
 	while (fs_read_dir(dirh, &dirent) >= 0) {
-		if (!target)
+		if (!load)
 			dprintf(SPEW, "| /%s/%s\n", dev_name, dirent.name);
 		if (!path_valid && strncmp(dirent.name, "boot.img", 7) == 0) {
 			strcpy(&image_path[strlen("/mnt/")], dirent.name);
@@ -92,8 +107,15 @@ static int fsboot_fs_load_img(char *dev_name, void* target, size_t sz)
 	}
 	fs_close_dir(dirh);
 
-	if (target && path_valid)
-		ret = fs_load_file(image_path, target, sz);
+	if (load && path_valid) {
+		ret = fs_open_file(image_path, &handle);
+		if (ret >= 0) {
+			ret = fs_stat_file(handle, &stat);
+			if (ret >= 0)
+				ret = load(handle, stat.size, arg);
+			fs_close_file(handle);
+		}
+	}
 
 	if (ret >= 0 && path_valid && !fs_boot_data.dev) {
 		fs_boot_data.rproc_mode = fsboot_load_rproc_mode("/mnt/lk2nd_rproc_mode");
@@ -105,7 +127,7 @@ out:
 	return ret;
 }
 
-static int fsboot_find_and_boot(int bdev_id, void* target, size_t sz)
+static int fsboot_find_and_boot(int bdev_id, fsboot_load_t load, void *arg)
 {
 	int i = 0, j = 0, ret = 0;
 	char dev_name[128];
@@ -127,7 +149,7 @@ static int fsboot_find_and_boot(int bdev_id, void* target, size_t sz)
 
 	bio_close(dev);
 
-	if (!target)
+	if (!load)
 		dprintf(SPEW, "fs-boot: Looking at %s:\n", dev_name);
 
 	sprintf(dev_name, "hd%dp%d", bdev_id, i);
@@ -139,14 +161,14 @@ static int fsboot_find_and_boot(int bdev_id, void* target, size_t sz)
 			sprintf(dev_name, "hd%dp%d", bdev_id, i);
 			continue;
 		}
-		if (!target)
+		if (!load)
 			dprintf(SPEW, "%.8s:  %.10s (%6llu MiB): \n",dev->name, dev->label, dev->size / (1024 * 1024));
 		bio_close(dev);
 
-		ret = fsboot_fs_load_img(dev_name, target, sz);
+		ret = fsboot_fs_load_img(dev_name, load, arg);
 		if (ret >= 0)
 			fs_boot_data.dev = bdev_id;
-		if (target && ret >= 0)
+		if (load && ret >= 0)
 			return ret;
 
 		/*
@@ -158,13 +180,13 @@ static int fsboot_find_and_boot(int bdev_id, void* target, size_t sz)
 			j = 0;
 			sprintf(dev_name, "hd%dp%dp%d", bdev_id, i, j);
 			while (dev = bio_open(dev_name)) {
-				if (!target)
+				if (!load)
 					dprintf(SPEW, "%.8s:  %.10s (%6llu MiB): \n",dev->name, dev->label, dev->size / (1024 * 1024));
 				bio_close(dev);
-				ret = fsboot_fs_load_img(dev_name, target, sz);
+				ret = fsboot_fs_load_img(dev_name, load, arg);
 				if (ret >= 0)
 					fs_boot_data.dev = bdev_id;
-				if (target && ret >= 0)
+				if (load && ret >= 0)
 					return ret;
 
 				j++;
@@ -181,21 +203,28 @@ static int fsboot_find_and_boot(int bdev_id, void* target, size_t sz)
 void fsboot_test(void)
 {
 	dprintf(SPEW, "fs-boot: Scanned devices:\n");
-	fsboot_find_and_boot(FS_BOOT_DEV_SDCARD, NULL, 0);
-	fsboot_find_and_boot(FS_BOOT_DEV_EMMC, NULL, 0);
+	fsboot_find_and_boot(FS_BOOT_DEV_SDCARD, NULL, NULL);
+	fsboot_find_and_boot(FS_BOOT_DEV_EMMC, NULL, NULL);
 }
 
-int fsboot_boot_first(void* target, size_t sz)
+int fsboot_load_first(fsboot_load_t load, void *arg)
 {
 	int ret = -1;
 
-	ret = fsboot_find_and_boot(FS_BOOT_DEV_SDCARD, target, sz);
+	ret = fsboot_find_and_boot(FS_BOOT_DEV_SDCARD, load, arg);
 	if (ret > 0)
 		return ret;
 
-	ret = fsboot_find_and_boot(FS_BOOT_DEV_EMMC, target, sz);
+	ret = fsboot_find_and_boot(FS_BOOT_DEV_EMMC, load, arg);
 	if (ret > 0)
 		return ret;
 
 	return -1;
 }
+
+int fsboot_boot_first(void* target, size_t sz)
+{
+	struct fsboot_buf buf = { target, sz };
+
+	return fsboot_load_first(fsboot_load_buf, &buf);
+}
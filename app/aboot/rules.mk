@@ -4,7 +4,10 @@ INCLUDES += -I$(LK_TOP_DIR)/platform/msm_shared/include -I$(LK_TOP_DIR)/lib/zlib
 
 DEFINES += ASSERT_ON_TAMPER=1
 
-MODULES += lib/zlib_inflate
+MODULES += \
+	lib/lz4 \
+	lib/sparse \
+	lib/zlib_inflate
 
 # fs_boot modules:
 MODULES += \
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Boot pipeline benchmark: prints how long each phase of aboot's boot
+ * path takes (fs-boot, kernel decompression, DTB selection, loading,
+ * device tree fixups and cleanup) whenever aboot boots a kernel through
+ * boot_linux_from_fs() or cmd_boot().
+ */
+
+#include <app/bootbench.h>
+#include <debug.h>
+#include <fs_boot.h>
+#include <platform.h>
+#include <string.h>
+
+#if WITH_LIB_CONSOLE
+#include <lib/console.h>
+#endif
+
+static struct {
+	bool active;
+	bigtime_t start;
+	bigtime_t last;
+} bootbench;
+
+void bootbench_start(void)
+{
+	/* cmd_boot() is also used by fs-boot, keep measuring from there */
+	if (bootbench.active)
+		return;
+
+	bootbench.active = true;
+	bootbench.start = bootbench.last = current_time_hires();
+}
+
+void bootbench_phase(const char *phase)
+{
+	bigtime_t now;
+
+	if (!bootbench.active)
+		return;
+
+	now = current_time_hires();
+	dprintf(INFO, "bootbench: %-10s %8llu us\n", phase, now - bootbench.last);
+	bootbench.last = now;
+
+	if (!strcmp(phase, "uninit")) {
+		dprintf(INFO, "bootbench: %-10s %8llu us\n", "total",
+			now - bootbench.start);
+		bootbench.active = false;
+	}
+}
+
+#if WITH_LIB_CONSOLE
+static int cmd_bootbench(int argc, const cmd_args *argv)
+{
+	boot_linux_from_fs();
+
+	dprintf(CRITICAL, "bootbench: Booting from fs-boot failed\n");
+	bootbench.active = false;
+	return -1;
+}
+
+STATIC_COMMAND_START
+	{ "bootbench", "boot the first boot.img found by fs-boot", &cmd_bootbench },
+STATIC_COMMAND_END(bootbench);
+#endif
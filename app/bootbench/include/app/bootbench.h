@@ -0,0 +1,12 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef __APP_BOOTBENCH_H
+#define __APP_BOOTBENCH_H
+
+/*
+ * Called by aboot when it starts to boot a kernel and at the end of each
+ * boot phase. The "uninit" phase is the last one before the kernel entry.
+ */
+void bootbench_start(void);
+void bootbench_phase(const char *phase);
+
+#endif
@@ -0,0 +1,10 @@
+LOCAL_DIR := $(GET_LOCAL_DIR)
+
+INCLUDES += -I$(LOCAL_DIR)/include
+
+# the phases are reported by aboot's boot path
+MODULES += \
+	app/aboot
+
+OBJS += \
+	$(LOCAL_DIR)/bootbench.o
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <app/tests.h>
+#include <board.h>
+#include <debug.h>
+#include <dev_tree.h>
+#include <err.h>
+#include <libfdt.h>
+#include <malloc.h>
+#include <platform.h>
+#include <stdio.h>
+#include <string.h>
+#include <target.h>
+
+#if WITH_LK2ND
+#include <lk2nd.h>
+#endif
+
+#if DEVICE_TREE && WITH_APP_ABOOT
+
+/* Fake kernel with three DTBs appended, only the middle one matches */
+#define DTB_TEST_KERNEL_SIZE	4096
+#define DTB_TEST_DTB_SIZE	1024
+#define DTB_TEST_COUNT		3
+#define DTB_TEST_MATCH		1
+#define DTB_TEST_LOOPS		64
+#define DTB_TEST_MODEL		"lk2nd,dtb-test-%d"
+
+/* qcom,msm-id and qcom,board-id that platform_dt_absolute_match() accepts */
+static void dtb_test_ids(fdt32_t msm_id[2], fdt32_t board_id[2])
+{
+#if WITH_LK2ND
+	if (lk2nd_dev.dt_entry.offset) {
+		msm_id[0] = cpu_to_fdt32(lk2nd_dev.dt_entry.platform_id);
+		msm_id[1] = cpu_to_fdt32(lk2nd_dev.dt_entry.soc_rev);
+		board_id[0] = cpu_to_fdt32(lk2nd_dev.dt_entry.variant_id);
+		board_id[1] = cpu_to_fdt32(lk2nd_dev.dt_entry.board_hw_subtype);
+		return;
+	}
+#endif
+	msm_id[0] = cpu_to_fdt32(board_platform_id());
+	msm_id[1] = cpu_to_fdt32(board_soc_version());
+	board_id[0] = cpu_to_fdt32(board_hardware_id());
+	board_id[1] = cpu_to_fdt32(board_hardware_subtype() |
+				   (target_get_hlos_subtype() & 0x700));
+}
+
+/* Append the test DTBs after the kernel, returns the total size */
+static int dtb_test_build(uint8_t *kernel, uint32_t dtb_sizes[DTB_TEST_COUNT])
+{
+	fdt32_t msm_id[2], board_id[2];
+	uint8_t *dtb = kernel + DTB_TEST_KERNEL_SIZE;
+	char model[32];
+	int i, ret;
+
+	memset(kernel, 0, DTB_TEST_KERNEL_SIZE);
+
+	for (i = 0; i < DTB_TEST_COUNT; i++) {
+		dtb_test_ids(msm_id, board_id);
+		if (i != DTB_TEST_MATCH)
+			msm_id[0] = cpu_to_fdt32(fdt32_to_cpu(msm_id[0]) ^ 1);
+
+		snprintf(model, sizeof(model), DTB_TEST_MODEL, i);
+		ret = fdt_create_empty_tree(dtb, DTB_TEST_DTB_SIZE);
+		if (!ret)
+			ret = fdt_setprop_string(dtb, 0, "model", model);
+		if (!ret)
+			ret = fdt_setprop(dtb, 0, "qcom,msm-id", msm_id, sizeof(msm_id));
+		if (!ret)
+			ret = fdt_setprop(dtb, 0, "qcom,board-id", board_id, sizeof(board_id));
+		if (!ret)
+			ret = fdt_pack(dtb);
+		if (ret) {
+			printf("dtb tests: failed to build dtb %d: %d\n", i, ret);
+			return ERR_NOT_VALID;
+		}
+
+		dtb_sizes[i] = fdt_totalsize(dtb);
+		dtb += dtb_sizes[i];
+	}
+
+	return dtb - kernel;
+}
+
+static int dtb_test_select(uint8_t *kernel, uint32_t size, void *tags, int expected)
+{
+	const char *model;
+	char name[32];
+	void *dtb;
+
+	/* dev_tree_appended() clears the magic of the first DTB */
+	*(fdt32_t *)(kernel + DTB_TEST_KERNEL_SIZE) = cpu_to_fdt32(FDT_MAGIC);
+
+	dtb = dev_tree_appended(kernel, size, DTB_TEST_KERNEL_SIZE, tags);
+	if (dtb != tags) {
+		printf("dtb tests: no DTB selected from %u bytes\n", size);
+		return ERR_NOT_FOUND;
+	}
+
+	snprintf(name, sizeof(name), DTB_TEST_MODEL, expected);
+	model = fdt_getprop(dtb, 0, "model", NULL);
+	if (!model || strcmp(model, name)) {
+		printf("dtb tests: selected %s, expected %s\n",
+		       model ? model : "(null)", name);
+		return ERR_NOT_VALID;
+	}
+
+	return 0;
+}
+
+int dtb_tests(void)
+{
+	uint32_t dtb_sizes[DTB_TEST_COUNT];
+	uint8_t *kernel;
+	void *tags = target_get_scratch_address();
+	time_t start;
+	int i, size, ret;
+
+	kernel = malloc(DTB_TEST_KERNEL_SIZE + DTB_TEST_COUNT * DTB_TEST_DTB_SIZE);
+	if (!kernel)
+		return ERR_NO_MEMORY;
+
+	size = dtb_test_build(kernel, dtb_sizes);
+	if (size < 0) {
+		ret = size;
+		goto out;
+	}
+
+	/* A single appended DTB is used even if it doesn't match */
+	ret = dtb_test_select(kernel, DTB_TEST_KERNEL_SIZE + dtb_sizes[0], tags, 0);
+	if (ret)
+		goto out;
+
+	start = current_time();
+	for (i = 0; i < DTB_TEST_LOOPS; i++) {
+		ret = dtb_test_select(kernel, size, tags, DTB_TEST_MATCH);
+		if (ret)
+			goto out;
+	}
+	printf("dtb tests: selected from %d DTBs %u times in %lu ms\n",
+	       DTB_TEST_COUNT, DTB_TEST_LOOPS, current_time() - start);
+
+out:
+	printf("dtb tests: %s\n", ret ? "FAILED" : "passed");
+	free(kernel);
+	return ret;
+}
+
+#endif
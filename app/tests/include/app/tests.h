@@ -25,6 +25,10 @@
 
 int thread_tests(void);
 void printf_tests(void);
+int workpool_tests(void);
+int sha_tests(void);
+int storage_tests(void);
+int dtb_tests(void);
 
 #endif
 
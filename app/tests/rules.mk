@@ -1,6 +1,6 @@
 LOCAL_DIR := $(GET_LOCAL_DIR)
 
-INCLUDES += -I$(LOCAL_DIR)/include
+INCLUDES += -I$(LOCAL_DIR)/include -I$(LK_TOP_DIR)/lib/zlib_inflate
 
 OBJS += \
 	$(LOCAL_DIR)/tests.o \
@@ -8,4 +8,9 @@ OBJS += \
 	$(LOCAL_DIR)/printf_tests.o \
 	$(LOCAL_DIR)/i2c_tests.o \
 	$(LOCAL_DIR)/adc_tests.o \
-	$(LOCAL_DIR)/kauth_test.o
+	$(LOCAL_DIR)/kauth_test.o \
+	$(LOCAL_DIR)/sha_tests.o \
+	$(LOCAL_DIR)/workpool_tests.o \
+	$(LOCAL_DIR)/storage_tests.o \
+	$(LOCAL_DIR)/storage_tests_image.o \
+	$(LOCAL_DIR)/dtb_tests.o
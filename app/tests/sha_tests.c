@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <app/tests.h>
+#include <arm_arch.h>
+#include <debug.h>
+#include <malloc.h>
+#include <platform.h>
+#include <sha.h>
+#include <string.h>
+
+#define SHA_TEST_BUF_SIZE	(4 * 1024 * 1024)
+
+/* From lib/openssl/crypto/armcap.c */
+extern unsigned int OPENSSL_armcap_P;
+void OPENSSL_cpuid_setup(void);
+
+struct sha_test_vector {
+	const char *msg;
+	unsigned int repeat;
+	const char *sha1;
+	const char *sha256;
+};
+
+/* FIPS 180-2 examples */
+static const struct sha_test_vector sha_test_vectors[] = {
+	{ "abc", 1,
+	  "a9993e364706816aba3e25717850c26c9cd0d89d",
+	  "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+	{ "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+	  "84983e441c3bd26ebaae4aa1f95129e5e54670f1",
+	  "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+	{ "a", 1000000,
+	  "34aa973cd4c4daa4f61eeb2bdbad27316534016f",
+	  "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+};
+
+static int sha_test_compare(const char *name, const unsigned char *md,
+			    unsigned int len, const char *expected)
+{
+	char hex[2 * SHA256_DIGEST_LENGTH + 1];
+	unsigned int i;
+
+	for (i = 0; i < len; i++)
+		snprintf(hex + 2 * i, 3, "%02x", md[i]);
+
+	if (strcmp(hex, expected)) {
+		printf("sha tests: %s: got %s, expected %s\n", name, hex, expected);
+		return -1;
+	}
+	return 0;
+}
+
+static int sha_test_vectors_run(const char *impl)
+{
+	const struct sha_test_vector *v;
+	unsigned char md[SHA256_DIGEST_LENGTH];
+	SHA256_CTX sha256;
+	SHA_CTX sha1;
+	unsigned int i, j;
+	int ret = 0;
+
+	for (i = 0; i < ARRAY_SIZE(sha_test_vectors); i++) {
+		v = &sha_test_vectors[i];
+
+		SHA1_Init(&sha1);
+		SHA256_Init(&sha256);
+		for (j = 0; j < v->repeat; j++) {
+			SHA1_Update(&sha1, v->msg, strlen(v->msg));
+			SHA256_Update(&sha256, v->msg, strlen(v->msg));
+		}
+
+		SHA1_Final(md, &sha1);
+		ret |= sha_test_compare(impl, md, SHA_DIGEST_LENGTH, v->sha1);
+		SHA256_Final(md, &sha256);
+		ret |= sha_test_compare(impl, md, SHA256_DIGEST_LENGTH, v->sha256);
+	}
+
+	return ret;
+}
+
+static void sha_test_bench(const char *impl, unsigned char *buf)
+{
+	unsigned char md[SHA256_DIGEST_LENGTH];
+	bigtime_t start, sha1_us, sha256_us;
+
+	start = current_time_hires();
+	SHA1(buf, SHA_TEST_BUF_SIZE, md);
+	sha1_us = current_time_hires() - start;
+
+	start = current_time_hires();
+	SHA256(buf, SHA_TEST_BUF_SIZE, md);
+	sha256_us = current_time_hires() - start;
+
+	printf("sha tests: %-6s SHA-1 %llu us, SHA-256 %llu us for %u KiB\n",
+	       impl, sha1_us, sha256_us, SHA_TEST_BUF_SIZE / 1024);
+}
+
+int sha_tests(void)
+{
+	unsigned char md1[SHA256_DIGEST_LENGTH], md2[SHA256_DIGEST_LENGTH];
+	unsigned int caps, len, i;
+	unsigned char *buf;
+	int ret = 0;
+
+	OPENSSL_cpuid_setup();
+	caps = OPENSSL_armcap_P;
+	printf("sha tests: armcap %#x\n", caps);
+
+	buf = malloc(SHA_TEST_BUF_SIZE);
+	if (!buf)
+		return -1;
+
+	for (i = 0; i < SHA_TEST_BUF_SIZE; i++)
+		buf[i] = (i * 2654435761U) >> 24;
+
+	/* Generic implementation first, then whatever the CPU supports */
+	OPENSSL_armcap_P = 0;
+	ret |= sha_test_vectors_run("armv4");
+	sha_test_bench("armv4", buf);
+
+	OPENSSL_armcap_P = caps;
+	if (caps & (ARMV8_SHA1 | ARMV8_SHA256)) {
+		ret |= sha_test_vectors_run("armv8");
+		sha_test_bench("armv8", buf);
+
+		/* Unaligned input and all tail lengths must match the generic code */
+		for (len = 0; len < 1024 && !ret; len++) {
+			OPENSSL_armcap_P = 0;
+			SHA256(buf + 1, len * 61, md1);
+			OPENSSL_armcap_P = caps;
+			SHA256(buf + 1, len * 61, md2);
+			if (memcmp(md1, md2, SHA256_DIGEST_LENGTH)) {
+				printf("sha tests: SHA-256 mismatch, len %u\n", len * 61);
+				ret = -1;
+			}
+
+			OPENSSL_armcap_P = 0;
+			SHA1(buf + 3, len * 61, md1);
+			OPENSSL_armcap_P = caps;
+			SHA1(buf + 3, len * 61, md2);
+			if (memcmp(md1, md2, SHA_DIGEST_LENGTH)) {
+				printf("sha tests: SHA-1 mismatch, len %u\n", len * 61);
+				ret = -1;
+			}
+		}
+	}
+
+	printf("sha tests: %s\n", ret ? "FAILED" : "passed");
+	free(buf);
+	return ret;
+}
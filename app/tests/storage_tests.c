@@ -0,0 +1,529 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <app/tests.h>
+#include <debug.h>
+#include <err.h>
+#include <malloc.h>
+#include <platform.h>
+#include <stdio.h>
+#include <string.h>
+#include <lib/bcache.h>
+#include <lib/bio.h>
+#include <lib/fs.h>
+#include <lib/heap.h>
+#include <lib/partition.h>
+#include <decompress.h>
+
+#if WITH_LIB_LIBFDT
+#include <libfdt.h>
+#endif
+#if WITH_LIB_SPARSE
+#include <lib/sparse.h>
+#endif
+
+#if WITH_LIB_BIO && WITH_LIB_BCACHE && WITH_LIB_PARTITION && \
+    WITH_LIB_FS_EXT2 && WITH_LIB_ZLIB_INFLATE
+
+/* GPT disk with an ext2 partition, see scripts/mkstoragetestimg.py */
+extern const unsigned int storage_test_image_size;
+extern const unsigned int storage_test_image_gz_size;
+extern const unsigned char storage_test_image_gz[];
+
+#define STORAGE_TEST_DEV	"storagetest"
+#define STORAGE_TEST_PART	STORAGE_TEST_DEV "p1"
+#define STORAGE_TEST_MOUNT	"/storagetest"
+#define STORAGE_TEST_FILE	STORAGE_TEST_MOUNT "/test.txt"
+#define STORAGE_TEST_LINES	2048
+#define STORAGE_TEST_LINE	"lk2nd storage test line %05u\n"
+#define STORAGE_TEST_LOOPS	16
+#define STORAGE_TEST_BUF_SIZE	(128 * 1024)
+
+struct storage_bench {
+	const char *name;
+	time_t start;
+	unsigned int allocs;
+};
+
+static void bench_start(struct storage_bench *bench, const char *name)
+{
+	bench->name = name;
+	bench->allocs = heap_alloc_count();
+	bench->start = current_time();
+}
+
+/* Print throughput and heap allocations per operation */
+static void bench_end(struct storage_bench *bench, uint64_t bytes, unsigned int ops)
+{
+	time_t ms = current_time() - bench->start;
+	unsigned int allocs = heap_alloc_count() - bench->allocs;
+
+	if (!ms)
+		ms = 1;
+
+	printf("storage tests: %-12s %5u ops in %4lu ms, %6llu KiB/s, %u.%02u allocs/op\n",
+	       bench->name, ops, ms, bytes * 1000 / ms / 1024,
+	       allocs / ops, allocs * 100 / ops % 100);
+}
+
+static int test_inflate(uint8_t *disk)
+{
+	struct storage_bench bench;
+	unsigned int pos, out_len = 0;
+	int i, ret;
+
+	bench_start(&bench, "inflate");
+	for (i = 0; i < STORAGE_TEST_LOOPS; i++) {
+		ret = decompress((unsigned char *)storage_test_image_gz,
+				 storage_test_image_gz_size, disk,
+				 storage_test_image_size, &pos, &out_len);
+		if (ret || out_len != storage_test_image_size) {
+			printf("storage tests: inflate failed: %d, %u bytes\n",
+			       ret, out_len);
+			return ERR_IO;
+		}
+	}
+	bench_end(&bench, (uint64_t)out_len * STORAGE_TEST_LOOPS, STORAGE_TEST_LOOPS);
+	return 0;
+}
+
+static int test_bio(bdev_t *dev, uint8_t *disk, uint8_t *buf)
+{
+	struct storage_bench bench;
+	unsigned int ops = 0;
+	off_t offset;
+	int i;
+
+	bench_start(&bench, "bio 64k");
+	for (i = 0; i < STORAGE_TEST_LOOPS; i++) {
+		for (offset = 0; offset < dev->size; offset += 65536, ops++) {
+			if (bio_read(dev, buf, offset, 65536) != 65536)
+				return ERR_IO;
+		}
+	}
+	bench_end(&bench, (uint64_t)dev->size * STORAGE_TEST_LOOPS, ops);
+
+	/* Unaligned reads go through the partial block path */
+	ops = 0;
+	bench_start(&bench, "bio unaligned");
+	for (i = 0; i < STORAGE_TEST_LOOPS; i++) {
+		for (offset = 1; offset + 4093 <= dev->size; offset += 65537, ops++) {
+			if (bio_read(dev, buf, offset, 4093) != 4093)
+				return ERR_IO;
+			if (memcmp(buf, disk + offset, 4093)) {
+				printf("storage tests: bio data mismatch at %lld\n", offset);
+				return ERR_IO;
+			}
+		}
+	}
+	bench_end(&bench, (uint64_t)ops * 4093, ops);
+	return 0;
+}
+
+static int test_bcache(bdev_t *dev, uint8_t *disk, uint8_t *buf)
+{
+	struct storage_bench bench;
+	unsigned int ops = 0, block;
+	bcache_t cache;
+	int i, ret = 0;
+
+	cache = bcache_create(dev, dev->block_size, 32);
+	if (!cache)
+		return ERR_NO_MEMORY;
+
+	/* Re-read a working set that fits in the cache, like fs metadata */
+	bench_start(&bench, "bcache");
+	for (i = 0; i < STORAGE_TEST_LOOPS * 64; i++) {
+		for (block = 0; block < 24; block++, ops++) {
+			if (bcache_read_block(cache, buf, block * 7) < 0) {
+				ret = ERR_IO;
+				goto out;
+			}
+		}
+	}
+	bench_end(&bench, (uint64_t)ops * dev->block_size, ops);
+
+	if (memcmp(buf, disk + 23 * 7 * dev->block_size, dev->block_size)) {
+		printf("storage tests: bcache data mismatch\n");
+		ret = ERR_IO;
+	}
+
+out:
+	bcache_destroy(cache);
+	return ret;
+}
+
+static int test_partition(void)
+{
+	struct storage_bench bench;
+	int i, ret;
+
+	partition_unpublish(STORAGE_TEST_DEV);
+
+	bench_start(&bench, "gpt publish");
+	for (i = 0; i < STORAGE_TEST_LOOPS; i++) {
+		ret = partition_publish(STORAGE_TEST_DEV, 0);
+		if (ret != 1) {
+			printf("storage tests: published %d partitions\n", ret);
+			return ERR_NOT_VALID;
+		}
+		if (i < STORAGE_TEST_LOOPS - 1)
+			partition_unpublish(STORAGE_TEST_DEV);
+	}
+	bench_end(&bench, 0, STORAGE_TEST_LOOPS);
+	return 0;
+}
+
+static int test_ext2_verify(const char *data, size_t len)
+{
+	char line[32];
+	size_t line_len;
+	unsigned int i;
+
+	for (i = 0; i < STORAGE_TEST_LINES; i++) {
+		line_len = snprintf(line, sizeof(line), STORAGE_TEST_LINE, i);
+		if (len < line_len || memcmp(data, line, line_len))
+			return ERR_NOT_VALID;
+		data += line_len;
+		len -= line_len;
+	}
+
+	return len ? ERR_NOT_VALID : 0;
+}
+
+static int test_ext2(uint8_t *buf, size_t buf_len)
+{
+	struct storage_bench bench;
+	struct file_stat stat;
+	filehandle *handle;
+	ssize_t len = 0;
+	int i, ret;
+
+	ret = fs_mount(STORAGE_TEST_MOUNT, "ext2", STORAGE_TEST_PART);
+	if (ret < 0) {
+		printf("storage tests: failed to mount ext2: %d\n", ret);
+		return ret;
+	}
+
+	bench_start(&bench, "ext2 read");
+	for (i = 0; i < STORAGE_TEST_LOOPS; i++) {
+		ret = fs_open_file(STORAGE_TEST_FILE, &handle);
+		if (ret < 0)
+			goto out;
+
+		ret = fs_stat_file(handle, &stat);
+		if (ret >= 0 && stat.size > buf_len)
+			ret = ERR_TOO_BIG;
+		if (ret >= 0)
+			len = fs_read_file(handle, buf, 0, stat.size);
+		fs_close_file(handle);
+		if (ret < 0)
+			goto out;
+		if (len != (ssize_t)stat.size) {
+			ret = ERR_IO;
+			goto out;
+		}
+	}
+	bench_end(&bench, (uint64_t)len * STORAGE_TEST_LOOPS, STORAGE_TEST_LOOPS);
+
+	ret = test_ext2_verify((const char *)buf, len);
+
+out:
+	if (ret < 0)
+		printf("storage tests: ext2 read failed: %d\n", ret);
+	fs_unmount(STORAGE_TEST_MOUNT);
+	return ret;
+}
+
+#if WITH_LIB_SPARSE
+#define SPARSE_TEST_DEV		"sparsetest"
+#define SPARSE_TEST_BLK_SZ	4096
+#define SPARSE_TEST_FILL	0x6c6b326e
+#define SPARSE_TEST_UNTOUCHED	0xa5
+
+struct sparse_test_chunk {
+	uint16_t type;
+	uint32_t blocks;
+};
+
+/* The fill chunk is larger than the 1 MiB fill buffer, so it takes two writes */
+static const struct sparse_test_chunk sparse_test_chunks[] = {
+	{ CHUNK_TYPE_RAW, 3 },
+	{ CHUNK_TYPE_DONT_CARE, 5 },
+	{ CHUNK_TYPE_FILL, 300 },
+	{ CHUNK_TYPE_CRC, 0 },
+	{ CHUNK_TYPE_RAW, 2 },
+};
+
+static uint8_t sparse_test_raw(uint32_t offset)
+{
+	return offset * 13 + (offset >> 12);
+}
+
+/* Build a sparse image from sparse_test_chunks, returns its size */
+static size_t sparse_test_build(uint8_t *img, uint32_t *total_blks,
+				chunk_header_t **fill_chunk)
+{
+	sparse_header_t *hdr = (sparse_header_t *)img;
+	const struct sparse_test_chunk *c;
+	chunk_header_t *chunk;
+	uint8_t *data = img + sizeof(*hdr);
+	uint32_t blocks = 0, len, i;
+
+	for (c = sparse_test_chunks; c < sparse_test_chunks + countof(sparse_test_chunks); c++) {
+		chunk = (chunk_header_t *)data;
+		data += sizeof(*chunk);
+
+		switch (c->type) {
+		case CHUNK_TYPE_RAW:
+			len = c->blocks * SPARSE_TEST_BLK_SZ;
+			for (i = 0; i < len; i++)
+				data[i] = sparse_test_raw(blocks * SPARSE_TEST_BLK_SZ + i);
+			break;
+		case CHUNK_TYPE_FILL:
+			len = sizeof(uint32_t);
+			*(uint32_t *)data = SPARSE_TEST_FILL;
+			*fill_chunk = chunk;
+			break;
+		default:
+			len = 0;
+			break;
+		}
+
+		chunk->chunk_type = c->type;
+		chunk->reserved1 = 0;
+		chunk->chunk_sz = c->blocks;
+		chunk->total_sz = sizeof(*chunk) + len;
+		data += len;
+		blocks += c->blocks;
+	}
+
+	hdr->magic = SPARSE_HEADER_MAGIC;
+	hdr->major_version = 1;
+	hdr->minor_version = 0;
+	hdr->file_hdr_sz = sizeof(*hdr);
+	hdr->chunk_hdr_sz = sizeof(chunk_header_t);
+	hdr->blk_sz = SPARSE_TEST_BLK_SZ;
+	hdr->total_blks = blocks;
+	hdr->total_chunks = countof(sparse_test_chunks);
+	hdr->image_checksum = 0;
+
+	*total_blks = blocks;
+	return data - img;
+}
+
+static int sparse_test_verify(const uint8_t *out)
+{
+	const struct sparse_test_chunk *c;
+	uint32_t offset = 0, len, i;
+
+	for (c = sparse_test_chunks; c < sparse_test_chunks + countof(sparse_test_chunks); c++) {
+		len = c->blocks * SPARSE_TEST_BLK_SZ;
+		for (i = 0; i < len; i++, offset++) {
+			uint8_t expected;
+
+			if (c->type == CHUNK_TYPE_RAW)
+				expected = sparse_test_raw(offset);
+			else if (c->type == CHUNK_TYPE_FILL)
+				expected = SPARSE_TEST_FILL >> (offset % 4 * 8);
+			else
+				expected = SPARSE_TEST_UNTOUCHED;
+
+			if (out[offset] != expected) {
+				printf("storage tests: sparse mismatch at %u\n", offset);
+				return ERR_NOT_VALID;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int sparse_test_write(void *arg, uint64_t offset, void *buf, uint32_t len)
+{
+	return bio_write(arg, buf, offset, len) == (ssize_t)len ? 0 : ERR_IO;
+}
+
+/* Each of these must be rejected, restores the image afterwards */
+static int sparse_test_invalid(struct sparse_dest *dest, uint8_t *img, size_t len,
+			       chunk_header_t *fill_chunk)
+{
+	const char *err = NULL;
+	uint64_t size = dest->size;
+	int ret = 0;
+
+	if (!sparse_write(dest, img, len - SPARSE_TEST_BLK_SZ / 2, &err)) {
+		printf("storage tests: accepted truncated sparse image\n");
+		ret = ERR_NOT_VALID;
+	}
+
+	fill_chunk->total_sz += sizeof(uint32_t);
+	if (!sparse_write(dest, img, len, &err)) {
+		printf("storage tests: accepted bogus sparse fill chunk\n");
+		ret = ERR_NOT_VALID;
+	}
+	fill_chunk->total_sz -= sizeof(uint32_t);
+
+	dest->size = size - SPARSE_TEST_BLK_SZ;
+	if (!sparse_write(dest, img, len, &err)) {
+		printf("storage tests: accepted sparse image larger than partition\n");
+		ret = ERR_NOT_VALID;
+	}
+	dest->size = size;
+
+	return ret;
+}
+
+static int test_sparse(void)
+{
+	struct storage_bench bench;
+	struct sparse_dest dest;
+	chunk_header_t *fill_chunk = NULL;
+	const char *err = NULL;
+	uint8_t *img, *out = NULL;
+	uint32_t total_blks;
+	bdev_t *dev = NULL;
+	size_t len;
+	int i, ret;
+
+	img = malloc(SPARSE_TEST_BLK_SZ * 8);
+	if (!img)
+		return ERR_NO_MEMORY;
+
+	len = sparse_test_build(img, &total_blks, &fill_chunk);
+	out = memalign(CACHE_LINE, total_blks * SPARSE_TEST_BLK_SZ);
+	if (!out) {
+		ret = ERR_NO_MEMORY;
+		goto out;
+	}
+	memset(out, SPARSE_TEST_UNTOUCHED, total_blks * SPARSE_TEST_BLK_SZ);
+
+	create_membdev(SPARSE_TEST_DEV, out, total_blks * SPARSE_TEST_BLK_SZ);
+	dev = bio_open(SPARSE_TEST_DEV);
+	if (!dev) {
+		ret = ERR_NOT_FOUND;
+		goto out;
+	}
+
+	dest.size = dev->size;
+	dest.write = sparse_test_write;
+	dest.arg = dev;
+
+	bench_start(&bench, "sparse");
+	for (i = 0; i < STORAGE_TEST_LOOPS; i++) {
+		ret = sparse_write(&dest, img, len, &err);
+		if (ret) {
+			printf("storage tests: sparse write failed: %s\n", err);
+			goto out;
+		}
+	}
+	bench_end(&bench, (uint64_t)dev->size * STORAGE_TEST_LOOPS, STORAGE_TEST_LOOPS);
+
+	ret = sparse_test_verify(out);
+	if (!ret)
+		ret = sparse_test_invalid(&dest, img, len, fill_chunk);
+
+out:
+	if (dev) {
+		bio_unregister_device(dev);
+		bio_close(dev);
+	}
+	free(out);
+	free(img);
+	return ret;
+}
+#endif
+
+#if WITH_LIB_LIBFDT
+#define FDT_TEST_SIZE	STORAGE_TEST_BUF_SIZE
+#define FDT_TEST_NODES	256
+
+static int test_fdt(void *fdt)
+{
+	struct storage_bench bench;
+	char name[32];
+	unsigned int ops = 0;
+	int i, j, offset, ret;
+
+	ret = fdt_create_empty_tree(fdt, FDT_TEST_SIZE);
+	for (i = 0; !ret && i < FDT_TEST_NODES; i++) {
+		snprintf(name, sizeof(name), "node@%x", i);
+		offset = fdt_add_subnode(fdt, 0, name);
+		if (offset < 0) {
+			ret = offset;
+			break;
+		}
+		snprintf(name, sizeof(name), "lk2nd,test-%d", i);
+		ret = fdt_setprop_string(fdt, offset, "compatible", name);
+		if (!ret)
+			ret = fdt_setprop_u32(fdt, offset, "reg", i);
+	}
+	if (ret) {
+		printf("storage tests: failed to build fdt: %d\n", ret);
+		return ERR_NOT_VALID;
+	}
+
+	bench_start(&bench, "fdt lookup");
+	for (j = 0; j < STORAGE_TEST_LOOPS; j++) {
+		for (i = 0; i < FDT_TEST_NODES; i += 5, ops++) {
+			snprintf(name, sizeof(name), "lk2nd,test-%d", i);
+			offset = fdt_node_offset_by_compatible(fdt, -1, name);
+			if (offset < 0 || fdt_getprop(fdt, offset, "reg", NULL) == NULL)
+				return ERR_NOT_FOUND;
+		}
+	}
+	bench_end(&bench, 0, ops);
+	return 0;
+}
+#endif
+
+int storage_tests(void)
+{
+	uint8_t *disk, *buf;
+	bdev_t *dev = NULL;
+	int ret;
+
+	disk = memalign(CACHE_LINE, storage_test_image_size);
+	buf = memalign(CACHE_LINE, STORAGE_TEST_BUF_SIZE);
+	if (!disk || !buf) {
+		ret = ERR_NO_MEMORY;
+		goto out;
+	}
+
+	ret = test_inflate(disk);
+	if (ret)
+		goto out;
+
+	create_membdev(STORAGE_TEST_DEV, disk, storage_test_image_size);
+	dev = bio_open(STORAGE_TEST_DEV);
+	if (!dev) {
+		ret = ERR_NOT_FOUND;
+		goto out;
+	}
+
+	ret = test_bio(dev, disk, buf);
+	if (!ret)
+		ret = test_bcache(dev, disk, buf);
+	if (!ret)
+		ret = test_partition();
+	if (!ret)
+		ret = test_ext2(buf, STORAGE_TEST_BUF_SIZE);
+#if WITH_LIB_SPARSE
+	if (!ret)
+		ret = test_sparse();
+#endif
+#if WITH_LIB_LIBFDT
+	if (!ret)
+		ret = test_fdt(buf);
+#endif
+
+	partition_unpublish(STORAGE_TEST_DEV);
+	bio_unregister_device(dev);
+	bio_close(dev);
+
+out:
+	printf("storage tests: %s\n", ret ? "FAILED" : "PASSED");
+	free(buf);
+	free(disk);
+	return ret;
+}
+
+#endif
@@ -0,0 +1,660 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/* Generated by scripts/mkstoragetestimg.py with e2fsprogs 1.47.0, do not edit */
+#include <sys/types.h>
+
+const unsigned int storage_test_image_size = 1048576;
+const unsigned int storage_test_image_gz_size = 7816;
+const unsigned char storage_test_image_gz[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xdd,
+	0x4b, 0xcf, 0xf7, 0xf9, 0x41, 0xd7, 0xf1, 0xeb, 0xbe, 0x5b, 0x83, 0x01,
+	0x14, 0x0f, 0x78, 0xc2, 0xd3, 0x88, 0x82, 0x07, 0xa4, 0xf2, 0xf9, 0xfd,
+	0xcf, 0x62, 0xa5, 0x55, 0xa1, 0xe2, 0xb1, 0x16, 0xd0, 0x0d, 0x1b, 0x92,
+	0x56, 0x43, 0x68, 0x4a, 0xd2, 0x0e, 0x89, 0x98, 0x10, 0xc7, 0x40, 0x8c,
+	0x2b, 0x1e, 0x85, 0x0b, 0xe3, 0x86, 0xa7, 0xe0, 0x8a, 0x27, 0xa0, 0x0b,
+	0x56, 0xb8, 0x61, 0xeb, 0x61, 0xc1, 0x7e, 0xfc, 0xdf, 0x9d, 0x1b, 0x6c,
+	0x4b, 0xf3, 0x4e, 0x44, 0x81, 0x56, 0x5e, 0xaf, 0xe4, 0x3b, 0x33, 0xd7,
+	0x5c, 0xd7, 0x3d, 0x99, 0xf9, 0x4e, 0xae, 0x3b, 0x9f, 0x6f, 0x67, 0xa6,
+	0xef, 0x97, 0x17, 0xbe, 0x9e, 0xbd, 0x7e, 0xf9, 0xef, 0xef, 0xbf, 0xff,
+	0xfe, 0xab, 0xe7, 0x6f, 0xbd, 0xff, 0x0d, 0xff, 0xe7, 0x3f, 0xfa, 0x47,
+	0xfe, 0xe3, 0xf7, 0xff, 0xc0, 0x0f, 0xbe, 0xf3, 0xc9, 0x8f, 0x7f, 0xea,
+	0x87, 0x5f, 0x5e, 0x5e, 0xbd, 0xfc, 0xe8, 0xf3, 0xf7, 0xfc, 0xd2, 0xb7,
+	0xfd, 0xea, 0xbf, 0x7b, 0xf3, 0x99, 0x57, 0x6f, 0xbf, 0xe2, 0xd7, 0xfe,
+	0xa8, 0xdf, 0xfe, 0xf6, 0xe3, 0x5f, 0x7e, 0xfb, 0xf1, 0xe7, 0x8e, 0x9f,
+	0xf8, 0xec, 0xcb, 0xa7, 0x5f, 0x3e, 0xf6, 0xde, 0x07, 0x1f, 0xbe, 0x7a,
+	0xfd, 0xf6, 0xf3, 0xef, 0xbd, 0x3d, 0xdf, 0xf9, 0x1d, 0x8f, 0x8f, 0xfb,
+	0xbb, 0xf3, 0xb5, 0xef, 0x17, 0x3e, 0xfa, 0x8b, 0xdf, 0xf2, 0xb3, 0x3f,
+	0xf7, 0xf9, 0x4f, 0xfc, 0xfc, 0x4f, 0x7f, 0xf4, 0xc7, 0x7f, 0xe9, 0x13,
+	0x3f, 0xf3, 0x2b, 0x5f, 0xf1, 0xf7, 0xf5, 0xf5, 0xc7, 0xde, 0x7e, 0xdd,
+	0xf7, 0xbd, 0xfe, 0xf2, 0x1f, 0xf7, 0x53, 0x2f, 0x5f, 0x78, 0xf9, 0xcc,
+	0xcb, 0xe7, 0x9f, 0x5f, 0xfa, 0x63, 0x2f, 0xef, 0x3e, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x3d, 0x7b, 0xe7, 0xcd, 0x2f, 0x5e,
+	0xbd, 0xbc, 0x7c, 0xf3, 0xf3, 0x57, 0xff, 0xe1, 0x79, 0xbe, 0xf5, 0x83,
+	0x0f, 0xbf, 0xfc, 0x0b, 0xde, 0x79, 0xfb, 0x75, 0xbf, 0xfe, 0xb9, 0xf7,
+	0xdf, 0xff, 0xa1, 0xff, 0xf1, 0xea, 0x8b, 0xbf, 0xfd, 0xa5, 0x5f, 0xfb,
+	0x6b, 0xbf, 0xfd, 0x4d, 0x6f, 0x3f, 0xb8, 0x3f, 0x7f, 0xf5, 0xfa, 0x79,
+	0x3e, 0xf4, 0x3c, 0x9f, 0xfd, 0x89, 0xe3, 0x73, 0x9f, 0x7e, 0xf9, 0xd8,
+	0xcb, 0x7b, 0x1f, 0x7c, 0xc9, 0xeb, 0x2f, 0x7e, 0xfc, 0xdd, 0xef, 0x7e,
+	0xe6, 0x0b, 0xef, 0xfe, 0xf6, 0xfd, 0xb5, 0x7e, 0xc5, 0x9f, 0xc3, 0xab,
+	0x37, 0x7f, 0xbe, 0xdf, 0xfc, 0x15, 0x7f, 0xee, 0xff, 0x6f, 0xef, 0xf6,
+	0x9d, 0xdf, 0x92, 0x3f, 0xee, 0xd7, 0xa2, 0xdf, 0xe7, 0x5b, 0xe9, 0xeb,
+	0xd2, 0x9b, 0xef, 0xcd, 0x0f, 0x3f, 0xcf, 0xef, 0xf9, 0xe2, 0xf7, 0xff,
+	0xb7, 0x3e, 0xbf, 0x5f, 0x3f, 0xec, 0x52, 0xe0, 0x77, 0x89, 0xf7, 0x7f,
+	0xdd, 0xbf, 0xfe, 0x6a, 0x9f, 0x7e, 0xef, 0x7d, 0xe0, 0xff, 0x5f, 0xdf,
+	0xf2, 0xa5, 0x3f, 0x07, 0x00, 0xbf, 0x9b, 0x7c, 0xe9, 0xdb, 0xfd, 0xd5,
+	0x6f, 0xd1, 0x3b, 0xf8, 0x6b, 0xd9, 0x7f, 0xfb, 0xf8, 0x07, 0x0f, 0xa0,
+	0xdf, 0xf8, 0xd7, 0xff, 0xa1, 0x2f, 0xfe, 0x6f, 0x17, 0xbf, 0xd5, 0xef,
+	0xdb, 0x77, 0xbe, 0xe2, 0xe3, 0x57, 0x26, 0x29, 0xf0, 0xdb, 0xe4, 0xbd,
+	0x7f, 0xf3, 0xfc, 0xc5, 0xf7, 0x7c, 0xf8, 0xc3, 0xbf, 0xf1, 0xe7, 0xbf,
+	0x57, 0x5f, 0xf6, 0xf3, 0xdf, 0x6f, 0xc6, 0xb7, 0xf9, 0xf9, 0x0f, 0xbe,
+	0xa6, 0xfd, 0xa7, 0x37, 0xfb, 0xe7, 0x7b, 0xbe, 0xda, 0xfe, 0x79, 0xfd,
+	0xf2, 0xc7, 0xbf, 0xe4, 0xeb, 0x7e, 0xff, 0xf3, 0x3c, 0x9f, 0x8a, 0x2f,
+	0x7f, 0xe0, 0x79, 0xfe, 0xe0, 0xf3, 0xfc, 0xa1, 0xe7, 0xf9, 0xc3, 0x2f,
+	0x1f, 0xfc, 0xf3, 0xa2, 0x3f, 0xf2, 0x3c, 0x7f, 0xf4, 0x79, 0xfe, 0xd8,
+	0xf3, 0xbc, 0xf9, 0x31, 0x7f, 0xe2, 0xeb, 0x68, 0xff, 0xfc, 0xfb, 0x37,
+	0x3f, 0xff, 0xfd, 0xcf, 0xaf, 0xf6, 0x99, 0x57, 0x2f, 0xff, 0xea, 0x4b,
+	0x3e, 0xfa, 0x93, 0xcf, 0xf3, 0xa7, 0x9e, 0xe7, 0x4f, 0x3f, 0xcf, 0x9f,
+	0x79, 0x9e, 0x3f, 0xfb, 0xf6, 0xcf, 0xfd, 0xcf, 0x3d, 0xcf, 0xb7, 0x3f,
+	0xcf, 0x9f, 0x7f, 0x9e, 0xbf, 0xf0, 0x3c, 0xdf, 0xf1, 0x3c, 0xdf, 0xf9,
+	0x3c, 0x7f, 0xd1, 0xfe, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x87, 0xbd,
+	0xf9, 0x67, 0x3c, 0xdf, 0xfc, 0xf2, 0xea, 0xf5, 0x47, 0x7e, 0xfd, 0xb7,
+	0x5f, 0xbf, 0xfe, 0xc8, 0x47, 0x3e, 0xf8, 0x77, 0xf8, 0xbf, 0xf5, 0xe5,
+	0x1b, 0x5f, 0x7f, 0xf6, 0x27, 0xbf, 0xf0, 0xee, 0x77, 0xfd, 0xf3, 0x9f,
+	0xfc, 0xa9, 0xcf, 0x7d, 0xfa, 0x83, 0x7f, 0x57, 0xfe, 0xbf, 0x7c, 0xe8,
+	0xf7, 0xbe, 0x7a, 0xf3, 0x6f, 0xed, 0x7f, 0xe4, 0xdd, 0x7f, 0xf9, 0xae,
+	0xdb, 0x83, 0xaf, 0x6f, 0xdf, 0xf4, 0x15, 0xdf, 0xff, 0xbf, 0xfa, 0xa1,
+	0x0f, 0xbe, 0xff, 0x81, 0xdf, 0x25, 0xfc, 0x27, 0x3f, 0xe0, 0xfb, 0x1f,
+	0xf0, 0xfd, 0x0f, 0xf8, 0xfe, 0x07, 0x7c, 0xff, 0x03, 0xbe, 0xff, 0x01,
+	0xdf, 0xff, 0x80, 0xef, 0x7f, 0xc0, 0xf7, 0x3f, 0xe0, 0xfb, 0x1f, 0xf0,
+	0xfd, 0x0f, 0x00, 0x7c, 0x4d, 0xfb, 0x62, 0x13, 0xe7, 0x9d, 0x2f, 0xbc,
+	0xfb, 0x93, 0x9f, 0xff, 0xb1, 0x7f, 0xf1, 0x99, 0x77, 0xde, 0xfc, 0x97,
+	0x7d, 0xef, 0x7c, 0xf6, 0xc7, 0x3f, 0xf7, 0x99, 0x77, 0xbe, 0xe7, 0x8d,
+	0x6f, 0xac, 0xcf, 0x2e, 0x3f, 0x7b, 0xe4, 0x67, 0x4f, 0xf9, 0xd9, 0x73,
+	0x7e, 0xf6, 0x92, 0x9f, 0xbd, 0xe6, 0x67, 0x6f, 0xf9, 0xd9, 0x7b, 0x7e,
+	0xf6, 0x51, 0x9f, 0x5d, 0xde, 0xd5, 0xf2, 0xae, 0x96, 0x77, 0xb5, 0xbc,
+	0xab, 0xe5, 0x5d, 0x2d, 0xef, 0x6a, 0x79, 0x57, 0xcb, 0xbb, 0x5a, 0xde,
+	0xd5, 0xf2, 0xae, 0x8e, 0xbc, 0xab, 0x23, 0xef, 0xea, 0xc8, 0xbb, 0x3a,
+	0xf2, 0xae, 0x8e, 0xbc, 0xab, 0x23, 0xef, 0xea, 0xc8, 0xbb, 0x3a, 0xf2,
+	0xae, 0x8e, 0xbc, 0xab, 0x23, 0xef, 0xea, 0x94, 0x77, 0x75, 0xca, 0xbb,
+	0x3a, 0xe5, 0x5d, 0x9d, 0xf2, 0xae, 0x4e, 0x79, 0x57, 0xa7, 0xbc, 0xab,
+	0x53, 0xde, 0xd5, 0x29, 0xef, 0xea, 0x94, 0x77, 0x75, 0xca, 0xbb, 0x3a,
+	0xe7, 0x5d, 0x9d, 0xf3, 0xae, 0xce, 0x79, 0x57, 0xe7, 0xbc, 0xab, 0x73,
+	0xde, 0xd5, 0x39, 0xef, 0xea, 0x9c, 0x77, 0x75, 0xce, 0xbb, 0x3a, 0xe7,
+	0x5d, 0x9d, 0xf3, 0xae, 0x2e, 0x79, 0x57, 0x97, 0xbc, 0xab, 0x4b, 0xde,
+	0xd5, 0x25, 0xef, 0xea, 0x92, 0x77, 0x75, 0xc9, 0xbb, 0xba, 0xe4, 0x5d,
+	0x5d, 0xf2, 0xae, 0x2e, 0x79, 0x57, 0x97, 0xbc, 0xab, 0x6b, 0xde, 0xd5,
+	0x35, 0xef, 0xea, 0x9a, 0x77, 0x75, 0xcd, 0xbb, 0xba, 0xe6, 0x5d, 0x5d,
+	0xf3, 0xae, 0xae, 0x79, 0x57, 0xd7, 0xbc, 0xab, 0x6b, 0xde, 0xd5, 0x35,
+	0xef, 0xea, 0x96, 0x77, 0x75, 0xcb, 0xbb, 0xba, 0xe5, 0x5d, 0xdd, 0xf2,
+	0xae, 0x6e, 0x79, 0x57, 0xb7, 0xbc, 0xab, 0x5b, 0xde, 0xd5, 0x2d, 0xef,
+	0xea, 0x96, 0x77, 0x75, 0xcb, 0xbb, 0xba, 0xe7, 0x5d, 0xdd, 0xf3, 0xae,
+	0xee, 0x79, 0x57, 0xf7, 0xbc, 0xab, 0x7b, 0xde, 0xd5, 0x3d, 0xef, 0xea,
+	0x9e, 0x77, 0x75, 0xcf, 0xbb, 0xba, 0xe7, 0x5d, 0xdd, 0xf3, 0xae, 0x1e,
+	0x79, 0x57, 0x8f, 0xbc, 0xab, 0x47, 0xde, 0xd5, 0x23, 0xef, 0xea, 0x91,
+	0x77, 0xf5, 0xc8, 0xbb, 0x7a, 0xe4, 0x5d, 0x3d, 0xf2, 0xae, 0x1e, 0x79,
+	0x57, 0x8f, 0xba, 0xab, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f,
+	0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6,
+	0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e,
+	0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee,
+	0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5,
+	0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f,
+	0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6,
+	0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e,
+	0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee,
+	0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5,
+	0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f,
+	0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6,
+	0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e,
+	0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee,
+	0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5,
+	0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f,
+	0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6,
+	0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e,
+	0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee,
+	0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5,
+	0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f, 0xee, 0xf6, 0xe5, 0x6e, 0x5f,
+	0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4,
+	0x6e, 0x3f, 0x72, 0xb7, 0x1f, 0xb9, 0xdb, 0x8f, 0xdc, 0xed, 0x47, 0xee,
+	0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4, 0x6e,
+	0x3f, 0x72, 0xb7, 0x1f, 0xb9, 0xdb, 0x8f, 0xdc, 0xed, 0x47, 0xee, 0xf6,
+	0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4, 0x6e, 0x3f,
+	0x72, 0xb7, 0x1f, 0xb9, 0xdb, 0x8f, 0xdc, 0xed, 0x47, 0xee, 0xf6, 0x23,
+	0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4, 0x6e, 0x3f, 0x72,
+	0xb7, 0x1f, 0xb9, 0xdb, 0x8f, 0xdc, 0xed, 0x47, 0xee, 0xf6, 0x23, 0x77,
+	0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4, 0x6e, 0x3f, 0x72, 0xb7,
+	0x1f, 0xb9, 0xdb, 0x8f, 0xdc, 0xed, 0x47, 0xee, 0xf6, 0x23, 0x77, 0xfb,
+	0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4, 0x6e, 0x3f, 0x72, 0xb7, 0x1f,
+	0xb9, 0xdb, 0x8f, 0xdc, 0xed, 0x47, 0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91,
+	0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4, 0x6e, 0x3f, 0x72, 0xb7, 0x1f, 0xb9,
+	0xdb, 0x8f, 0xdc, 0xed, 0x47, 0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb,
+	0xfd, 0xc8, 0xdd, 0x7e, 0xe4, 0x6e, 0x3f, 0x72, 0xb7, 0x1f, 0xb9, 0xdb,
+	0x8f, 0xdc, 0xed, 0x47, 0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd,
+	0xc8, 0xdd, 0x7e, 0xe4, 0x6e, 0x3f, 0x72, 0xb7, 0x1f, 0xb9, 0xdb, 0x8f,
+	0xdc, 0xed, 0x47, 0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8,
+	0xdd, 0x7e, 0xe4, 0x6e, 0x3f, 0x72, 0xb7, 0x1f, 0xb9, 0xdb, 0x8f, 0xdc,
+	0xed, 0x47, 0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd,
+	0x7e, 0xe4, 0x6e, 0x3f, 0x72, 0xb7, 0x1f, 0xb9, 0xdb, 0x8f, 0xdc, 0xed,
+	0x47, 0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e,
+	0xe4, 0x6e, 0x3f, 0x72, 0xb7, 0x1f, 0xb9, 0xdb, 0x8f, 0xdc, 0xed, 0x47,
+	0xee, 0xf6, 0x23, 0x77, 0xfb, 0x91, 0xbb, 0xfd, 0xc8, 0xdd, 0x7e, 0xe4,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5, 0x6e, 0x3f, 0xe5,
+	0x6e, 0x3f, 0xe7, 0x6e, 0x3f, 0xe7, 0x6e, 0x3f, 0xe7, 0x6e, 0x3f, 0xe7,
+	0x6e, 0x3f, 0xe7, 0x6e, 0x3f, 0xe7, 0x6e, 0x3f, 0xe7, 0x6e, 0x3f, 0xe7,
+	0x6e, 0x3f, 0x7f, 0xd5, 0xdd, 0xfe, 0x97, 0x5e, 0x5e, 0x5e, 0xfe, 0xf2,
+	0xf3, 0xfc, 0x95, 0xe7, 0xf9, 0xae, 0xe7, 0xf9, 0xab, 0xcf, 0xf3, 0xdd,
+	0xcf, 0xf3, 0x26, 0x01, 0xf2, 0xd7, 0x5e, 0xbe, 0x98, 0x86, 0x7f, 0xd9,
+	0xf3, 0x1c, 0xcf, 0x73, 0x7a, 0x9e, 0xf3, 0xf3, 0x5c, 0x9e, 0xe7, 0xfa,
+	0x3c, 0xb7, 0xe7, 0xb9, 0x3f, 0xcf, 0xe3, 0x79, 0xfe, 0xfa, 0xf3, 0x7c,
+	0xef, 0xf3, 0xfc, 0x8d, 0xe7, 0xf9, 0xe8, 0xf3, 0xfc, 0xcd, 0xe7, 0xf9,
+	0xbe, 0xe7, 0xf9, 0xd8, 0xf3, 0xbc, 0x49, 0xcc, 0xff, 0xad, 0xe7, 0xf9,
+	0xdb, 0xcf, 0xf3, 0x77, 0x9e, 0xe7, 0xfb, 0x9f, 0xe7, 0x07, 0x9e, 0xe7,
+	0x13, 0xcf, 0xf3, 0x77, 0x9f, 0xe7, 0x07, 0x9f, 0xe7, 0xef, 0x3d, 0xcf,
+	0xdf, 0x7f, 0x9e, 0x7f, 0xf0, 0x3c, 0xff, 0xf0, 0x79, 0xfe, 0xd1, 0xf3,
+	0xfc, 0xe3, 0xe7, 0xf9, 0xe4, 0xf3, 0xfc, 0x93, 0xe7, 0xf9, 0xd4, 0xf3,
+	0xfc, 0xd0, 0xf3, 0xfc, 0xf0, 0xf3, 0xfc, 0xc8, 0xf3, 0xfc, 0xd3, 0xe7,
+	0xf9, 0x67, 0xfe, 0xf3, 0x0d, 0xf8, 0xbf, 0xf2, 0xbf, 0x7f, 0x76, 0xc8,
+	0x9f, 0x2b, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7,
+	0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed,
+	0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf,
+	0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39,
+	0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb,
+	0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77,
+	0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce,
+	0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e,
+	0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd,
+	0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3,
+	0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f,
+	0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7,
+	0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c,
+	0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7,
+	0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed,
+	0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf,
+	0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39,
+	0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb,
+	0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce, 0x77,
+	0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e, 0xce,
+	0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd, 0x7e,
+	0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3, 0xdd,
+	0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f, 0xf3,
+	0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x39, 0xdf, 0xed, 0xe7, 0x7c, 0xb7, 0x9f,
+	0xf3, 0xdd, 0x7e, 0xce, 0x77, 0xfb, 0x25, 0xdf, 0xed, 0x97, 0x7c, 0xb7,
+	0x5f, 0xf2, 0xdd, 0x7e, 0xc9, 0x77, 0xfb, 0x25, 0xdf, 0xed, 0x97, 0x7c,
+	0xb7, 0x5f, 0xf2, 0xdd, 0x7e, 0xc9, 0x77, 0xfb, 0x25, 0xff, 0x79, 0xdb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb,
+	0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x25, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb,
+	0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x35, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb,
+	0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x2d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb,
+	0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x3d, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb,
+	0x23, 0x77, 0xfb, 0x23, 0x77, 0xfb, 0xa3, 0x76, 0xfb, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb,
+	0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e,
+	0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2,
+	0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2,
+	0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97,
+	0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc,
+	0xec, 0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec,
+	0x25, 0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25,
+	0x2f, 0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f,
+	0x7b, 0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b,
+	0xc9, 0xcb, 0x5e, 0xf2, 0xb2, 0x97, 0xbc, 0xec, 0x25, 0x2f, 0x7b, 0xc9,
+	0xcb, 0x5e, 0xf2, 0xce, 0xb9, 0xdb, 0xb3, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb,
+	0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e,
+	0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea,
+	0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2,
+	0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97,
+	0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba,
+	0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec,
+	0xa5, 0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5,
+	0x2e, 0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e,
+	0x7b, 0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b,
+	0xa9, 0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9,
+	0xcb, 0x5e, 0xea, 0xb2, 0x97, 0xba, 0xec, 0xa5, 0x2e, 0x7b, 0xa9, 0x47,
+	0xf6, 0x52, 0x8f, 0xec, 0xa5, 0x1e, 0xd9, 0x4b, 0x3d, 0xb2, 0x97, 0x7a,
+	0x64, 0x2f, 0xf5, 0xc8, 0x5e, 0xea, 0x91, 0xbd, 0xd4, 0x23, 0x7b, 0xa9,
+	0x47, 0xf6, 0x52, 0x8f, 0xec, 0xa5, 0x1e, 0xd9, 0x4b, 0x3d, 0xb2, 0x97,
+	0x7a, 0x64, 0x2f, 0xf5, 0xc8, 0x5e, 0xea, 0x91, 0xbd, 0xd4, 0x23, 0x7b,
+	0xa9, 0x47, 0xf6, 0x52, 0x8f, 0xec, 0xa5, 0x1e, 0xd9, 0x4b, 0x3d, 0xb2,
+	0x97, 0x7a, 0x64, 0x2f, 0xf5, 0xc8, 0x5e, 0xea, 0x91, 0xbd, 0xd4, 0x23,
+	0x7b, 0xa9, 0x47, 0xf6, 0x52, 0x8f, 0xec, 0xa5, 0x1e, 0xd9, 0x4b, 0x3d,
+	0xb2, 0x97, 0x7a, 0x64, 0x2f, 0xf5, 0xc8, 0x5e, 0xea, 0x91, 0xbd, 0xd4,
+	0x23, 0x7b, 0xa9, 0x47, 0xf6, 0x52, 0x8f, 0xec, 0xa5, 0x1e, 0xd9, 0x4b,
+	0x3d, 0xb2, 0x97, 0x7a, 0x64, 0x2f, 0xf5, 0xc8, 0x5e, 0xea, 0x91, 0xbd,
+	0xd4, 0x23, 0x7b, 0xa9, 0x47, 0xf6, 0x52, 0x8f, 0xec, 0xa5, 0x1e, 0xd9,
+	0x4b, 0x3d, 0xb2, 0x97, 0x7a, 0x64, 0x2f, 0xf5, 0xc8, 0x5e, 0xea, 0x91,
+	0xbd, 0xd4, 0xe3, 0x4d, 0x2f, 0xf5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e,
+	0x07, 0xfd, 0xc2, 0x47, 0x7f, 0xf1, 0x5b, 0x7e, 0xf6, 0xe7, 0x3e, 0xff,
+	0x89, 0x9f, 0xff, 0xe9, 0x8f, 0xfe, 0xf8, 0x2f, 0x7d, 0xe2, 0x67, 0x7e,
+	0xe5, 0x73, 0xc7, 0x4f, 0x7c, 0xf6, 0xe5, 0xd3, 0x2f, 0x1f, 0x7b, 0xef,
+	0x83, 0x4f, 0xbf, 0xfe, 0xd8, 0xdb, 0xaf, 0xfb, 0xbe, 0xd7, 0x5f, 0xfe,
+	0xe3, 0x7e, 0xea, 0xe5, 0x0b, 0x2f, 0x9f, 0x79, 0xf9, 0xfc, 0xf3, 0x4b,
+	0x7f, 0xec, 0xe5, 0xdd, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xf3, 0xbe,
+	0xff, 0x07, 0x7e, 0xf0, 0x9d, 0x4f, 0x7e, 0xfc, 0x53, 0x3f, 0xfc, 0xf2,
+	0xf2, 0xea, 0xe5, 0x47, 0x9f, 0x1f, 0xff, 0xe7, 0xf3, 0xbf, 0xfd, 0xde,
+	0x37, 0xbf, 0xff, 0xfd, 0x6f, 0xf8, 0xe0, 0xf3, 0xaf, 0xde, 0x7e, 0xdd,
+	0xb7, 0xbf, 0xfd, 0xf5, 0x2f, 0xbf, 0xfd, 0xfd, 0x5f, 0xf1, 0xff, 0x13,
+	0xf0, 0xea, 0xbf, 0xbe, 0xfd, 0xfd, 0xef, 0xbd, 0x3d, 0xdf, 0xf9, 0x1d,
+	0x8f, 0x8f, 0xbb, 0xdd, 0xaf, 0x7d, 0xff, 0x0b, 0xf3, 0x71, 0xd2, 0xdc,
+	0x00, 0x00, 0x10, 0x00,
+};
@@ -31,6 +31,17 @@
 STATIC_COMMAND_START
 STATIC_COMMAND("printf_tests", NULL, (console_cmd)&printf_tests)
 STATIC_COMMAND("thread_tests", NULL, (console_cmd)&thread_tests)
+STATIC_COMMAND("sha_tests", NULL, (console_cmd)&sha_tests)
+#if WITH_LIB_WORKPOOL
+STATIC_COMMAND("workpool_tests", NULL, (console_cmd)&workpool_tests)
+#endif
+#if WITH_LIB_BIO && WITH_LIB_BCACHE && WITH_LIB_PARTITION && \
+    WITH_LIB_FS_EXT2 && WITH_LIB_ZLIB_INFLATE
+STATIC_COMMAND("storage_tests", NULL, (console_cmd)&storage_tests)
+#endif
+#if DEVICE_TREE && WITH_APP_ABOOT
+STATIC_COMMAND("dtb_tests", NULL, (console_cmd)&dtb_tests)
+#endif
 STATIC_COMMAND_END(tests);
 
 #endif
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <app/tests.h>
+#include <debug.h>
+#include <lib/workpool.h>
+#include <malloc.h>
+#include <platform.h>
+
+#if WITH_LIB_WORKPOOL
+
+#define WORKPOOL_TEST_JOBS	16
+#define WORKPOOL_TEST_WORDS	(64 * 1024)
+
+struct workpool_test_job {
+	struct work work;
+	uint32_t *buf;
+	uint32_t seed;
+	uint32_t sum;
+};
+
+static void workpool_test_fill(void *arg)
+{
+	struct workpool_test_job *job = arg;
+	uint32_t i, sum = 0;
+
+	for (i = 0; i < WORKPOOL_TEST_WORDS; i++) {
+		job->buf[i] = job->seed * (i + 1);
+		sum += job->buf[i];
+	}
+	job->sum = sum;
+}
+
+int workpool_tests(void)
+{
+	struct workpool_test_job *jobs;
+	uint32_t i, j, sum;
+	time_t start;
+	int ret = 0;
+
+	jobs = calloc(WORKPOOL_TEST_JOBS, sizeof(*jobs));
+	if (!jobs)
+		return -1;
+
+	printf("workpool tests: %d worker CPUs online\n", workpool_num_workers());
+
+	for (i = 0; i < WORKPOOL_TEST_JOBS; i++) {
+		jobs[i].buf = malloc(WORKPOOL_TEST_WORDS * sizeof(uint32_t));
+		if (!jobs[i].buf) {
+			ret = -1;
+			goto out;
+		}
+		jobs[i].seed = i + 1;
+		work_init(&jobs[i].work, workpool_test_fill, &jobs[i]);
+	}
+
+	start = current_time();
+	for (i = 0; i < WORKPOOL_TEST_JOBS; i++)
+		work_queue(&jobs[i].work);
+	for (i = 0; i < WORKPOOL_TEST_JOBS; i++)
+		work_wait(&jobs[i].work);
+	printf("workpool tests: %d jobs done in %lu ms\n", WORKPOOL_TEST_JOBS,
+	       current_time() - start);
+
+	/* Check the results on this CPU */
+	for (i = 0; i < WORKPOOL_TEST_JOBS; i++) {
+		sum = 0;
+		for (j = 0; j < WORKPOOL_TEST_WORDS; j++) {
+			if (jobs[i].buf[j] != jobs[i].seed * (j + 1)) {
+				printf("workpool tests: job %u: bad word %u\n", i, j);
+				ret = -1;
+				break;
+			}
+			sum += jobs[i].buf[j];
+		}
+		if (sum != jobs[i].sum) {
+			printf("workpool tests: job %u: bad sum %x != %x\n",
+			       i, jobs[i].sum, sum);
+			ret = -1;
+		}
+	}
+
+	printf("workpool tests: %s\n", ret ? "FAILED" : "passed");
+out:
+	for (i = 0; i < WORKPOOL_TEST_JOBS; i++)
+		free(jobs[i].buf);
+	free(jobs);
+	return ret;
+}
+
+#endif
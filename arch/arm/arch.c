@@ -83,3 +83,11 @@ void arch_init(void)
 {
 }
 
+/* set by arm_irq for the duration of platform_irq() */
+struct arm_iframe *arm_irq_frame;
+
+addr_t arch_irq_pc(void)
+{
+	return arm_irq_frame ? arm_irq_frame->pc : 0;
+}
+
@@ -23,8 +23,20 @@
 #ifndef __ARM_ARCH_THREAD_H
 #define __ARM_ARCH_THREAD_H
 
+#if ARM_WITH_NEON
+/* VFP/NEON registers, kept in sync with arm_neon_save() in asm.S */
+struct arm_neon_state {
+	uint32_t fpscr;
+	uint32_t pad;
+	uint64_t d[32];
+};
+#endif
+
 struct arch_thread {
 	vaddr_t sp;
+#if ARM_WITH_NEON
+	struct arm_neon_state neon;
+#endif
 };
 
 #endif
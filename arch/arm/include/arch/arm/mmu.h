@@ -48,6 +48,7 @@ void arm_mmu_init(void);
 #define MMU_MEMORY_AP_READ_WRITE    (0x3 << 10)
 
 #define MMU_MEMORY_XN               (0x1 << 4)
+#define MMU_MEMORY_SHAREABLE        (0x1 << 16)
 
 #else
 
@@ -56,6 +57,8 @@ void arm_mmu_init(void);
 #endif
 
 void arm_mmu_map_section(addr_t paddr, addr_t vaddr, uint flags);
+void arm_mmu_map_range(addr_t paddr, addr_t vaddr, size_t size, uint flags);
+void arm_mmu_unmap_range(addr_t vaddr, size_t size);
 void arm_mmu_flush(void);
 
 
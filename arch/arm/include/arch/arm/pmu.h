@@ -0,0 +1,23 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef __ARCH_ARM_PMU_H
+#define __ARCH_ARM_PMU_H
+
+#include <sys/types.h>
+
+/* ARMv7 PMU common event numbers, unsupported events just count nothing */
+#define ARM_PMU_EVT_L1D_REFILL		0x03
+#define ARM_PMU_EVT_L1D_ACCESS		0x04
+#define ARM_PMU_EVT_INST_RETIRED	0x08
+#define ARM_PMU_EVT_L2D_ACCESS		0x16
+#define ARM_PMU_EVT_L2D_REFILL		0x17
+
+/*
+ * The cycle counter is enabled in arch_early_init() and read with
+ * arch_cycle_count(). These manage the additional event counters.
+ */
+unsigned arm_pmu_num_counters(void);
+void arm_pmu_set_event(unsigned counter, unsigned event);
+uint32_t arm_pmu_read_counter(unsigned counter);
+void arm_pmu_reset_counters(void);
+
+#endif
@@ -25,8 +25,10 @@
 #include <compiler.h>
 #include <arch.h>
 #include <arch/arm.h>
+#include <arch/ops.h>
 #include <arch/defines.h>
 #include <arch/arm/mmu.h>
+#include <stdlib.h>
 
 #if ARM_WITH_MMU
 
@@ -43,6 +45,36 @@ static uint32_t *tt = (void *)MMU_TRANSLATION_TABLE_ADDR;
 static uint32_t tt[4096] __ALIGNED(16384);
 #endif
 
+/* Section attributes that have an equivalent in small page descriptors */
+#define MMU_SECTION_ATTR_MASK	((0x3 << 2) | (0x1 << 4) | (0x3 << 10) | \
+				 (0x7 << 12) | (0x1 << 15) | (0x1 << 16))
+
+#define MMU_L2_ENTRIES		(MB / PAGE_SIZE)
+
+/* second level (coarse) tables for mappings that are not 1MB aligned */
+#ifndef MMU_L2_TABLES
+#define MMU_L2_TABLES		8
+#endif
+static uint32_t l2_tables[MMU_L2_TABLES][MMU_L2_ENTRIES] __ALIGNED(1024);
+static uint l2_tables_used;
+
+/* TLB maintenance is deferred while the table is built in arm_mmu_init() */
+static bool mmu_batch;
+
+/*
+ * With ARM_MMU_SHAREABLE other CPU cores use the same translation table,
+ * so normal memory (C bit or TEX[2:0] = 001) is mapped shareable to keep
+ * the caches coherent. It is set when an entry is written.
+ */
+static uint arm_mmu_section_flags(uint flags)
+{
+#if ARM_MMU_SHAREABLE
+	if ((flags & (1<<3)) || ((flags >> 12) & 0x7) == 1)
+		flags |= MMU_MEMORY_SHAREABLE;
+#endif
+	return flags;
+}
+
 void arm_mmu_map_section(addr_t paddr, addr_t vaddr, uint flags)
 {
 	int index;
@@ -55,9 +87,145 @@ void arm_mmu_map_section(addr_t paddr, addr_t vaddr, uint flags)
 	 * (0<<5): Domain = 0
 	 *  flags: TEX, CB and AP bit settings provided by the caller.
 	 */
-	tt[index] = (paddr & ~(MB-1)) | (0<<5) | (2<<0) | flags;
+	tt[index] = (paddr & ~(MB-1)) | (0<<5) | (2<<0) | arm_mmu_section_flags(flags);
 
+	if (!mmu_batch)
+		arm_invalidate_tlb();
+}
+
+/* Convert section attributes (TEX, C, B, AP, XN, S) to small page format */
+static uint32_t arm_mmu_page_flags(uint flags)
+{
+	return (flags & (0x3 << 2)) |			/* C, B */
+	       ((flags >> 4) & 0x1) |			/* XN */
+	       (((flags >> 10) & 0x3) << 4) |		/* AP[1:0] */
+	       (((flags >> 12) & 0x7) << 6) |		/* TEX[2:0] */
+	       (((flags >> 15) & 0x1) << 9) |		/* AP[2] */
+	       (((flags >> 16) & 0x1) << 10);		/* S */
+}
+
+/* Get the second level table for vaddr, splitting up an existing section */
+static uint32_t *arm_mmu_get_l2_table(addr_t vaddr)
+{
+	uint32_t entry = tt[vaddr / MB];
+	uint32_t *l2;
+	uint i;
+
+	if ((entry & 0x3) == 1)
+		return (uint32_t *)(entry & ~0x3ff);
+
+	if (l2_tables_used == MMU_L2_TABLES) {
+		dprintf(CRITICAL, "mmu: out of second level tables for 0x%lx\n", vaddr);
+		return NULL;
+	}
+
+	l2 = l2_tables[l2_tables_used++];
+	for (i = 0; i < MMU_L2_ENTRIES; i++) {
+		if ((entry & 0x3) == 2)
+			l2[i] = ((entry & ~(MB-1)) + i * PAGE_SIZE) | (1<<1) |
+				arm_mmu_page_flags(entry & MMU_SECTION_ATTR_MASK);
+		else
+			l2[i] = 0;
+	}
+
+	/* the table walk must see the new table before the entry pointing to it */
+	if (!mmu_batch) {
+		arch_clean_cache_range((addr_t)l2, sizeof(l2_tables[0]));
+		dsb();
+	}
+
+	/* (1<<0): Page table entry, Domain = 0 */
+	tt[vaddr / MB] = (uint32_t)l2 | (0<<5) | (1<<0);
+	return l2;
+}
+
+/*
+ * Write the entries for a range. When unmapping a live range, the data
+ * cached through each entry is cleaned while it is still mapped, so no
+ * dirty lines with the old attributes are left behind.
+ */
+static void arm_mmu_set_range(addr_t paddr, addr_t vaddr, size_t size,
+			      uint flags, bool map)
+{
+	uint32_t *pte, entry;
+	uint32_t *l2;
+	size_t step;
+
+	flags = arm_mmu_section_flags(flags);
+	size = ROUNDUP(size + (vaddr & (PAGE_SIZE-1)), PAGE_SIZE);
+	paddr = ROUNDDOWN(paddr, PAGE_SIZE);
+	vaddr = ROUNDDOWN(vaddr, PAGE_SIZE);
+
+	while (size) {
+		pte = NULL;
+		if (!map && !tt[vaddr / MB]) {
+			/* nothing mapped, don't split up anything */
+			step = MIN(size, MB - (vaddr & (MB-1)));
+		} else if (!(vaddr & (MB-1)) && !(paddr & (MB-1)) && size >= MB &&
+		    (map || (tt[vaddr / MB] & 0x3) != 1)) {
+			pte = &tt[vaddr / MB];
+			entry = paddr | (0<<5) | (2<<0) | flags;
+			step = MB;
+		} else {
+			l2 = arm_mmu_get_l2_table(vaddr);
+			if (!l2)
+				return;
+			pte = &l2[(vaddr & (MB-1)) / PAGE_SIZE];
+			entry = paddr | (1<<1) | arm_mmu_page_flags(flags);
+			step = PAGE_SIZE;
+		}
+
+		if (pte && map) {
+			*pte = entry;
+		} else if (pte && *pte) {
+			if (!mmu_batch)
+				arch_clean_invalidate_cache_range(vaddr, step);
+			*pte = 0;
+		}
+
+		paddr += step;
+		vaddr += step;
+		size -= step;
+	}
+}
+
+static void arm_mmu_sync(void)
+{
+	if (mmu_batch)
+		return;
+
+	arm_mmu_flush();
+#if ARM_MMU_SHAREABLE
+	/* TLBIALLIS, the other cores walk the same table */
+	__asm__ volatile("mcr p15, 0, %0, c8, c3, 0" :: "r" (0));
+#else
 	arm_invalidate_tlb();
+#endif
+	dsb();
+	isb();
+}
+
+/*
+ * Map a range with the given section flags, using 1MB sections where
+ * possible and small pages for unaligned parts. A range that is already
+ * live goes through break-before-make: the old entries are removed and
+ * the TLB invalidated before the new attributes are written.
+ */
+void arm_mmu_map_range(addr_t paddr, addr_t vaddr, size_t size, uint flags)
+{
+	if (!mmu_batch) {
+		arm_mmu_set_range(paddr, vaddr, size, 0, false);
+		arm_mmu_sync();
+	}
+
+	arm_mmu_set_range(paddr, vaddr, size, flags, true);
+	arm_mmu_sync();
+}
+
+void arm_mmu_unmap_range(addr_t vaddr, size_t size)
+{
+	arm_mmu_set_range(vaddr, vaddr, size, 0, false);
+	arm_mmu_sync();
 }
 
 void arm_mmu_init(void)
@@ -69,6 +237,9 @@ void arm_mmu_init(void)
 	 */
 	arm_write_cr1(arm_read_cr1() & ~((1<<29)|(1<<28)|(1<<0)));
 
+	/* the mmu is off, do TLB maintenance once the table is complete */
+	mmu_batch = true;
+
 	if (platform_use_identity_mmu_mappings())
 	{
 		/* set up an identity-mapped translation table with
@@ -83,6 +254,9 @@ void arm_mmu_init(void)
 
 	platform_init_mmu_mappings();
 
+	mmu_batch = false;
+	arm_mmu_sync();
+
 	/* set up the translation table base */
 	arm_write_ttbr((uint32_t)tt);
 
@@ -95,7 +269,10 @@ void arm_mmu_init(void)
 
 void arm_mmu_flush(void)
 {
-	arch_clean_cache_range((vaddr_t) &tt, sizeof(tt));
+	arch_clean_cache_range((vaddr_t) tt, 4096 * sizeof(uint32_t));
+	if (l2_tables_used)
+		arch_clean_cache_range((vaddr_t) l2_tables,
+				       l2_tables_used * sizeof(l2_tables[0]));
 	dsb();
 	isb();
 }
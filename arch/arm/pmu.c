@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <arch/arm/pmu.h>
+
+#if ARM_CPU_CORTEX_A8
+static void arm_pmu_select(unsigned counter)
+{
+	__asm__ volatile("mcr	p15, 0, %0, c9, c12, 5" :: "r" (counter));
+	__asm__ volatile("isb");
+}
+
+unsigned arm_pmu_num_counters(void)
+{
+	uint32_t pmcr;
+
+	__asm__ volatile("mrc	p15, 0, %0, c9, c12, 0" : "=r" (pmcr));
+	return (pmcr >> 11) & 0x1f;
+}
+
+void arm_pmu_set_event(unsigned counter, unsigned event)
+{
+	if (counter >= arm_pmu_num_counters())
+		return;
+
+	arm_pmu_select(counter);
+	__asm__ volatile("mcr	p15, 0, %0, c9, c13, 1" :: "r" (event));
+	__asm__ volatile("mcr	p15, 0, %0, c9, c12, 1" :: "r" (1 << counter));
+}
+
+uint32_t arm_pmu_read_counter(unsigned counter)
+{
+	uint32_t val;
+
+	if (counter >= arm_pmu_num_counters())
+		return 0;
+
+	arm_pmu_select(counter);
+	__asm__ volatile("mrc	p15, 0, %0, c9, c13, 2" : "=r" (val));
+	return val;
+}
+
+/* Reset the event counters, the cycle counter keeps running */
+void arm_pmu_reset_counters(void)
+{
+	uint32_t pmcr;
+
+	__asm__ volatile("mrc	p15, 0, %0, c9, c12, 0" : "=r" (pmcr));
+	__asm__ volatile("mcr	p15, 0, %0, c9, c12, 0" :: "r" (pmcr | (1 << 1)));
+}
+#else
+unsigned arm_pmu_num_counters(void)
+{
+	return 0;
+}
+
+void arm_pmu_set_event(unsigned counter, unsigned event)
+{
+}
+
+uint32_t arm_pmu_read_counter(unsigned counter)
+{
+	return 0;
+}
+
+void arm_pmu_reset_counters(void)
+{
+}
+#endif
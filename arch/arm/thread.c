@@ -42,6 +42,10 @@ struct context_switch_frame {
 };
 
 extern void arm_context_switch(addr_t *old_sp, addr_t new_sp);
+#if ARM_WITH_NEON
+extern void arm_neon_save(struct arm_neon_state *state);
+extern void arm_neon_restore(const struct arm_neon_state *state);
+#endif
 
 static void initial_thread_func(void) __NO_RETURN;
 static void initial_thread_func(void)
@@ -83,6 +87,11 @@ void arch_thread_initialize(thread_t *t)
 void arch_context_switch(thread_t *oldthread, thread_t *newthread)
 {
 //	dprintf("arch_context_switch: old %p (%s), new %p (%s)\n", oldthread, oldthread->name, newthread, newthread->name);
+#if ARM_WITH_NEON
+	/* threads can be preempted in the middle of NEON code (SHA, rgb888_swap) */
+	arm_neon_save(&oldthread->arch.neon);
+	arm_neon_restore(&newthread->arch.neon);
+#endif
 	arm_context_switch(&oldthread->arch.sp, newthread->arch.sp);
 }
 
@@ -68,3 +68,8 @@ uint32_t arch_cycle_count(void)
 	return timestamp;
 }
 
+addr_t arch_irq_pc(void)
+{
+	/* the interrupt frame is not tracked on x86 */
+	return 0;
+}
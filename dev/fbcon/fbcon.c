@@ -210,15 +210,20 @@ void fbcon_draw_msg_background(unsigned y_start, unsigned y_end,
 	}
 }
 
-static void fbcon_flush(void)
+static void fbcon_update(void)
 {
-	unsigned total_x, total_y;
-	unsigned bytes_per_bpp;
-
 	if (config->update_start)
 		config->update_start();
 	if (config->update_done)
 		while (!config->update_done());
+}
+
+static void fbcon_flush(void)
+{
+	unsigned total_x, total_y;
+	unsigned bytes_per_bpp;
+
+	fbcon_update();
 
 	total_x = config->width;
 	total_y = config->height;
@@ -426,66 +431,194 @@ struct fbcon_config* fbcon_display(void)
 	return config;
 }
 
-void fbcon_extract_to_screen(logo_img_header *header, void* address)
+/* Length of the run starting with the run byte "run", including it */
+static unsigned splash_run_len(uint8_t run)
+{
+	return 1 + 3 * ((run & 0x80) ? 1 : (run & 0x7f) + 1);
+}
+
+/* The logo is stored in framebuffer byte order: blue, green, red */
+static uint32_t splash_pixel(const uint8_t *p, unsigned bytes_pp)
+{
+	if (bytes_pp == 2)
+		return (p[2] >> 3) << 11 | (p[1] >> 2) << 5 | p[0] >> 3;
+
+	return 0xff000000 | p[2] << 16 | p[1] << 8 | p[0];
+}
+
+static void splash_fill(uint8_t *p, const uint8_t *src, unsigned count,
+			unsigned bytes_pp)
+{
+	uint32_t pixel = splash_pixel(src, bytes_pp);
+	uint16_t *p16 = (uint16_t *)p;
+	uint32_t *p32 = (uint32_t *)p;
+	unsigned done;
+
+	switch (bytes_pp) {
+	case 2:
+		while (count--)
+			*p16++ = pixel;
+		break;
+	case 4:
+		while (count--)
+			*p32++ = pixel;
+		break;
+	default:
+		/* keep doubling the filled part with block copies */
+		memcpy(p, src, 3);
+		for (done = 1; done < count; done += MIN(done, count - done))
+			memcpy(p + done * 3, p, MIN(done, count - done) * 3);
+		break;
+	}
+}
+
+static void splash_copy(uint8_t *p, const uint8_t *src, unsigned count,
+			unsigned bytes_pp)
 {
-	const uint8_t *imagestart = (const uint8_t *)address;
-	uint pos = 0, offset;
-	uint count = 0;
-	uint x = 0, y = 0;
-	uint8_t *base, *p;
+	if (bytes_pp == 3) {
+		memcpy(p, src, count * 3);
+		return;
+	}
+
+	for (; count--; src += 3, p += bytes_pp) {
+		if (bytes_pp == 2)
+			*(uint16_t *)p = splash_pixel(src, bytes_pp);
+		else
+			*(uint32_t *)p = splash_pixel(src, bytes_pp);
+	}
+}
+
+/* The generator compresses the logo line by line, so runs never wrap */
+static int splash_run(struct fbcon_splash *splash, const uint8_t *run)
+{
+	unsigned count = (run[0] & 0x7f) + 1;
+	uint8_t *p = splash->row + splash->x * splash->bytes_pp;
+
+	if (count > splash->width - splash->x)
+		return ERR_NOT_VALID;
+
+	if (run[0] & 0x80)
+		splash_fill(p, run + 1, count, splash->bytes_pp);
+	else
+		splash_copy(p, run + 1, count, splash->bytes_pp);
+
+	splash->x += count;
+	if (splash->x == splash->width) {
+		splash->x = 0;
+		splash->y++;
+		splash->row += splash->pitch;
+	}
+
+	return NO_ERROR;
+}
+
+/* Clean the rows completed since the last call from the cache */
+static void splash_clean(struct fbcon_splash *splash)
+{
+	unsigned rows = splash->y - splash->clean_y;
+
+	if (!rows)
+		return;
+
+	arch_clean_cache_range((addr_t)splash->base + splash->clean_y * splash->pitch,
+			       (rows - 1) * splash->pitch + splash->width * splash->bytes_pp);
+	splash->clean_y = splash->y;
+}
+
+/**
+ * Prepare decoding of a RLE24 logo, centered on the screen. The data
+ * can then be passed to fbcon_splash_decode() in chunks of any size.
+ */
+int fbcon_splash_start(struct fbcon_splash *splash, const logo_img_header *header)
+{
+	unsigned bytes_pp;
 
 	if (!config || header->width > config->width
 				|| header->height > config->height) {
 		dprintf(INFO, "the logo img is too large\n");
-		return;
+		return ERR_NOT_VALID;
+	}
+
+	bytes_pp = config->bpp / 8;
+	if (bytes_pp < 2 || bytes_pp > 4) {
+		dprintf(INFO, "unsupported framebuffer depth %u for the logo\n", config->bpp);
+		return ERR_NOT_SUPPORTED;
 	}
 
-	base = (uint8_t *) config->base;
+	memset(splash, 0, sizeof(*splash));
+	splash->width = header->width;
+	splash->height = header->height;
+	splash->bytes_pp = bytes_pp;
+	splash->pitch = (config->stride ? config->stride : config->width) * bytes_pp;
 
 	/* put the logo to be center */
-	offset = (config->height - header->height) / 2;
-	if (offset)
-		base += (offset * config->width) * 3;
-	offset = (config->width - header->width ) / 2;
-
-	x = offset;
-	while (count < (uint)header->height * (uint)header->width) {
-		uint8_t run = *(imagestart + pos);
-		bool repeat_run = (run & 0x80);
-		uint runlen = (run & 0x7f) + 1;
-		uint runpos;
-
-		/* consume the run byte */
-		pos++;
-
-		p = base + (y * config->width + x) * 3;
-
-		/* start of a run */
-		for (runpos = 0; runpos < runlen; runpos++) {
-			*p++ = *(imagestart + pos);
-			*p++ = *(imagestart + pos + 1);
-			*p++ = *(imagestart + pos + 2);
-			count++;
-
-			x++;
-
-			/* if a run of raw pixels, consume an input pixel */
-			if (!repeat_run)
-				pos += 3;
-		}
+	splash->base = (uint8_t *)config->base
+		+ (config->height - header->height) / 2 * splash->pitch
+		+ (config->width - header->width) / 2 * bytes_pp;
+	splash->row = splash->base;
 
-		/* if this was a run of repeated pixels, consume the one input pixel we repeated */
-		if (repeat_run)
-			pos += 3;
+	return NO_ERROR;
+}
 
-		/* the generator will keep compressing data line by line */
-		/* don't cross the lines */
-		if (x == header->width + offset) {
-			y++;
-			x = offset;
+/**
+ * Decode the next chunk of RLE24 data to the screen and clean the
+ * finished rows from the cache. A run may be split between two chunks.
+ *
+ * @return 0 if more data is needed, 1 once the logo is complete or
+ *         ERR_NOT_VALID if the data is corrupted.
+ */
+int fbcon_splash_decode(struct fbcon_splash *splash, const uint8_t *data, unsigned len)
+{
+	unsigned need, n;
+	int ret = NO_ERROR;
+
+	if (splash->y == splash->height)
+		return 1;
+
+	/* finish the run that was split at the end of the last chunk */
+	if (splash->carry_len) {
+		need = splash_run_len(splash->carry[0]) - splash->carry_len;
+		n = MIN(need, len);
+		memcpy(splash->carry + splash->carry_len, data, n);
+		splash->carry_len += n;
+		data += n;
+		len -= n;
+		if (n < need)
+			return 0;
+
+		splash->carry_len = 0;
+		ret = splash_run(splash, splash->carry);
+	}
+
+	while (!ret && len && splash->y < splash->height) {
+		need = splash_run_len(data[0]);
+		if (need > len) {
+			memcpy(splash->carry, data, len);
+			splash->carry_len = len;
+			break;
 		}
+
+		ret = splash_run(splash, data);
+		data += need;
+		len -= need;
 	}
 
+	splash_clean(splash);
+
+	if (ret)
+		return ret;
+	return splash->y == splash->height;
+}
+
+void fbcon_extract_to_screen(logo_img_header *header, void* address)
+{
+	struct fbcon_splash splash;
+
+	if (fbcon_splash_start(&splash, header))
+		return;
+
+	if (fbcon_splash_decode(&splash, address, header->blocks * 512) != 1)
+		dprintf(INFO, "the logo img is truncated or corrupted\n");
 }
 
 void display_default_image_on_screen(void)
@@ -544,8 +677,8 @@ void display_image_on_screen(void)
 	if (fetch_image_from_partition() < 0) {
 		display_default_image_on_screen();
 	} else {
-		/* data has been put into the right place */
-		fbcon_flush();
+		/* data has been put into the right place and cleaned from the cache */
+		fbcon_update();
 	}
 #else
 	display_default_image_on_screen();
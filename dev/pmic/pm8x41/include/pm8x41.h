@@ -228,6 +228,9 @@ uint8_t pm8x41_get_pon_reason();
 uint8_t pm8x41_get_pon_poff_reason1();
 uint8_t pm8x41_get_pon_poff_reason2();
 uint32_t pm8x41_get_pwrkey_is_pressed();
+void pm8x41_periph_irq_enable(uint32_t base, uint8_t mask);
+void pm8x41_periph_irq_disable(uint32_t base, uint8_t mask);
+void pm8x41_periph_irq_clear(uint32_t base, uint8_t mask);
 void pm8x41_config_output_mpp(struct pm8x41_mpp *mpp);
 void pm8x41_enable_mpp(struct pm8x41_mpp *mpp, enum mpp_en_ctl enable);
 void pm8x41_enable_mvs(struct pm8x41_mvs *mvs, enum mvs_en_ctl enable);
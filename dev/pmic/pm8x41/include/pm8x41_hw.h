@@ -37,6 +37,16 @@
 
 #define REVID_REVISION4                       0x103
 
+/* Register offsets common to all peripherals */
+#define PERIPH_TYPE                           0x04
+#define PERIPH_SUBTYPE                        0x05
+#define PERIPH_INT_SET_TYPE                   0x11
+#define PERIPH_INT_POLARITY_HIGH              0x12
+#define PERIPH_INT_POLARITY_LOW               0x13
+#define PERIPH_INT_LATCHED_CLR                0x14
+#define PERIPH_INT_EN_SET                     0x15
+#define PERIPH_INT_EN_CLR                     0x16
+
 /* LPG Registers */
 #define LPG_SLAVE_ID                  	0x10000	/* slave_id == 1 */
 #define LPG_PERIPHERAL_BASE		(0x0B100 | LPG_SLAVE_ID)
@@ -62,6 +72,7 @@
 
 
 /* PON Peripheral registers */
+#define PON_PERIPHERAL_BASE                   0x800
 #define PON_PON_REASON1                       0x808
 #define PON_WARMBOOT_STATUS1                  0x80A
 #define PON_WARMBOOT_STATUS2                  0x80B
@@ -105,6 +116,17 @@
 
 void pm8x41_reg_write(uint32_t addr, uint8_t val);
 uint8_t pm8x41_reg_read(uint32_t addr);
+int pm8x41_reg_read_burst(uint32_t addr, uint8_t *buf, unsigned len);
+int pm8x41_reg_write_burst(uint32_t addr, const uint8_t *buf, unsigned len);
+
+/* Register write for pm8x41_reg_write_seq(), mask 0xFF writes the whole value */
+struct pm8x41_reg_op {
+	uint32_t addr;
+	uint8_t val;
+	uint8_t mask;
+};
+
+int pm8x41_reg_write_seq(const struct pm8x41_reg_op *ops, unsigned count);
 
 /* SPMI Macros */
 #define REG_READ(_a)        pm8x41_reg_read(_a)
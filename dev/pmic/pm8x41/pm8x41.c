@@ -30,6 +30,7 @@
 #include <debug.h>
 #include <reg.h>
 #include <spmi.h>
+#include <stdlib.h>
 #include <string.h>
 #include <pm8x41_hw.h>
 #include <pm8x41.h>
@@ -42,40 +43,193 @@ uint8_t pmi8994_config_mpp_slave_id(uint8_t slave_id)
 	mpp_slave_id = slave_id;
 }
 
+/*
+ * Shadow of registers that do not change while we are running (revision,
+ * peripheral type, power on reasons), so repeated queries of them don't
+ * cost an SPMI round trip each time.
+ */
+#define PM8X41_SHADOW_SIZE	32
+
+struct pm8x41_shadow_reg {
+	uint32_t addr;
+	uint8_t val;
+};
+
+static struct pm8x41_shadow_reg pm8x41_shadow[PM8X41_SHADOW_SIZE];
+static unsigned pm8x41_shadow_count;
+
+static bool pm8x41_reg_is_constant(uint32_t addr)
+{
+	if (REG_OFFSET(addr) == PERIPH_TYPE || REG_OFFSET(addr) == PERIPH_SUBTYPE)
+		return true;
+
+	if (PERIPH_ID(addr) == PERIPH_ID(REVID_REVISION4))
+		return true;
+
+	switch (addr & 0xFFFF) {
+	case PON_PON_REASON1:
+	case PON_WARMBOOT_STATUS1:
+	case PON_WARMBOOT_STATUS2:
+	case PON_POFF_REASON1:
+	case PON_POFF_REASON2:
+		return true;
+	}
+
+	return false;
+}
+
+static struct pm8x41_shadow_reg *pm8x41_shadow_find(uint32_t addr)
+{
+	unsigned i;
+
+	for (i = 0; i < pm8x41_shadow_count; i++)
+		if (pm8x41_shadow[i].addr == addr)
+			return &pm8x41_shadow[i];
+
+	return NULL;
+}
+
+static void pm8x41_shadow_update(uint32_t addr, uint8_t val)
+{
+	struct pm8x41_shadow_reg *reg = pm8x41_shadow_find(addr);
+
+	if (!reg) {
+		if (pm8x41_shadow_count == PM8X41_SHADOW_SIZE)
+			return;
+		reg = &pm8x41_shadow[pm8x41_shadow_count++];
+		reg->addr = addr;
+	}
+
+	reg->val = val;
+}
+
 /* SPMI helper functions */
 uint8_t pm8x41_reg_read(uint32_t addr)
 {
+	struct pm8x41_shadow_reg *reg;
 	uint8_t val = 0;
-	struct pmic_arb_cmd cmd;
-	struct pmic_arb_param param;
+	bool constant = pm8x41_reg_is_constant(addr);
 
-	cmd.address  = PERIPH_ID(addr);
-	cmd.offset   = REG_OFFSET(addr);
-	cmd.slave_id = SLAVE_ID(addr);
-	cmd.priority = 0;
+	if (constant) {
+		reg = pm8x41_shadow_find(addr);
+		if (reg)
+			return reg->val;
+	}
 
-	param.buffer = &val;
-	param.size   = 1;
+	pm8x41_reg_read_burst(addr, &val, 1);
 
-	pmic_arb_read_cmd(&cmd, &param);
+	if (constant)
+		pm8x41_shadow_update(addr, val);
 
 	return val;
 }
 
 void pm8x41_reg_write(uint32_t addr, uint8_t val)
+{
+	pm8x41_reg_write_burst(addr, &val, 1);
+}
+
+/*
+ * Read/write len consecutive registers starting at addr. The arbiter moves
+ * up to PMIC_ARB_MAX_BYTES per command, so this needs a fraction of the
+ * round trips of accessing every register on its own.
+ */
+int pm8x41_reg_read_burst(uint32_t addr, uint8_t *buf, unsigned len)
+{
+	struct pmic_arb_cmd cmd;
+	struct pmic_arb_param param;
+	unsigned chunk;
+
+	while (len) {
+		/* Commands can not cross the end of a peripheral */
+		chunk = MIN(len, PMIC_ARB_MAX_BYTES);
+		chunk = MIN(chunk, 0x100 - REG_OFFSET(addr));
+
+		cmd.address  = PERIPH_ID(addr);
+		cmd.offset   = REG_OFFSET(addr);
+		cmd.slave_id = SLAVE_ID(addr);
+		cmd.priority = 0;
+
+		param.buffer = buf;
+		param.size   = chunk;
+
+		if (pmic_arb_read_cmd(&cmd, &param))
+			return -1;
+
+		addr += chunk;
+		buf += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+int pm8x41_reg_write_burst(uint32_t addr, const uint8_t *buf, unsigned len)
 {
 	struct pmic_arb_cmd cmd;
 	struct pmic_arb_param param;
+	unsigned chunk, i;
+
+	while (len) {
+		chunk = MIN(len, PMIC_ARB_MAX_BYTES);
+		chunk = MIN(chunk, 0x100 - REG_OFFSET(addr));
+
+		cmd.address  = PERIPH_ID(addr);
+		cmd.offset   = REG_OFFSET(addr);
+		cmd.slave_id = SLAVE_ID(addr);
+		cmd.priority = 0;
 
-	cmd.address  = PERIPH_ID(addr);
-	cmd.offset   = REG_OFFSET(addr);
-	cmd.slave_id = SLAVE_ID(addr);
-	cmd.priority = 0;
+		param.buffer = (uint8_t *)buf;
+		param.size   = chunk;
 
-	param.buffer = &val;
-	param.size   = 1;
+		if (pmic_arb_write_cmd(&cmd, &param))
+			return -1;
 
-	pmic_arb_write_cmd(&cmd, &param);
+		for (i = 0; i < chunk; i++)
+			if (pm8x41_reg_is_constant(addr + i))
+				pm8x41_shadow_update(addr + i, buf[i]);
+
+		addr += chunk;
+		buf += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+/*
+ * Apply a list of register writes. Writes to consecutive registers are
+ * merged into bursts, entries with a mask other than 0xFF are done as
+ * read-modify-write.
+ */
+int pm8x41_reg_write_seq(const struct pm8x41_reg_op *ops, unsigned count)
+{
+	uint8_t burst[PMIC_ARB_MAX_BYTES];
+	uint32_t start;
+	unsigned i = 0, n;
+	uint8_t val;
+
+	while (i < count) {
+		if (ops[i].mask != 0xFF) {
+			val = REG_READ(ops[i].addr);
+			val = (val & ~ops[i].mask) | (ops[i].val & ops[i].mask);
+			if (pm8x41_reg_write_burst(ops[i].addr, &val, 1))
+				return -1;
+			i++;
+			continue;
+		}
+
+		start = ops[i].addr;
+		n = 0;
+		while (i < count && n < PMIC_ARB_MAX_BYTES && ops[i].mask == 0xFF &&
+		       ops[i].addr == start + n && REG_OFFSET(ops[i].addr) >= REG_OFFSET(start))
+			burst[n++] = ops[i++].val;
+
+		if (pm8x41_reg_write_burst(start, burst, n))
+			return -1;
+	}
+
+	return 0;
 }
 
 /* Exported functions */
@@ -90,43 +244,38 @@ void pm8x41_set_boot_done()
 	REG_WRITE(SMBB_MISC_BOOT_DONE, val);
 }
 
-/* Configure GPIO */
-int pm8x41_gpio_config(uint8_t gpio, struct pm8x41_gpio *config)
+static int pm8x41_gpio_config_base(uint32_t gpio_base, struct pm8x41_gpio *config)
 {
-	uint8_t  val;
-	uint32_t gpio_base = GPIO_N_PERIPHERAL_BASE(gpio);
+	uint8_t en, ctl[3];
 
 	/* Disable the GPIO */
-	val  = REG_READ(gpio_base + GPIO_EN_CTL);
-	val &= ~BIT(PERPH_EN_BIT);
-	REG_WRITE(gpio_base + GPIO_EN_CTL, val);
-
-	/* Select the mode */
-	val = config->function | (config->direction << 4);
-	REG_WRITE(gpio_base + GPIO_MODE_CTL, val);
-
-	/* Set the right pull */
-	val = config->pull;
-	REG_WRITE(gpio_base + GPIO_DIG_PULL_CTL, val);
+	en  = REG_READ(gpio_base + GPIO_EN_CTL);
+	REG_WRITE(gpio_base + GPIO_EN_CTL, en & ~BIT(PERPH_EN_BIT));
 
-	/* Select the VIN */
-	val = config->vin_sel;
-	REG_WRITE(gpio_base + GPIO_DIG_VIN_CTL, val);
+	/* Select the mode, VIN and the right pull in one go */
+	ctl[GPIO_MODE_CTL - GPIO_MODE_CTL] = config->function | (config->direction << 4);
+	ctl[GPIO_DIG_VIN_CTL - GPIO_MODE_CTL] = config->vin_sel;
+	ctl[GPIO_DIG_PULL_CTL - GPIO_MODE_CTL] = config->pull;
+	pm8x41_reg_write_burst(gpio_base + GPIO_MODE_CTL, ctl, sizeof(ctl));
 
 	if (config->direction == PM_GPIO_DIR_OUT) {
 		/* Set the right dig out control */
-		val = config->out_strength | (config->output_buffer << 4);
-		REG_WRITE(gpio_base + GPIO_DIG_OUT_CTL, val);
+		REG_WRITE(gpio_base + GPIO_DIG_OUT_CTL,
+			  config->out_strength | (config->output_buffer << 4));
 	}
 
 	/* Enable the GPIO */
-	val  = REG_READ(gpio_base + GPIO_EN_CTL);
-	val |= BIT(PERPH_EN_BIT);
-	REG_WRITE(gpio_base + GPIO_EN_CTL, val);
+	REG_WRITE(gpio_base + GPIO_EN_CTL, en | BIT(PERPH_EN_BIT));
 
 	return 0;
 }
 
+/* Configure GPIO */
+int pm8x41_gpio_config(uint8_t gpio, struct pm8x41_gpio *config)
+{
+	return pm8x41_gpio_config_base(GPIO_N_PERIPHERAL_BASE(gpio), config);
+}
+
 int pm8x41_gpio_direction(uint8_t gpio, uint8_t dir, uint8_t value)
 {
 	uint32_t gpio_base = GPIO_N_PERIPHERAL_BASE(gpio);
@@ -166,7 +315,6 @@ int pm8x41_gpio_set(uint8_t gpio, uint8_t value)
 /* Configure PM and PMI GPIO with slave id */
 int pm8x41_gpio_config_sid(uint8_t sid, uint8_t gpio, struct pm8x41_gpio *config)
 {
-	uint8_t  val;
 	uint32_t gpio_base = GPIO_N_PERIPHERAL_BASE(gpio);
 
 	gpio_base &= 0x0ffff;	/* clear sid */
@@ -174,35 +322,7 @@ int pm8x41_gpio_config_sid(uint8_t sid, uint8_t gpio, struct pm8x41_gpio *config
 
 	dprintf(SPEW, "%s: gpio=%d base=%x\n", __func__, gpio, gpio_base);
 
-	/* Disable the GPIO */
-	val  = REG_READ(gpio_base + GPIO_EN_CTL);
-	val &= ~BIT(PERPH_EN_BIT);
-	REG_WRITE(gpio_base + GPIO_EN_CTL, val);
-
-	/* Select the mode */
-	val = config->function | (config->direction << 4);
-	REG_WRITE(gpio_base + GPIO_MODE_CTL, val);
-
-	/* Set the right pull */
-	val = config->pull;
-	REG_WRITE(gpio_base + GPIO_DIG_PULL_CTL, val);
-
-	/* Select the VIN */
-	val = config->vin_sel;
-	REG_WRITE(gpio_base + GPIO_DIG_VIN_CTL, val);
-
-	if (config->direction == PM_GPIO_DIR_OUT) {
-		/* Set the right dig out control */
-		val = config->out_strength | (config->output_buffer << 4);
-		REG_WRITE(gpio_base + GPIO_DIG_OUT_CTL, val);
-	}
-
-	/* Enable the GPIO */
-	val  = REG_READ(gpio_base + GPIO_EN_CTL);
-	val |= BIT(PERPH_EN_BIT);
-	REG_WRITE(gpio_base + GPIO_EN_CTL, val);
-
-	return 0;
+	return pm8x41_gpio_config_base(gpio_base, config);
 }
 
 /* Reads the status of requested gpio */
@@ -325,6 +445,38 @@ uint32_t pm8x41_get_pwrkey_is_pressed()
 		return 0;
 }
 
+/* Latch both edges of the given interrupt bits of a peripheral.
+ * base: peripheral base address, including the slave id.
+ */
+void pm8x41_periph_irq_enable(uint32_t base, uint8_t mask)
+{
+	uint8_t val;
+
+	REG_WRITE(base + PERIPH_INT_EN_CLR, mask);
+
+	val = REG_READ(base + PERIPH_INT_SET_TYPE);
+	REG_WRITE(base + PERIPH_INT_SET_TYPE, val | mask);
+	val = REG_READ(base + PERIPH_INT_POLARITY_HIGH);
+	REG_WRITE(base + PERIPH_INT_POLARITY_HIGH, val | mask);
+	val = REG_READ(base + PERIPH_INT_POLARITY_LOW);
+	REG_WRITE(base + PERIPH_INT_POLARITY_LOW, val | mask);
+
+	REG_WRITE(base + PERIPH_INT_LATCHED_CLR, mask);
+	REG_WRITE(base + PERIPH_INT_EN_SET, mask);
+}
+
+void pm8x41_periph_irq_disable(uint32_t base, uint8_t mask)
+{
+	REG_WRITE(base + PERIPH_INT_EN_CLR, mask);
+	REG_WRITE(base + PERIPH_INT_LATCHED_CLR, mask);
+}
+
+/* The PMIC only sends a new interrupt once the latched bit is cleared */
+void pm8x41_periph_irq_clear(uint32_t base, uint8_t mask)
+{
+	REG_WRITE(base + PERIPH_INT_LATCHED_CLR, mask);
+}
+
 void pm8x41_v2_reset_configure(uint8_t reset_type)
 {
 	uint8_t val;
@@ -370,6 +522,7 @@ int pm8x41_ldo_set_voltage(struct pm8x41_ldo *ldo, uint32_t voltage)
 	uint32_t mult = 0;
 	uint32_t val = 0;
 	uint32_t vmin = 0;
+	struct pm8x41_reg_op ops[2];
 
 	if (!ldo)
 	{
@@ -416,15 +569,14 @@ int pm8x41_ldo_set_voltage(struct pm8x41_ldo *ldo, uint32_t voltage)
 
 	mult = (voltage - vmin) / step;
 
-	/* Set Range in voltage ctrl register */
-	val = 0x0;
-	val = range << LDO_RANGE_SEL_BIT;
-	REG_WRITE((ldo->base + LDO_RANGE_CTRL), val);
-
-	/* Set multiplier in voltage ctrl register */
-	val = 0x0;
-	val = mult << LDO_VSET_SEL_BIT;
-	REG_WRITE((ldo->base + LDO_STEP_CTRL), val);
+	/* Set range and multiplier in the voltage ctrl registers */
+	ops[0].addr = ldo->base + LDO_RANGE_CTRL;
+	ops[0].val  = range << LDO_RANGE_SEL_BIT;
+	ops[0].mask = 0xFF;
+	ops[1].addr = ldo->base + LDO_STEP_CTRL;
+	ops[1].val  = mult << LDO_VSET_SEL_BIT;
+	ops[1].mask = 0xFF;
+	pm8x41_reg_write_seq(ops, ARRAY_SIZE(ops));
 
 	return 0;
 }
@@ -65,6 +65,9 @@ void arch_switch_stacks_and_call(addr_t call, addr_t stack) __NO_RETURN;
 
 uint32_t arch_cycle_count(void);
 
+/* address the current interrupt was taken at, 0 outside of interrupt context */
+addr_t arch_irq_pc(void);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -59,8 +59,8 @@ int _dvprintf(const char *fmt, va_list ap);
 #define dvprintf(level, x...) do { if ((level) <= DEBUGLEVEL) { _dvprintf(x); } } while (0)
 
 /* lk_log */
-char* lk_log_getbuf(void);
-unsigned lk_log_getsize(void);
+unsigned lk_log_read(unsigned seq, char *buf, unsigned max, unsigned *next_seq);
+void lk_log_flush(void);
 
 /* input */
 int dgetc(char *c, bool wait);
@@ -82,6 +82,21 @@ typedef struct logo_img_header {
 	uint8_t  reserved[512-28];
 }logo_img_header;
 
+/* Streaming decoder for RLE24 logos, see fbcon_splash_decode() */
+struct fbcon_splash {
+	uint8_t		*base;		/* first pixel of the logo */
+	uint8_t		*row;		/* first pixel of the current row */
+	unsigned	x;
+	unsigned	y;
+	unsigned	width;
+	unsigned	height;
+	unsigned	pitch;		/* framebuffer bytes per row */
+	unsigned	bytes_pp;
+	unsigned	clean_y;	/* first row not cleaned from the cache */
+	unsigned	carry_len;
+	uint8_t		carry[1 + 128 * 3];	/* run split between chunks */
+};
+
 struct fbimage {
 	struct logo_img_header header;
 	void *image;
@@ -109,6 +124,8 @@ void fbcon_putc(char c);
 void fbcon_clear(void);
 struct fbcon_config* fbcon_display(void);
 void fbcon_extract_to_screen(logo_img_header *header, void* address);
+int fbcon_splash_start(struct fbcon_splash *splash, const logo_img_header *header);
+int fbcon_splash_decode(struct fbcon_splash *splash, const uint8_t *data, unsigned len);
 void fbcon_putc_factor(char c, int type, unsigned scale_factor);
 void fbcon_draw_msg_background(unsigned y_start, unsigned y_end,
 	uint32_t paint, int update);
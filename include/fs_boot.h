@@ -3,6 +3,7 @@
 #ifndef _FS_BOOT_H_
 #define _FS_BOOT_H_
 #include <stddef.h>
+#include <lib/fs.h>
 
 enum fs_boot_dev {
 	FS_BOOT_DEV_NONE,
@@ -24,7 +25,18 @@ struct fs_boot_data {
 
 extern struct fs_boot_data fs_boot_data;
 
+/*
+ * Called with the boot.img found by fsboot_load_first() while its
+ * filesystem is mounted. Returns the number of bytes loaded or < 0 to
+ * continue with the next partition.
+ */
+typedef int (*fsboot_load_t)(filehandle *handle, off_t size, void *arg);
+
 void fsboot_test(void);
+int fsboot_load_first(fsboot_load_t load, void *arg);
+/* Load the first boot.img found to target */
 int fsboot_boot_first(void* target, size_t sz);
+/* Boot the first boot.img found with aboot, returns if there is none */
+void boot_linux_from_fs(void);
 
 #endif
@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef __KERNEL_PROFILE_H
+#define __KERNEL_PROFILE_H
+
+#include <sys/types.h>
+
+/*
+ * Sampling profiler driven by a kernel timer. Each sample records the PC
+ * the timer interrupt was taken at together with the running thread.
+ * Results are available as a PC histogram or as folded stacks
+ * ("thread;pc count") for flamegraph tools. The PCs are not symbolized,
+ * use addr2line -f -e lk on the host.
+ */
+
+typedef void (*profile_print)(const char *line);
+
+status_t profile_start(time_t period);
+void profile_stop(void);
+
+void profile_dump_threads(profile_print print);
+void profile_dump_hist(profile_print print, unsigned count);
+void profile_dump_folded(profile_print print);
+
+/*
+ * Run one of "start [period ms]", "stop", "threads", "hist [count]" or
+ * "folded" and print the result, shared by the console and fastboot.
+ */
+status_t profile_command(const char *cmd, unsigned arg, profile_print print);
+
+#endif
@@ -47,6 +47,13 @@ enum thread_tls_list {
 
 #define THREAD_MAGIC 'thrd'
 
+/* thread level statistics */
+#if DEBUGLEVEL > 1
+#define THREAD_STATS 1
+#else
+#define THREAD_STATS 0
+#endif
+
 typedef struct thread {
 	int magic;
 	struct list_node thread_list_node;
@@ -79,6 +86,17 @@ typedef struct thread {
 	/* thread local storage */
 	uint32_t tls[MAX_TLS_ENTRY];
 
+#if THREAD_STATS
+	/* cpu accounting, updated by thread_resched() */
+	bigtime_t runtime;
+	bigtime_t last_run_timestamp;
+	bigtime_t ready_timestamp;
+	bigtime_t wait_time;
+	bigtime_t max_wait_time;
+	int context_switches;
+	int preempts;
+#endif
+
 	char name[32];
 } thread_t;
 
@@ -204,12 +222,6 @@ int wait_queue_wake_all(wait_queue_t *, bool reschedule, status_t wait_queue_err
  */
 status_t thread_unblock_from_wait_queue(thread_t *t, bool reschedule, status_t wait_queue_error);
 
-/* thread level statistics */
-#if DEBUGLEVEL > 1
-#define THREAD_STATS 1
-#else
-#define THREAD_STATS 0
-#endif
 #if THREAD_STATS
 struct thread_stats {
 	bigtime_t idle_time;
@@ -225,6 +237,20 @@ struct thread_stats {
 
 extern struct thread_stats thread_stats;
 
+/* snapshot of the cpu accounting of a thread */
+struct thread_cpu_stats {
+	char name[32];
+	int priority;
+	enum thread_state state;
+	bigtime_t runtime;	/* time spent running, in us */
+	bigtime_t wait_time;	/* time spent on the run queue, in us */
+	bigtime_t max_wait_time; /* longest time from ready to running */
+	int context_switches;	/* times it was switched to */
+	int preempts;
+};
+
+int thread_get_cpu_stats(struct thread_cpu_stats *stats, int count);
+
 #endif
 
 #endif
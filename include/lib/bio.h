@@ -30,6 +30,7 @@ typedef uint32_t bnum_t;
 
 typedef struct bdev {
 	struct list_node node;
+	struct list_node hash_node;
 	volatile int ref;
 
 	/* info about the block device */
@@ -0,0 +1,21 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef __LIB_FNV_H
+#define __LIB_FNV_H
+
+#include <sys/types.h>
+
+/* 32-bit FNV-1a, a fast hash for short keys like names */
+static inline uint32_t fnv1a_hash(const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	uint32_t hash = 2166136261U;
+
+	while (len--) {
+		hash ^= *p++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+#endif
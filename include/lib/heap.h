@@ -30,6 +30,7 @@ void *heap_realloc(void *ptr, size_t size);
 void heap_free(void *);
 
 void heap_init(void);
+unsigned int heap_alloc_count(void);
 
 
 
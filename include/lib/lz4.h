@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef __LIB_LZ4_H
+#define __LIB_LZ4_H
+
+#include <sys/types.h>
+
+/*
+ * Decoder for the LZ4 frame format (lz4 command line tool, magic
+ * 0x184D2204). The output is passed on in chunks through a caller
+ * provided buffer, so the decompressed data does not need to fit in
+ * memory. The header, block and content checksums are verified, the
+ * content checksum only after all the output has been passed to write.
+ */
+
+/* lz4_decompress_stream() passes the output on in multiples of this size */
+#define LZ4_STREAM_ALIGN	4096
+
+typedef int (*lz4_write_t)(void *arg, unsigned char *buf, unsigned int len);
+
+bool is_lz4_frame(const unsigned char *buf, unsigned int len);
+
+/*
+ * Decompress the frame in "in". "buf" needs room for one block plus the
+ * 64 KiB window, larger buffers result in fewer and larger calls to write.
+ * Returns 0 on success, an ERR_* code or the error returned by write.
+ */
+int lz4_decompress_stream(const unsigned char *in, unsigned int in_len,
+			  unsigned char *buf, unsigned int buf_len,
+			  lz4_write_t write, void *arg,
+			  unsigned long long *out_len);
+
+#endif
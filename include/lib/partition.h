@@ -24,6 +24,7 @@
 #define __LIB_PARTITION_H
 
 #include <sys/types.h>
+#include <stdbool.h>
 
 /* examine and try to publish partitions on a particular device at a particular offset */
 int partition_publish(const char *device, off_t offset);
@@ -31,5 +32,44 @@ int partition_publish(const char *device, off_t offset);
 /* remove any published subdevices on this device */
 int partition_unpublish(const char *device);
 
+/* validated GPT header and partition entry array, see gpt_read_table() */
+struct gpt_table {
+	uint8_t *header;
+	uint8_t *entries;
+	uint32_t entry_count;
+	uint32_t entry_size;
+	uint32_t entries_crc;
+	uint64_t first_usable_lba;
+	uint64_t last_usable_lba;
+	bool backup;
+};
+
+struct gpt_entry {
+	uint8_t type_guid[16];
+	uint8_t unique_guid[16];
+	uint64_t first_lba;
+	uint64_t last_lba;
+	uint64_t attributes;
+	char name[37];
+};
+
+/* read len bytes at byte offset into buf, return 0 on success */
+typedef int (*gpt_read_fn)(void *cookie, uint64_t offset, void *buf, size_t len);
+
+/*
+ * read the primary (or if invalid, the backup) GPT with as few reads as
+ * possible and validate both CRCs. free the result with gpt_free_table().
+ */
+int gpt_read_table(gpt_read_fn read, void *cookie, uint32_t block_size,
+		   uint64_t block_count, struct gpt_table *gpt);
+void gpt_free_table(struct gpt_table *gpt);
+void gpt_get_entry(const struct gpt_table *gpt, unsigned int index,
+		   struct gpt_entry *entry);
+
+/* GPT of a device as parsed by partition_publish(), NULL if none */
+const struct gpt_table *partition_get_gpt(const char *device);
+void partition_cache_gpt(const char *device, struct gpt_table *gpt);
+void partition_forget_gpt(const char *device);
+
 #endif
 
@@ -0,0 +1,24 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef __LIB_SPARSE_H
+#define __LIB_SPARSE_H
+
+#include <sys/types.h>
+#include <lib/sparse_format.h>
+
+/* Where an Android sparse image is unpacked to */
+struct sparse_dest {
+	uint64_t size;
+	/* offset is relative to the start of the destination */
+	int (*write)(void *arg, uint64_t offset, void *buf, uint32_t len);
+	void *arg;
+};
+
+/*
+ * Validate the sparse image in data and write its chunks to dest.
+ * Returns 0 on success. On failure *err is set to a message that can
+ * be passed on to fastboot.
+ */
+int sparse_write(const struct sparse_dest *dest, void *data, unsigned sz,
+		 const char **err);
+
+#endif
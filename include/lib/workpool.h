@@ -0,0 +1,37 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef __LIB_WORKPOOL_H
+#define __LIB_WORKPOOL_H
+
+#include <list.h>
+#include <sys/types.h>
+
+/*
+ * Simple job queue that can be served by otherwise unused CPU cores.
+ *
+ * Work callbacks may run on a secondary CPU that does not take part in the
+ * LK kernel. They must only compute on memory and must not call into the
+ * kernel or any drivers (no malloc, dprintf, threads, events, MMIO...).
+ * If no worker CPU is online, queued work is run by work_wait() on the
+ * calling thread instead, so users do not need a separate fallback path.
+ */
+
+typedef void (*work_callback)(void *arg);
+
+struct work {
+	struct list_node node;
+	work_callback cb;
+	void *arg;
+	volatile int state;
+};
+
+void work_init(struct work *work, work_callback cb, void *arg);
+void work_queue(struct work *work);
+void work_wait(struct work *work);
+
+/* Called on worker CPUs, returns after workpool_stop() */
+void workpool_worker(void);
+/* Stop all workers and wait until they have left workpool_worker() */
+void workpool_stop(void);
+int workpool_num_workers(void);
+
+#endif
@@ -68,6 +68,10 @@ void lk2nd_rproc_update_dev_tree(void *fdt);
 
 struct smp_spin_table;
 void smp_spin_table_setup(struct smp_spin_table *table, void *fdt, bool arm64, bool force);
+void smp_workers_start(struct smp_spin_table *table);
+void smp_workers_stop(void);
+
+void lk2nd_bench(const char *filter, void (*print)(const char *line));
 
 int lkfdt_prop_strcmp(const void *fdt, int node, const char *prop, const char *cmp);
 bool lkfdt_node_is_available(const void *fdt, int node);
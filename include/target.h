@@ -25,6 +25,8 @@
 #ifndef __TARGET_H
 #define __TARGET_H
 
+#include <platform/interrupts.h>
+
 
 /* Target helper functions exposed to USB driver */
 typedef struct {
@@ -95,6 +97,14 @@ bool target_battery_soc_ok();
 bool target_battery_is_present();
 uint32_t target_get_pmic();
 
+/* Call handler from interrupt context whenever a menu key changes state.
+ * Returns ERR_NOT_SUPPORTED if the keys can only be polled.
+ */
+int target_keys_irq_enable(int_handler handler, void *arg);
+/* Re-arm the key interrupts, from thread context */
+void target_keys_irq_ack(void);
+void target_keys_irq_disable(void);
+
 static inline bool target_use_signed_kernel(void)
 {
 #if _SIGNED_KERNEL
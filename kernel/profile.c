@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <arch/ops.h>
+#include <debug.h>
+#include <err.h>
+#include <malloc.h>
+#include <platform.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <kernel/profile.h>
+#include <kernel/thread.h>
+#include <kernel/timer.h>
+
+#define PROFILE_ENTRIES_SHIFT	10
+#define PROFILE_ENTRIES		(1 << PROFILE_ENTRIES_SHIFT)
+#define PROFILE_PROBES		32
+#define PROFILE_THREADS		16
+#define PROFILE_HIST_COUNT	32
+#define PROFILE_LINE_SIZE	60
+
+/* One hash table slot per (thread, PC), count == 0 marks a free slot */
+struct profile_entry {
+	addr_t pc;
+	unsigned count;
+	int thread;
+};
+
+/* Threads are copied by name since they may exit before the dump */
+struct profile_thread {
+	thread_t *thread;
+	char name[32];
+};
+
+static struct {
+	timer_t timer;
+	bool running;
+	struct profile_entry *entries;
+	struct profile_thread threads[PROFILE_THREADS];
+	int num_threads;
+	unsigned samples;
+	unsigned dropped;
+	bigtime_t start;
+	bigtime_t duration;
+} profile;
+
+static int profile_thread_index(thread_t *t)
+{
+	struct profile_thread *pt;
+	int i;
+
+	for (i = 0; i < profile.num_threads; i++) {
+		pt = &profile.threads[i];
+		if (pt->thread == t && !strcmp(pt->name, t->name))
+			return i;
+	}
+
+	if (i == PROFILE_THREADS)
+		return -1;
+
+	pt = &profile.threads[i];
+	pt->thread = t;
+	strlcpy(pt->name, t->name, sizeof(pt->name));
+	profile.num_threads++;
+	return i;
+}
+
+static enum handler_return profile_sample(timer_t *timer, time_t now, void *arg)
+{
+	addr_t pc = arch_irq_pc();
+	struct profile_entry *e;
+	unsigned i, n;
+	int thread;
+
+	profile.samples++;
+
+	thread = profile_thread_index(current_thread);
+	if (!pc || thread < 0) {
+		profile.dropped++;
+		return INT_NO_RESCHEDULE;
+	}
+
+	i = ((uint32_t)(pc >> 1) ^ (thread << 24)) * 2654435761u
+		>> (32 - PROFILE_ENTRIES_SHIFT);
+	for (n = 0; n < PROFILE_PROBES; n++, i = (i + 1) % PROFILE_ENTRIES) {
+		e = &profile.entries[i];
+		if (!e->count) {
+			e->pc = pc;
+			e->thread = thread;
+		}
+		if (e->pc == pc && e->thread == thread) {
+			e->count++;
+			return INT_NO_RESCHEDULE;
+		}
+	}
+
+	profile.dropped++;
+	return INT_NO_RESCHEDULE;
+}
+
+/**
+ * @brief  Start sampling every period ms, discarding earlier samples
+ */
+status_t profile_start(time_t period)
+{
+	if (!profile.entries) {
+		profile.entries = malloc(PROFILE_ENTRIES * sizeof(*profile.entries));
+		if (!profile.entries)
+			return ERR_NO_MEMORY;
+	}
+
+	enter_critical_section();
+	if (profile.running)
+		timer_cancel(&profile.timer);
+
+	memset(profile.entries, 0, PROFILE_ENTRIES * sizeof(*profile.entries));
+	profile.num_threads = 0;
+	profile.samples = 0;
+	profile.dropped = 0;
+	profile.start = current_time_hires();
+	profile.running = true;
+
+	timer_initialize(&profile.timer);
+	timer_set_periodic(&profile.timer, period ? period : 1, profile_sample, NULL);
+	exit_critical_section();
+
+	return NO_ERROR;
+}
+
+void profile_stop(void)
+{
+	enter_critical_section();
+	if (profile.running) {
+		timer_cancel(&profile.timer);
+		profile.duration = current_time_hires() - profile.start;
+		profile.running = false;
+	}
+	exit_critical_section();
+}
+
+void profile_dump_threads(profile_print print)
+{
+#if THREAD_STATS
+	struct thread_cpu_stats *stats;
+	char line[PROFILE_LINE_SIZE];
+	bigtime_t uptime;
+	int i, count;
+
+	/* leave some room for threads created in the meantime */
+	count = thread_get_cpu_stats(NULL, 0) + 4;
+	stats = malloc(count * sizeof(*stats));
+	if (!stats) {
+		print("profile: out of memory");
+		return;
+	}
+
+	count = MIN(thread_get_cpu_stats(stats, count), count);
+	uptime = current_time_hires();
+	if (!uptime)
+		uptime = 1;
+
+	snprintf(line, sizeof(line), "%-12s %2s %4s %7s %6s %7s %7s %5s",
+		 "thread", "pr", "cpu", "run ms", "cs", "wait ms", "max us", "pre");
+	print(line);
+
+	for (i = 0; i < count; i++) {
+		snprintf(line, sizeof(line), "%-12.12s %2d %3u%% %7llu %6d %7llu %7llu %5d",
+			 stats[i].name, stats[i].priority,
+			 (unsigned)(stats[i].runtime * 100 / uptime),
+			 stats[i].runtime / 1000, stats[i].context_switches,
+			 stats[i].wait_time / 1000, stats[i].max_wait_time,
+			 stats[i].preempts);
+		print(line);
+	}
+
+	free(stats);
+#else
+	print("profile: thread stats are disabled (DEBUG < 2)");
+#endif
+}
+
+/* Shell sort by descending count, so the free slots end up last */
+static void profile_sort(struct profile_entry *e, unsigned n)
+{
+	struct profile_entry tmp;
+	unsigned gap, i, j;
+
+	for (gap = n / 2; gap; gap /= 2) {
+		for (i = gap; i < n; i++) {
+			tmp = e[i];
+			for (j = i; j >= gap && e[j - gap].count < tmp.count; j -= gap)
+				e[j] = e[j - gap];
+			e[j] = tmp;
+		}
+	}
+}
+
+/**
+ * @brief  Print the count most frequently sampled PCs
+ *
+ * Works on a copy of the samples, so the profiler can keep running.
+ */
+void profile_dump_hist(profile_print print, unsigned count)
+{
+	struct profile_entry *entries;
+	char line[PROFILE_LINE_SIZE];
+	unsigned i, samples, dropped;
+	bigtime_t duration;
+
+	if (!profile.entries) {
+		print("profile: not started");
+		return;
+	}
+
+	entries = malloc(PROFILE_ENTRIES * sizeof(*entries));
+	if (!entries) {
+		print("profile: out of memory");
+		return;
+	}
+
+	enter_critical_section();
+	memcpy(entries, profile.entries, PROFILE_ENTRIES * sizeof(*entries));
+	samples = profile.samples;
+	dropped = profile.dropped;
+	duration = profile.running ? current_time_hires() - profile.start
+				   : profile.duration;
+	exit_critical_section();
+
+	profile_sort(entries, PROFILE_ENTRIES);
+
+	snprintf(line, sizeof(line), "profile: %u samples, %u dropped in %llu ms%s",
+		 samples, dropped, duration / 1000, profile.running ? " (running)" : "");
+	print(line);
+	print("  count      %  pc         thread");
+
+	if (!count)
+		count = PROFILE_HIST_COUNT;
+	for (i = 0; i < PROFILE_ENTRIES && i < count && entries[i].count; i++) {
+		snprintf(line, sizeof(line), "%7u %3u.%u%%  0x%08lx %s",
+			 entries[i].count, entries[i].count * 100 / samples,
+			 entries[i].count * 1000 / samples % 10,
+			 (unsigned long)entries[i].pc,
+			 profile.threads[entries[i].thread].name);
+		print(line);
+	}
+
+	free(entries);
+}
+
+/**
+ * @brief  Print the samples as folded stacks for flamegraph.pl
+ *
+ * There are no frame pointers to unwind, so each stack is only the
+ * thread and the sampled PC.
+ */
+void profile_dump_folded(profile_print print)
+{
+	char line[PROFILE_LINE_SIZE];
+	struct profile_entry *e;
+	unsigned i;
+
+	if (!profile.entries) {
+		print("profile: not started");
+		return;
+	}
+
+	for (i = 0; i < PROFILE_ENTRIES; i++) {
+		e = &profile.entries[i];
+		if (!e->count)
+			continue;
+
+		snprintf(line, sizeof(line), "%s;0x%08lx %u",
+			 profile.threads[e->thread].name, (unsigned long)e->pc, e->count);
+		print(line);
+	}
+}
+
+status_t profile_command(const char *cmd, unsigned arg, profile_print print)
+{
+	status_t ret = NO_ERROR;
+
+	if (!strcmp(cmd, "start"))
+		ret = profile_start(arg);
+	else if (!strcmp(cmd, "stop"))
+		profile_stop();
+	else if (!strcmp(cmd, "threads"))
+		profile_dump_threads(print);
+	else if (!strcmp(cmd, "hist"))
+		profile_dump_hist(print, arg);
+	else if (!strcmp(cmd, "folded"))
+		profile_dump_folded(print);
+	else {
+		print("usage: profile start [ms]|stop|threads|hist [n]|folded");
+		ret = ERR_INVALID_ARGS;
+	}
+
+	return ret;
+}
+
+#if WITH_LIB_CONSOLE
+#include <lib/console.h>
+
+static void profile_print_console(const char *line)
+{
+	printf("%s\n", line);
+}
+
+static int cmd_profile(int argc, const cmd_args *argv)
+{
+	return profile_command(argc > 1 ? argv[1].str : "", argc > 2 ? argv[2].u : 0,
+			       profile_print_console);
+}
+
+STATIC_COMMAND_START
+	{ "profile", "sampling profiler and thread cpu usage", &cmd_profile },
+STATIC_COMMAND_END(profile);
+#endif
@@ -11,6 +11,7 @@ OBJS += \
 	$(LOCAL_DIR)/event.o \
 	$(LOCAL_DIR)/main.o \
 	$(LOCAL_DIR)/mutex.o \
+	$(LOCAL_DIR)/profile.o \
 	$(LOCAL_DIR)/thread.o \
 	$(LOCAL_DIR)/timer.o
 
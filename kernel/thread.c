@@ -72,8 +72,31 @@ static void thread_resched(void);
 static void idle_thread_routine(void) __NO_RETURN;
 
 #if PLATFORM_HAS_DYNAMIC_TIMER
-/* preemption timer */
+/* without a periodic tick the quantum is kept in ms, not in 10 ms ticks */
+#define THREAD_QUANTUM	50
+
+/* preemption timer, armed for the remaining quantum of the running thread */
 static timer_t preempt_timer;
+static time_t quantum_start;
+
+static enum handler_return thread_preempt_timer(timer_t *t, time_t now, void *arg)
+{
+	if (current_thread == idle_thread)
+		return INT_NO_RESCHEDULE;
+
+	current_thread->remaining_quantum = 0;
+	return INT_RESCHEDULE;
+}
+
+static void thread_arm_preempt_timer(thread_t *t)
+{
+	quantum_start = current_time();
+	timer_cancel(&preempt_timer);
+	timer_set_oneshot(&preempt_timer, t->remaining_quantum,
+			  thread_preempt_timer, NULL);
+}
+#else
+#define THREAD_QUANTUM	5
 #endif
 
 /* run queue manipulation */
@@ -86,6 +109,10 @@ static void insert_in_run_queue_head(thread_t *t)
 	ASSERT(in_critical_section());
 #endif
 
+#if THREAD_STATS
+	t->ready_timestamp = current_time_hires();
+#endif
+
 	list_add_head(&run_queue[t->priority], &t->queue_node);
 	run_queue_bitmap |= (1<<t->priority);
 }
@@ -99,6 +126,10 @@ static void insert_in_run_queue_tail(thread_t *t)
 	ASSERT(in_critical_section());
 #endif
 
+#if THREAD_STATS
+	t->ready_timestamp = current_time_hires();
+#endif
+
 	list_add_tail(&run_queue[t->priority], &t->queue_node);
 	run_queue_bitmap |= (1<<t->priority);
 }
@@ -333,24 +364,40 @@ void thread_resched(void)
 
 	newthread->state = THREAD_RUNNING;
 
-	if (newthread == oldthread)
-		return;
-
 	/* set up quantum for the new thread if it was consumed */
-	if (newthread->remaining_quantum <= 0) {
-		newthread->remaining_quantum = 5; // XXX make this smarter
+	bool new_quantum = newthread->remaining_quantum <= 0;
+	if (new_quantum) {
+		newthread->remaining_quantum = THREAD_QUANTUM; // XXX make this smarter
+	}
+
+	if (newthread == oldthread) {
+#if PLATFORM_HAS_DYNAMIC_TIMER
+		if (new_quantum && newthread != idle_thread)
+			thread_arm_preempt_timer(newthread);
+#endif
+		return;
 	}
 
 #if THREAD_STATS
+	bigtime_t now = current_time_hires();
+	bigtime_t wait = now - newthread->ready_timestamp;
+
 	thread_stats.context_switches++;
 
 	if (oldthread == idle_thread) {
-		bigtime_t now = current_time_hires();
 		thread_stats.idle_time += now - thread_stats.last_idle_timestamp;
 	}
 	if (newthread == idle_thread) {
-		thread_stats.last_idle_timestamp = current_time_hires();
+		thread_stats.last_idle_timestamp = now;
 	}
+
+	/* charge the old thread and account how long the new one was runnable */
+	oldthread->runtime += now - oldthread->last_run_timestamp;
+	newthread->last_run_timestamp = now;
+	newthread->context_switches++;
+	newthread->wait_time += wait;
+	if (wait > newthread->max_wait_time)
+		newthread->max_wait_time = wait;
 #endif
 
 #if THREAD_CHECKS
@@ -359,14 +406,17 @@ void thread_resched(void)
 #endif
 
 #if PLATFORM_HAS_DYNAMIC_TIMER
-	/* if we're switching from idle to a real thread, set up a periodic
-	 * timer to run our preemption tick.
+	/* there is no periodic tick, so charge the old thread for the time
+	 * it actually ran and only wake up again when the new thread's
+	 * quantum runs out. The idle thread runs without a preemption timer.
 	 */
-	if (oldthread == idle_thread) {
-		timer_set_periodic(&preempt_timer, 10, (timer_callback)thread_timer_tick, NULL);
-	} else if (newthread == idle_thread) {
+	if (oldthread != idle_thread)
+		oldthread->remaining_quantum -= current_time() - quantum_start;
+
+	if (newthread == idle_thread)
 		timer_cancel(&preempt_timer);
-	}
+	else
+		thread_arm_preempt_timer(newthread);
 #endif
 
 	/* do the switch */
@@ -432,8 +482,10 @@ void thread_preempt(void)
 	enter_critical_section();
 
 #if THREAD_STATS
-	if (current_thread != idle_thread)
+	if (current_thread != idle_thread) {
 		thread_stats.preempts++; /* only track when a meaningful preempt happens */
+		current_thread->preempts++;
+	}
 #endif
 
 	/* we are being preempted, so we get to go back into the front of the run queue if we have quantum left */
@@ -637,6 +689,44 @@ void dump_all_threads(void)
 	exit_critical_section();
 }
 
+#if THREAD_STATS
+/**
+ * @brief  Get the cpu accounting of all threads
+ *
+ * @param stats  Array to fill, one entry per thread
+ * @param count  Number of entries in stats
+ *
+ * @return  Number of threads, which may be more than count.
+ */
+int thread_get_cpu_stats(struct thread_cpu_stats *stats, int count)
+{
+	bigtime_t now;
+	thread_t *t;
+	int i = 0;
+
+	enter_critical_section();
+	now = current_time_hires();
+	list_for_every_entry(&thread_list, t, thread_t, thread_list_node) {
+		if (i < count) {
+			strlcpy(stats[i].name, t->name, sizeof(stats[i].name));
+			stats[i].priority = t->priority;
+			stats[i].state = t->state;
+			stats[i].runtime = t->runtime;
+			if (t == current_thread)
+				stats[i].runtime += now - t->last_run_timestamp;
+			stats[i].wait_time = t->wait_time;
+			stats[i].max_wait_time = t->max_wait_time;
+			stats[i].context_switches = t->context_switches;
+			stats[i].preempts = t->preempts;
+		}
+		i++;
+	}
+	exit_critical_section();
+
+	return i;
+}
+#endif
+
 /** @} */
 
 
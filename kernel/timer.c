@@ -35,13 +35,26 @@
  * @{
  */
 #include <debug.h>
+#include <err.h>
 #include <list.h>
+#include <malloc.h>
+#include <string.h>
 #include <kernel/thread.h>
 #include <kernel/timer.h>
 #include <platform/timer.h>
 #include <platform.h>
 
-static struct list_node timer_queue;
+#ifndef TIMER_HEAP_SIZE
+#define TIMER_HEAP_SIZE 64
+#endif
+
+/* pending timers, kept as a binary min-heap on scheduled_time.
+ * It starts out in static storage and moves to the heap once that is full.
+ */
+static timer_t *timer_heap_static[TIMER_HEAP_SIZE];
+static timer_t **timer_heap = timer_heap_static;
+static unsigned int timer_heap_size = TIMER_HEAP_SIZE;
+static unsigned int timer_count;
 
 static enum handler_return timer_tick(void *arg, time_t now);
 
@@ -51,28 +64,119 @@ static enum handler_return timer_tick(void *arg, time_t now);
 void timer_initialize(timer_t *timer)
 {
 	timer->magic = TIMER_MAGIC;
-	list_clear_node(&timer->node);
+	timer->heap_index = -1;
 	timer->scheduled_time = 0;
 	timer->periodic_time = 0;
 	timer->callback = 0;
 	timer->arg = 0;
 }
 
-static void insert_timer_in_queue(timer_t *timer)
+static inline bool timer_is_queued(timer_t *timer)
 {
-	timer_t *entry;
+	return timer->heap_index >= 0;
+}
 
-//	TRACEF("timer %p, scheduled %d, periodic %d\n", timer, timer->scheduled_time, timer->periodic_time);
+static inline timer_t *timer_queue_head(void)
+{
+	return timer_count ? timer_heap[0] : NULL;
+}
 
-	list_for_every_entry(&timer_queue, entry, timer_t, node) {
-		if (TIME_GT(entry->scheduled_time, timer->scheduled_time)) {
-			list_add_before(&entry->node, &timer->node);
-			return;
-		}
+static inline void timer_heap_place(unsigned int i, timer_t *timer)
+{
+	timer_heap[i] = timer;
+	timer->heap_index = i;
+}
+
+static void timer_heap_sift_up(unsigned int i)
+{
+	timer_t *timer = timer_heap[i];
+
+	while (i > 0) {
+		unsigned int parent = (i - 1) / 2;
+
+		if (!TIME_LT(timer->scheduled_time, timer_heap[parent]->scheduled_time))
+			break;
+
+		timer_heap_place(i, timer_heap[parent]);
+		i = parent;
+	}
+
+	timer_heap_place(i, timer);
+}
+
+static void timer_heap_sift_down(unsigned int i)
+{
+	timer_t *timer = timer_heap[i];
+
+	for (;;) {
+		unsigned int child = 2 * i + 1;
+
+		if (child >= timer_count)
+			break;
+
+		if (child + 1 < timer_count &&
+		    TIME_LT(timer_heap[child + 1]->scheduled_time, timer_heap[child]->scheduled_time))
+			child++;
+
+		if (!TIME_LT(timer_heap[child]->scheduled_time, timer->scheduled_time))
+			break;
+
+		timer_heap_place(i, timer_heap[child]);
+		i = child;
 	}
 
-	/* walked off the end of the list */
-	list_add_tail(&timer_queue, &timer->node);
+	timer_heap_place(i, timer);
+}
+
+static status_t timer_heap_grow(void)
+{
+	unsigned int size = timer_heap_size * 2;
+	timer_t **heap;
+
+	if (timer_heap == timer_heap_static) {
+		heap = malloc(size * sizeof(*heap));
+		if (heap)
+			memcpy(heap, timer_heap, timer_count * sizeof(*heap));
+	} else {
+		heap = realloc(timer_heap, size * sizeof(*heap));
+	}
+
+	if (!heap)
+		return ERR_NO_MEMORY;
+
+	timer_heap = heap;
+	timer_heap_size = size;
+	return NO_ERROR;
+}
+
+static status_t insert_timer_in_queue(timer_t *timer)
+{
+//	TRACEF("timer %p, scheduled %d, periodic %d\n", timer, timer->scheduled_time, timer->periodic_time);
+
+	if (timer_count == timer_heap_size && timer_heap_grow() < 0)
+		return ERR_NO_MEMORY;
+
+	timer_heap_place(timer_count, timer);
+	timer_heap_sift_up(timer_count++);
+	return NO_ERROR;
+}
+
+static void remove_timer_from_queue(timer_t *timer)
+{
+	unsigned int i = timer->heap_index;
+	timer_t *last;
+
+	timer->heap_index = -1;
+	last = timer_heap[--timer_count];
+	if (last == timer)
+		return;
+
+	/* move the last timer into the hole and restore the heap order */
+	timer_heap_place(i, last);
+	if (i > 0 && TIME_LT(last->scheduled_time, timer_heap[(i - 1) / 2]->scheduled_time))
+		timer_heap_sift_up(i);
+	else
+		timer_heap_sift_down(i);
 }
 
 static void timer_set(timer_t *timer, time_t delay, time_t period, timer_callback callback, void *arg)
@@ -83,7 +187,7 @@ static void timer_set(timer_t *timer, time_t delay, time_t period, timer_callbac
 
 	DEBUG_ASSERT(timer->magic == TIMER_MAGIC);	
 
-	if (list_in_list(&timer->node)) {
+	if (timer_is_queued(timer)) {
 		panic("timer %p already in list\n", timer);
 	}
 
@@ -97,10 +201,15 @@ static void timer_set(timer_t *timer, time_t delay, time_t period, timer_callbac
 
 	enter_critical_section();
 
-	insert_timer_in_queue(timer);
+	if (insert_timer_in_queue(timer) < 0) {
+		dprintf(CRITICAL, "timer %p not set, no memory for %u timers\n",
+			timer, timer_count + 1);
+		exit_critical_section();
+		return;
+	}
 
 #if PLATFORM_HAS_DYNAMIC_TIMER
-	if (list_peek_head_type(&timer_queue, timer_t, node) == timer) {
+	if (timer_queue_head() == timer) {
 		/* we just modified the head of the timer queue */
 //		TRACEF("setting new timer for %u msecs\n", (uint)delay);
 		platform_set_oneshot_timer(timer_tick, NULL, delay);
@@ -162,11 +271,11 @@ void timer_cancel(timer_t *timer)
 	enter_critical_section();
 
 #if PLATFORM_HAS_DYNAMIC_TIMER
-	timer_t *oldhead = list_peek_head_type(&timer_queue, timer_t, node);
+	timer_t *oldhead = timer_queue_head();
 #endif
 
-	if (list_in_list(&timer->node))
-		list_delete(&timer->node);
+	if (timer_is_queued(timer))
+		remove_timer_from_queue(timer);
 
 	/* to keep it from being reinserted into the queue if called from 
 	 * periodic timer callback.
@@ -177,7 +286,7 @@ void timer_cancel(timer_t *timer)
 
 #if PLATFORM_HAS_DYNAMIC_TIMER
 	/* see if we've just modified the head of the timer queue */
-	timer_t *newhead = list_peek_head_type(&timer_queue, timer_t, node);
+	timer_t *newhead = timer_queue_head();
 	if (newhead == NULL) {
 //		TRACEF("clearing old hw timer, nothing in the queue\n");
 		platform_stop_timer();
@@ -212,15 +321,13 @@ static enum handler_return timer_tick(void *arg, time_t now)
 
 	for (;;) {
 		/* see if there's an event to process */
-		timer = list_peek_head_type(&timer_queue, timer_t, node);
+		timer = timer_queue_head();
 		if (likely(!timer || TIME_LT(now, timer->scheduled_time)))
 			break;
 
 		/* process it */
 		DEBUG_ASSERT(timer->magic == TIMER_MAGIC);
-		list_delete(&timer->node);
-//		timer = list_remove_head_type(&timer_queue, timer_t, node);
-//		ASSERT(timer);
+		remove_timer_from_queue(timer);
 
 //		TRACEF("dequeued timer %p, scheduled %d periodic %d\n", timer, timer->scheduled_time, timer->periodic_time);
 
@@ -237,16 +344,17 @@ static enum handler_return timer_tick(void *arg, time_t now)
 		/* if it was a periodic timer and it hasn't been requeued
 		 * by the callback put it back in the list
 		 */
-		if (periodic && !list_in_list(&timer->node) && timer->periodic_time > 0) {
+		if (periodic && !timer_is_queued(timer) && timer->periodic_time > 0) {
 //			TRACEF("periodic timer, period %u\n", (uint)timer->periodic_time);
 			timer->scheduled_time = now + timer->periodic_time;
-			insert_timer_in_queue(timer);
+			if (insert_timer_in_queue(timer) < 0)
+				dprintf(CRITICAL, "periodic timer %p dropped, no memory\n", timer);
 		}
 	}
 
 #if PLATFORM_HAS_DYNAMIC_TIMER
 	/* reset the timer to the next event */
-	timer = list_peek_head_type(&timer_queue, timer_t, node);
+	timer = timer_queue_head();
 	if (timer) {
 		/* has to be the case or it would have fired already */
 		ASSERT(TIME_GT(timer->scheduled_time, now));
@@ -269,10 +377,12 @@ static enum handler_return timer_tick(void *arg, time_t now)
 
 void timer_init(void)
 {
-	list_initialize(&timer_queue);
+	timer_count = 0;
 
+#if !PLATFORM_HAS_DYNAMIC_TIMER
 	/* register for a periodic timer tick */
 	platform_set_periodic_timer(timer_tick, NULL, 10); /* 10ms */
+#endif
 }
 
 
@@ -26,17 +26,27 @@
 #include <string.h>
 #include <list.h>
 #include <lib/bio.h>
+#include <lib/fnv.h>
 #include <kernel/mutex.h>
 
 #define LOCAL_TRACE 0
 
+/* devices are also hashed by name so bio_open() does not walk the whole list */
+#define BDEV_HASH_SIZE 64
+
 struct bdev_struct {
 	struct list_node list;
+	struct list_node hash[BDEV_HASH_SIZE];
 	mutex_t lock;
 };
 
 static struct bdev_struct *bdevs;
 
+static struct list_node *bdev_hash_bucket(const char *name)
+{
+	return &bdevs->hash[fnv1a_hash(name, strlen(name)) % BDEV_HASH_SIZE];
+}
+
 /* default implementation is to use the read_block hook to 'deblock' the device */
 static ssize_t bio_default_read(struct bdev *dev, void *_buf, off_t offset, size_t len)
 {
@@ -253,7 +263,7 @@ bdev_t *bio_open(const char *name)
 	/* see if it's in our list */
 	bdev_t *entry;
 	mutex_acquire(&bdevs->lock);
-	list_for_every_entry(&bdevs->list, entry, bdev_t, node) {
+	list_for_every_entry(bdev_hash_bucket(name), entry, bdev_t, hash_node) {
 		DEBUG_ASSERT(entry->ref > 0);
 		if (!strcmp(entry->name, name)) {
 			bdev = entry;
@@ -410,6 +420,7 @@ void bio_register_device(bdev_t *dev)
 
 	mutex_acquire(&bdevs->lock);
 	list_add_head(&bdevs->list, &dev->node);
+	list_add_head(bdev_hash_bucket(dev->name), &dev->hash_node);
 	mutex_release(&bdevs->lock);
 }
 
@@ -422,6 +433,7 @@ void bio_unregister_device(bdev_t *dev)
 	// remove it from the list
 	mutex_acquire(&bdevs->lock);
 	list_delete(&dev->node);
+	list_delete(&dev->hash_node);
 	mutex_release(&bdevs->lock);
 
 	bdev_dec_ref(dev); // remove the ref the list used to have
@@ -440,9 +452,13 @@ void bio_dump_devices(void)
 
 void bio_init(void)
 {
+	int i;
+
 	bdevs = malloc(sizeof(*bdevs));
 
 	list_initialize(&bdevs->list);
+	for (i = 0; i < BDEV_HASH_SIZE; i++)
+		list_initialize(&bdevs->hash[i]);
 	mutex_init(&bdevs->lock);
 }
 
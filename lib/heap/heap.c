@@ -71,6 +71,7 @@ struct heap {
 
 // heap static vars
 static struct heap theheap;
+static unsigned int heap_allocs;
 
 // structure placed at the beginning every allocation
 struct alloc_struct_begin {
@@ -92,6 +93,7 @@ static void heap_dump(void)
 {
 	dprintf(INFO, "Heap dump:\n");
 	dprintf(INFO, "\tbase %p, len 0x%zx\n", theheap.base, theheap.len);
+	dprintf(INFO, "\tallocations: %u\n", heap_allocs);
 	dprintf(INFO, "\tfree list:\n");
 
 	struct free_heap_chunk *chunk;
@@ -343,11 +345,20 @@ void *heap_alloc(size_t size, unsigned int alignment)
 
 //	heap_dump();
 
+	if (ptr)
+		heap_allocs++;
+
 	exit_critical_section();
 
 	return ptr;
 }
 
+/* Number of successful allocations since boot, for benchmarks */
+unsigned int heap_alloc_count(void)
+{
+	return heap_allocs;
+}
+
 void *heap_realloc(void *ptr, size_t size)
 {
 	void * tmp_ptr = NULL;
@@ -0,0 +1,329 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * LZ4 frame decoder, see lz4_Frame_format.md and lz4_Block_format.md in
+ * https://github.com/lz4/lz4/tree/dev/doc
+ */
+#include <debug.h>
+#include <err.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lib/lz4.h>
+
+#define LZ4_FRAME_MAGIC		0x184D2204
+#define LZ4_FRAME_HEADER_LEN	7
+#define LZ4_WINDOW		(64 * 1024)
+
+#define LZ4_FLG_VERSION_MASK	0xc0
+#define LZ4_FLG_VERSION		0x40
+#define LZ4_FLG_BLOCK_INDEP	(1 << 5)
+#define LZ4_FLG_BLOCK_CHECKSUM	(1 << 4)
+#define LZ4_FLG_CONTENT_SIZE	(1 << 3)
+#define LZ4_FLG_CONTENT_CHECKSUM	(1 << 2)
+#define LZ4_FLG_DICT_ID		(1 << 0)
+
+#define LZ4_BD_BLOCK_MAX(bd)	(((bd) >> 4) & 7)
+#define LZ4_BLOCK_UNCOMPRESSED	(1U << 31)
+
+static uint32_t lz4_get_le32(const unsigned char *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/* xxHash32, used for all checksums in the frame, with seed 0 */
+#define XXH_PRIME32_1		0x9e3779b1U
+#define XXH_PRIME32_2		0x85ebca77U
+#define XXH_PRIME32_3		0xc2b2ae3dU
+#define XXH_PRIME32_4		0x27d4eb2fU
+#define XXH_PRIME32_5		0x165667b1U
+
+struct xxh32_state {
+	uint32_t v[4];
+	uint32_t total;
+	bool large;
+	unsigned char mem[16];
+	unsigned int mem_len;
+};
+
+static uint32_t xxh32_rotl(uint32_t x, unsigned int r)
+{
+	return x << r | x >> (32 - r);
+}
+
+static uint32_t xxh32_round(uint32_t acc, uint32_t input)
+{
+	return xxh32_rotl(acc + input * XXH_PRIME32_2, 13) * XXH_PRIME32_1;
+}
+
+static void xxh32_init(struct xxh32_state *s)
+{
+	memset(s, 0, sizeof(*s));
+	s->v[0] = XXH_PRIME32_1 + XXH_PRIME32_2;
+	s->v[1] = XXH_PRIME32_2;
+	s->v[3] = -XXH_PRIME32_1;
+}
+
+static void xxh32_stripe(struct xxh32_state *s, const unsigned char *p)
+{
+	s->v[0] = xxh32_round(s->v[0], lz4_get_le32(p));
+	s->v[1] = xxh32_round(s->v[1], lz4_get_le32(p + 4));
+	s->v[2] = xxh32_round(s->v[2], lz4_get_le32(p + 8));
+	s->v[3] = xxh32_round(s->v[3], lz4_get_le32(p + 12));
+}
+
+static void xxh32_update(struct xxh32_state *s, const unsigned char *p,
+			 unsigned int len)
+{
+	unsigned int n;
+
+	s->total += len;
+	s->large |= len >= 16 || s->total >= 16;
+
+	if (s->mem_len) {
+		n = MIN(len, 16 - s->mem_len);
+		memcpy(s->mem + s->mem_len, p, n);
+		s->mem_len += n;
+		p += n;
+		len -= n;
+		if (s->mem_len < 16)
+			return;
+		xxh32_stripe(s, s->mem);
+		s->mem_len = 0;
+	}
+
+	for (; len >= 16; p += 16, len -= 16)
+		xxh32_stripe(s, p);
+
+	memcpy(s->mem, p, len);
+	s->mem_len = len;
+}
+
+static uint32_t xxh32_digest(const struct xxh32_state *s)
+{
+	const unsigned char *p = s->mem, *end = s->mem + s->mem_len;
+	uint32_t h;
+
+	if (s->large)
+		h = xxh32_rotl(s->v[0], 1) + xxh32_rotl(s->v[1], 7) +
+		    xxh32_rotl(s->v[2], 12) + xxh32_rotl(s->v[3], 18);
+	else
+		h = XXH_PRIME32_5;
+	h += s->total;
+
+	for (; end - p >= 4; p += 4)
+		h = xxh32_rotl(h + lz4_get_le32(p) * XXH_PRIME32_3, 17) * XXH_PRIME32_4;
+	for (; p < end; p++)
+		h = xxh32_rotl(h + *p * XXH_PRIME32_5, 11) * XXH_PRIME32_1;
+
+	h ^= h >> 15;
+	h *= XXH_PRIME32_2;
+	h ^= h >> 13;
+	h *= XXH_PRIME32_3;
+	h ^= h >> 16;
+	return h;
+}
+
+static uint32_t xxh32(const unsigned char *p, unsigned int len)
+{
+	struct xxh32_state s;
+
+	xxh32_init(&s);
+	xxh32_update(&s, p, len);
+	return xxh32_digest(&s);
+}
+
+bool is_lz4_frame(const unsigned char *buf, unsigned int len)
+{
+	return len >= LZ4_FRAME_HEADER_LEN && lz4_get_le32(buf) == LZ4_FRAME_MAGIC;
+}
+
+static int lz4_read_length(const unsigned char **ip, const unsigned char *iend,
+			   unsigned int *len)
+{
+	do {
+		if (*ip == iend)
+			return ERR_NOT_VALID;
+		*len += **ip;
+	} while (*(*ip)++ == 255);
+
+	return NO_ERROR;
+}
+
+/* Decode one block to dst, matches may reach back as far as window */
+static int lz4_decompress_block(const unsigned char *src, unsigned int src_len,
+				unsigned char *dst, unsigned int dst_len,
+				const unsigned char *window)
+{
+	const unsigned char *ip = src, *iend = src + src_len;
+	unsigned char *op = dst, *oend = dst + dst_len;
+	const unsigned char *match;
+	unsigned int token, len, offset;
+
+	while (ip < iend) {
+		token = *ip++;
+
+		len = token >> 4;
+		if (len == 15 && lz4_read_length(&ip, iend, &len))
+			return ERR_NOT_VALID;
+		if (len > (unsigned int)(iend - ip) || len > (unsigned int)(oend - op))
+			return ERR_NOT_VALID;
+		memcpy(op, ip, len);
+		ip += len;
+		op += len;
+
+		/* the last sequence only has literals */
+		if (ip == iend)
+			break;
+
+		if (iend - ip < 2)
+			return ERR_NOT_VALID;
+		offset = ip[0] | ip[1] << 8;
+		ip += 2;
+		if (!offset || offset > (unsigned int)(op - window))
+			return ERR_NOT_VALID;
+
+		len = token & 15;
+		if (len == 15 && lz4_read_length(&ip, iend, &len))
+			return ERR_NOT_VALID;
+		len += 4;
+		if (len > (unsigned int)(oend - op))
+			return ERR_NOT_VALID;
+
+		match = op - offset;
+		if (offset >= len) {
+			memcpy(op, match, len);
+			op += len;
+		} else {
+			/* overlapping matches repeat the last offset bytes */
+			while (len--)
+				*op++ = *match++;
+		}
+	}
+
+	return op - dst;
+}
+
+int lz4_decompress_stream(const unsigned char *in, unsigned int in_len,
+			  unsigned char *buf, unsigned int buf_len,
+			  lz4_write_t write, void *arg,
+			  unsigned long long *out_len)
+{
+	const unsigned char *ip, *iend = in + in_len;
+	unsigned int flg, block_max, block_size, len;
+	unsigned int fill = 0, flushed = 0, discard;
+	unsigned long long total = 0;
+	struct xxh32_state content;
+	int ret;
+
+	if (!is_lz4_frame(in, in_len))
+		return ERR_NOT_VALID;
+
+	flg = in[4];
+	if ((flg & LZ4_FLG_VERSION_MASK) != LZ4_FLG_VERSION || (flg & LZ4_FLG_DICT_ID) ||
+	    LZ4_BD_BLOCK_MAX(in[5]) < 4) {
+		dprintf(INFO, "lz4: unsupported frame descriptor %#x %#x\n", flg, in[5]);
+		return ERR_NOT_SUPPORTED;
+	}
+
+	/* 4: 64 KiB, 5: 256 KiB, 6: 1 MiB, 7: 4 MiB */
+	block_max = 1 << (8 + 2 * LZ4_BD_BLOCK_MAX(in[5]));
+	if (buf_len < LZ4_WINDOW + 2 * LZ4_STREAM_ALIGN + block_max) {
+		dprintf(INFO, "lz4: %u byte buffer is too small for %u byte blocks\n",
+			buf_len, block_max);
+		return ERR_NO_MEMORY;
+	}
+
+	/* the header checksum is the second byte of the descriptor's hash */
+	ip = in + LZ4_FRAME_HEADER_LEN - 1;
+	if (flg & LZ4_FLG_CONTENT_SIZE)
+		ip += 8;
+	if (ip >= iend || *ip != ((xxh32(in + 4, ip - in - 4) >> 8) & 0xff)) {
+		dprintf(INFO, "lz4: frame descriptor checksum mismatch\n");
+		return ERR_NOT_VALID;
+	}
+	ip++;
+
+	xxh32_init(&content);
+
+	for (;;) {
+		if (iend - ip < 4)
+			return ERR_NOT_VALID;
+		block_size = lz4_get_le32(ip);
+		ip += 4;
+
+		if (!block_size)
+			break;
+
+		len = block_size & ~LZ4_BLOCK_UNCOMPRESSED;
+		if (len > block_max || len > (unsigned int)(iend - ip))
+			return ERR_NOT_VALID;
+
+		if (flg & LZ4_FLG_BLOCK_CHECKSUM) {
+			if ((unsigned int)(iend - ip) - len < 4 ||
+			    xxh32(ip, len) != lz4_get_le32(ip + len)) {
+				dprintf(INFO, "lz4: block checksum mismatch at %u\n",
+					(unsigned int)(ip - in));
+				return ERR_NOT_VALID;
+			}
+		}
+
+		/*
+		 * Pass on the aligned part of the output and drop what is no
+		 * longer needed as window. Only whole multiples of the
+		 * alignment are dropped, so the chunks stay aligned in memory.
+		 */
+		if (fill + block_max > buf_len) {
+			discard = (fill - flushed) & ~(LZ4_STREAM_ALIGN - 1);
+			xxh32_update(&content, buf + flushed, discard);
+			ret = write(arg, buf + flushed, discard);
+			if (ret)
+				return ret;
+			total += discard;
+			flushed += discard;
+
+			discard = fill > LZ4_WINDOW ? fill - LZ4_WINDOW : 0;
+			discard = MIN(discard, flushed) & ~(LZ4_STREAM_ALIGN - 1);
+			memmove(buf, buf + discard, fill - discard);
+			fill -= discard;
+			flushed -= discard;
+		}
+
+		if (block_size & LZ4_BLOCK_UNCOMPRESSED) {
+			memcpy(buf + fill, ip, len);
+			ret = len;
+		} else {
+			ret = lz4_decompress_block(ip, len, buf + fill, block_max,
+						   flg & LZ4_FLG_BLOCK_INDEP ? buf + fill : buf);
+			if (ret < 0) {
+				dprintf(INFO, "lz4: corrupted block at %u\n",
+					(unsigned int)(ip - in));
+				return ret;
+			}
+		}
+
+		fill += ret;
+		ip += len;
+		if (flg & LZ4_FLG_BLOCK_CHECKSUM)
+			ip += 4;
+	}
+
+	if (fill > flushed) {
+		xxh32_update(&content, buf + flushed, fill - flushed);
+		ret = write(arg, buf + flushed, fill - flushed);
+		if (ret)
+			return ret;
+		total += fill - flushed;
+	}
+
+	/* only known once everything has been passed on to write */
+	if (flg & LZ4_FLG_CONTENT_CHECKSUM) {
+		if (iend - ip < 4 || xxh32_digest(&content) != lz4_get_le32(ip)) {
+			dprintf(INFO, "lz4: content checksum mismatch\n");
+			return ERR_NOT_VALID;
+		}
+	}
+
+	if (out_len)
+		*out_len = total;
+
+	return NO_ERROR;
+}
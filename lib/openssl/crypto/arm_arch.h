@@ -0,0 +1,12 @@
+#ifndef __ARM_ARCH_H__
+#define __ARM_ARCH_H__
+
+/*
+ * Bits in OPENSSL_armcap_P, set up by OPENSSL_cpuid_setup() in armcap.c
+ * and tested by the assembler modules to pick an implementation.
+ */
+#define ARMV7_NEON	(1<<0)
+#define ARMV8_SHA1	(1<<3)
+#define ARMV8_SHA256	(1<<4)
+
+#endif
@@ -0,0 +1,30 @@
+#include "arm_arch.h"
+
+unsigned int OPENSSL_armcap_P;
+
+/*
+ * There is no SIGILL to probe with, so read the feature registers directly.
+ * ID_ISAR5 is RAZ on ARMv7 cores, the SHA fields are only non-zero on ARMv8
+ * cores with the Cryptography Extensions (e.g. Cortex-A53 in AArch32 state).
+ * The ARMv8 code uses NEON registers, which arch_context_switch() saves
+ * and restores for every thread.
+ */
+void OPENSSL_cpuid_setup(void)
+	{
+	static int trigger=0;
+
+	if (trigger) return;
+	trigger=1;
+
+#if ARM_ISA_ARMV7 && ARM_WITH_NEON
+	unsigned int isar5;
+
+	OPENSSL_armcap_P |= ARMV7_NEON;
+
+	__asm__ volatile("mrc p15, 0, %0, c0, c2, 5" : "=r" (isar5));
+	if (((isar5 >> 8) & 0xf) == 1)
+		OPENSSL_armcap_P |= ARMV8_SHA1;
+	if (((isar5 >> 12) & 0xf) == 1)
+		OPENSSL_armcap_P |= ARMV8_SHA256;
+#endif
+	}
@@ -2,6 +2,7 @@ LOCAL_DIR:= $(GET_LOCAL_DIR)
 
 #Additional flags already in android-config.mk
 CFLAGS += -DOPENSSL_BN_ASM_MONT -DAES_ASM -DSHA1_ASM -DSHA256_ASM -DSHA512_ASM \
+	-DOPENSSL_CPUID_OBJ \
 	-DOPENSSL_NO_STDIO -DOPENSSL_NO_FP_API -DNO_WINDOWS_BRAINDEATH \
 	-DOPENSSL_IMPLEMENTS_strncasecmp -DOPENSSL_NO_DSA -DOPENSSL_NO_DH \
 	-DGETPID_IS_MEANINGLESS -DOPENSSL_NO_EC -DOPENSSL_NO_DES
@@ -19,6 +20,7 @@ OBJS +=  $(LOCAL_DIR)/bn/asm/armv4-mont.o
 
 OBJS += \
 	$(LOCAL_DIR)/bio/b_print.o \
+	$(LOCAL_DIR)/armcap.o \
 	$(LOCAL_DIR)/cryptlib.o \
 	$(LOCAL_DIR)/mem.o \
 	$(LOCAL_DIR)/mem_clr.o \
@@ -316,7 +318,9 @@ OBJS += \
 	$(LOCAL_DIR)/x509v3/v3err.o \
 	$(LOCAL_DIR)/x509v3/v3_utl.o \
 	$(LOCAL_DIR)/sha/asm/sha1-armv4-large.o \
-	$(LOCAL_DIR)/sha/asm/sha256-armv4.o
+	$(LOCAL_DIR)/sha/asm/sha1-armv8.o \
+	$(LOCAL_DIR)/sha/asm/sha256-armv4.o \
+	$(LOCAL_DIR)/sha/asm/sha256-armv8.o
 
 include $(LOCAL_PATH)/android-config.mk
 
@@ -122,8 +122,11 @@ void sha1_block_data_order (SHA_CTX *c, const void *p,size_t num);
 #define INIT_DATA_h3 0x10325476UL
 #define INIT_DATA_h4 0xc3d2e1f0UL
 
+void OPENSSL_cpuid_setup(void);
+
 int HASH_INIT (SHA_CTX *c)
 	{
+	OPENSSL_cpuid_setup();
 	memset (c,0,sizeof(*c));
 	c->h0=INIT_DATA_h0;
 	c->h1=INIT_DATA_h1;
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: GPL-2.0-only
+
+#include <arch/defines.h>
+#include <debug.h>
+#include <err.h>
+#include <list.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lib/partition.h>
+
+#include "gpt.h"
+
+#define GPT_HEADER_SIZE		92
+#define GPT_LBA			1
+
+/*
+ * Cache of the GPT parsed by partition_publish(), so the platform
+ * partition table code does not need to read and validate it again.
+ */
+struct gpt_cache_entry {
+	struct list_node node;
+	char device[32];
+	struct gpt_table gpt;
+};
+
+static struct list_node gpt_cache = LIST_INITIAL_VALUE(gpt_cache);
+
+static const uint32_t gpt_crc32_table[16] = {
+	0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+	0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+	0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+	0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+};
+
+static uint32_t gpt_crc32(const uint8_t *buf, size_t len)
+{
+	uint32_t crc = 0xffffffff;
+
+	while (len--) {
+		crc ^= *buf++;
+		crc = (crc >> 4) ^ gpt_crc32_table[crc & 0xf];
+		crc = (crc >> 4) ^ gpt_crc32_table[crc & 0xf];
+	}
+
+	return ~crc;
+}
+
+/*
+ * Validate the GPT header in buf that was read from header_lba.
+ * Returns the LBA of the partition entry array or 0 if the header is invalid.
+ */
+static uint64_t gpt_parse_header(uint8_t *buf, uint64_t header_lba,
+				 uint32_t block_size, uint64_t block_count,
+				 struct gpt_table *gpt)
+{
+	uint32_t header_size, crc, array_blocks;
+	uint64_t entries_lba;
+
+	if (GET_LWORD_FROM_BYTE(&buf[0]) != GPT_SIGNATURE_2 ||
+	    GET_LWORD_FROM_BYTE(&buf[4]) != GPT_SIGNATURE_1)
+		return 0;
+
+	header_size = GET_LWORD_FROM_BYTE(&buf[HEADER_SIZE_OFFSET]);
+	if (header_size < GPT_HEADER_SIZE || header_size > block_size) {
+		dprintf(CRITICAL, "GPT: Invalid header size: %u\n", header_size);
+		return 0;
+	}
+
+	/* The CRC is calculated with the CRC field itself set to zero */
+	crc = GET_LWORD_FROM_BYTE(&buf[HEADER_CRC_OFFSET]);
+	PUT_LONG(&buf[HEADER_CRC_OFFSET], 0);
+	if (gpt_crc32(buf, header_size) != crc) {
+		dprintf(CRITICAL, "GPT: Header crc mismatch\n");
+		return 0;
+	}
+	PUT_LONG(&buf[HEADER_CRC_OFFSET], crc);
+
+	if (GET_LLWORD_FROM_BYTE(&buf[PRIMARY_HEADER_OFFSET]) != header_lba) {
+		dprintf(CRITICAL, "GPT: Header LBA mismatch\n");
+		return 0;
+	}
+
+	gpt->first_usable_lba = GET_LLWORD_FROM_BYTE(&buf[FIRST_USABLE_LBA_OFFSET]);
+	gpt->last_usable_lba = GET_LLWORD_FROM_BYTE(&buf[LAST_USABLE_LBA_OFFSET]);
+	gpt->entry_count = GET_LWORD_FROM_BYTE(&buf[PARTITION_COUNT_OFFSET]);
+	gpt->entry_size = GET_LWORD_FROM_BYTE(&buf[PENTRY_SIZE_OFFSET]);
+	gpt->entries_crc = GET_LWORD_FROM_BYTE(&buf[PARTITION_CRC_OFFSET]);
+	entries_lba = GET_LLWORD_FROM_BYTE(&buf[PARTITION_ENTRIES_OFFSET]);
+
+	if (gpt->first_usable_lba > block_count ||
+	    gpt->last_usable_lba > block_count) {
+		dprintf(CRITICAL, "GPT: Invalid usable LBA range\n");
+		return 0;
+	}
+
+	if (gpt->entry_size != ENTRY_SIZE ||
+	    gpt->entry_count > MIN_PARTITION_ARRAY_SIZE / ENTRY_SIZE) {
+		dprintf(CRITICAL, "GPT: Invalid partition entry array\n");
+		return 0;
+	}
+
+	array_blocks = ROUNDUP(gpt->entry_count * gpt->entry_size, block_size) / block_size;
+	if (entries_lba < 2 || entries_lba + array_blocks > block_count) {
+		dprintf(CRITICAL, "GPT: Invalid partition entry LBA\n");
+		return 0;
+	}
+
+	return entries_lba;
+}
+
+/*
+ * Load and validate the header at header_lba and its partition entry array.
+ * buf has room for one header block followed by the largest entry array.
+ * If prefetched is set, buf already contains the header and the blocks
+ * following it, so the common layout of the primary GPT needs no more reads.
+ */
+static int gpt_load(gpt_read_fn read, void *cookie, uint8_t *buf,
+		    uint32_t block_size, uint64_t block_count,
+		    uint64_t header_lba, bool prefetched, struct gpt_table *gpt)
+{
+	uint8_t *entries = buf + block_size;
+	uint64_t entries_lba;
+	uint32_t array_size;
+
+	if (!prefetched && read(cookie, header_lba * block_size, buf, block_size))
+		return ERR_IO;
+
+	entries_lba = gpt_parse_header(buf, header_lba, block_size, block_count, gpt);
+	if (!entries_lba)
+		return ERR_NOT_VALID;
+
+	array_size = ROUNDUP(gpt->entry_count * gpt->entry_size, block_size);
+	if (!prefetched || entries_lba != header_lba + 1) {
+		if (read(cookie, entries_lba * block_size, entries, array_size))
+			return ERR_IO;
+	}
+
+	if (gpt_crc32(entries, gpt->entry_count * gpt->entry_size) != gpt->entries_crc) {
+		dprintf(CRITICAL, "GPT: Partition entries crc mismatch\n");
+		return ERR_NOT_VALID;
+	}
+
+	gpt->header = buf;
+	gpt->entries = entries;
+	gpt->backup = (header_lba != GPT_LBA);
+	return 0;
+}
+
+int gpt_read_table(gpt_read_fn read, void *cookie, uint32_t block_size,
+		   uint64_t block_count, struct gpt_table *gpt)
+{
+	size_t len = block_size + ROUNDUP(MIN_PARTITION_ARRAY_SIZE, block_size);
+	uint8_t *buf;
+	int ret;
+
+	memset(gpt, 0, sizeof(*gpt));
+	if (block_count <= GPT_LBA)
+		return ERR_NOT_VALID;
+
+	buf = memalign(CACHE_LINE, ROUNDUP(len, CACHE_LINE));
+	if (!buf) {
+		dprintf(CRITICAL, "GPT: Failed to allocate memory\n");
+		return ERR_NO_MEMORY;
+	}
+
+	/* The primary entry array normally follows the header, read both at once */
+	ret = read(cookie, GPT_LBA * block_size, buf, len);
+	if (!ret)
+		ret = gpt_load(read, cookie, buf, block_size, block_count,
+			       GPT_LBA, true, gpt);
+	if (!ret)
+		return 0;
+
+	dprintf(INFO, "GPT: (WARNING) Primary GPT invalid, trying backup\n");
+	ret = gpt_load(read, cookie, buf, block_size, block_count,
+		       block_count - 1, false, gpt);
+	if (!ret)
+		return 0;
+
+	dprintf(CRITICAL, "GPT: Primary and backup GPT invalid\n");
+	free(buf);
+	memset(gpt, 0, sizeof(*gpt));
+	return ret;
+}
+
+void gpt_free_table(struct gpt_table *gpt)
+{
+	free(gpt->header);
+	memset(gpt, 0, sizeof(*gpt));
+}
+
+void gpt_get_entry(const struct gpt_table *gpt, unsigned int index,
+		   struct gpt_entry *entry)
+{
+	const uint8_t *raw = gpt->entries + index * gpt->entry_size;
+	unsigned int n;
+
+	memcpy(entry->type_guid, raw, sizeof(entry->type_guid));
+	memcpy(entry->unique_guid, raw + UNIQUE_GUID_OFFSET, sizeof(entry->unique_guid));
+	entry->first_lba = GET_LLWORD_FROM_BYTE(&raw[FIRST_LBA_OFFSET]);
+	entry->last_lba = GET_LLWORD_FROM_BYTE(&raw[LAST_LBA_OFFSET]);
+	entry->attributes = GET_LLWORD_FROM_BYTE(&raw[ATTRIBUTE_FLAG_OFFSET]);
+
+	/*
+	 * Currently partition names in *.xml are UTF-8 and lowercase
+	 * Only supporting english for now so removing 2nd byte of UTF-16
+	 */
+	for (n = 0; n < sizeof(entry->name) - 1; n++)
+		entry->name[n] = raw[PARTITION_NAME_OFFSET + n * 2];
+	entry->name[n] = 0;
+}
+
+static struct gpt_cache_entry *gpt_cache_find(const char *device)
+{
+	struct gpt_cache_entry *entry;
+
+	list_for_every_entry(&gpt_cache, entry, struct gpt_cache_entry, node) {
+		if (!strcmp(entry->device, device))
+			return entry;
+	}
+
+	return NULL;
+}
+
+void partition_cache_gpt(const char *device, struct gpt_table *gpt)
+{
+	struct gpt_cache_entry *entry;
+
+	partition_forget_gpt(device);
+
+	entry = malloc(sizeof(*entry));
+	if (!entry) {
+		gpt_free_table(gpt);
+		return;
+	}
+
+	strlcpy(entry->device, device, sizeof(entry->device));
+	entry->gpt = *gpt;
+	list_add_tail(&gpt_cache, &entry->node);
+}
+
+const struct gpt_table *partition_get_gpt(const char *device)
+{
+	struct gpt_cache_entry *entry = gpt_cache_find(device);
+
+	return entry ? &entry->gpt : NULL;
+}
+
+void partition_forget_gpt(const char *device)
+{
+	struct gpt_cache_entry *entry = gpt_cache_find(device);
+
+	if (!entry)
+		return;
+
+	list_delete(&entry->node);
+	gpt_free_table(&entry->gpt);
+	free(entry);
+}
@@ -48,11 +48,12 @@ struct mbr_part {
 	uint32_t lba_length;
 } __PACKED;
 
-struct gpt_header {
-	uint64_t first_usable_lba;
-	uint32_t partition_entry_size;
-	uint32_t header_size;
-	uint32_t max_partition_count;
+/* 4 MBR entries plus the largest GPT entry array gpt_read_table() accepts */
+#define PARTITION_MAX_SUBDEVICES	(4 + MIN_PARTITION_ARRAY_SIZE / ENTRY_SIZE)
+
+struct gpt_bio_reader {
+	bdev_t *dev;
+	off_t offset;
 };
 
 static status_t validate_mbr_partition(bdev_t *dev, const struct mbr_part *part)
@@ -75,27 +76,13 @@ static status_t validate_mbr_partition(bdev_t *dev, const struct mbr_part *part)
 	return 0;
 }
 
-/*
- * Parse the gpt header and get the required header fields
- * Return 0 on valid signature
- */
-static unsigned int
-partition_parse_gpt_header(unsigned char *buffer, struct gpt_header* header)
+static int partition_gpt_read(void *cookie, uint64_t offset, void *buf, size_t len)
 {
-	/* Check GPT Signature */
-	if (((uint32_t *) buffer)[0] != GPT_SIGNATURE_2 ||
-	    ((uint32_t *) buffer)[1] != GPT_SIGNATURE_1)
-		return 1;
-
-	header->header_size = GET_LWORD_FROM_BYTE(&buffer[HEADER_SIZE_OFFSET]);
-	header->first_usable_lba =
-	    GET_LLWORD_FROM_BYTE(&buffer[FIRST_USABLE_LBA_OFFSET]);
-	header->max_partition_count =
-	    GET_LWORD_FROM_BYTE(&buffer[PARTITION_COUNT_OFFSET]);
-	header->partition_entry_size =
-	    GET_LWORD_FROM_BYTE(&buffer[PENTRY_SIZE_OFFSET]);
+	struct gpt_bio_reader *reader = cookie;
+	ssize_t ret;
 
-	return 0;
+	ret = bio_read(reader->dev, buf, reader->offset + offset, len);
+	return (ret == (ssize_t)len) ? 0 : -1;
 }
 
 int partition_publish(const char *device, off_t offset)
@@ -117,7 +104,7 @@ int partition_publish(const char *device, off_t offset)
 	
 	/* sniff for MBR partition types */
 	do {
-		unsigned int i, j, n;
+		unsigned int i;
 		int gpt_partitions_exist = 0;
 
 		err = bio_read(dev, buf, offset, 512);
@@ -166,101 +153,51 @@ int partition_publish(const char *device, off_t offset)
 		dprintf(INFO, "found GPT\n");
 		dev->is_gpt = true;
 
-		err = bio_read(dev, buf, offset + dev->block_size, dev->block_size);
-		if (err < 0)
-			goto err;
-
-		struct gpt_header gpthdr;
-		err = partition_parse_gpt_header(buf, &gpthdr);
-		if (err) {
-			/* Check the backup gpt */
+		struct gpt_bio_reader reader = { dev, offset };
+		struct gpt_table gpt;
+		struct gpt_entry entry;
 
-			uint64_t backup_header_lba = dev->block_count - 1;
-			err = bio_read(dev, buf, (backup_header_lba * dev->block_size), dev->block_size);
-			if (err < 0) {
-				dprintf(CRITICAL, "GPT: Could not read backup gpt from mmc\n");
-				break;
-			}
+		err = gpt_read_table(partition_gpt_read, &reader, dev->block_size,
+				     dev->block_count - offset / dev->block_size, &gpt);
+		if (err < 0)
+			break;
 
-			err = partition_parse_gpt_header(buf, &gpthdr);
-			if (err) {
-				dprintf(CRITICAL, "GPT: Primary and backup signatures invalid\n");
+		for (i = 0; i < gpt.entry_count; i++) {
+			gpt_get_entry(&gpt, i, &entry);
+			if (entry.type_guid[0] == 0 && entry.type_guid[1] == 0)
 				break;
-			}
-		}
 
-		uint32_t part_entry_cnt = dev->block_size / ENTRY_SIZE;
-		uint64_t partition_0 = GET_LLWORD_FROM_BYTE(&buf[PARTITION_ENTRIES_OFFSET]);
-		/* Read GPT Entries */
-		for (i = 0; i < (ROUNDUP(gpthdr.max_partition_count, part_entry_cnt)) / part_entry_cnt; i++) {
-			err = bio_read(dev, buf, offset + (partition_0 * dev->block_size) + (i * dev->block_size),
-							dev->block_size);
+			char subdevice[128];
+			sprintf(subdevice, "%sp%d", device, count+1);
 
+			err = bio_publish_subdevice(device, subdevice, entry.first_lba,
+						    entry.last_lba - entry.first_lba + 1);
 			if (err < 0) {
-				dprintf(CRITICAL,
-					"GPT: mmc read card failed reading partition entries.\n");
-				break;
+				dprintf(INFO, "error publishing subdevice '%s'\n", entry.name);
+				continue;
 			}
 
-			for (j = 0; j < part_entry_cnt; j++) {
-				unsigned char type_guid[PARTITION_TYPE_GUID_SIZE];
-				unsigned char name[MAX_GPT_NAME_SIZE];
-				unsigned char UTF16_name[MAX_GPT_NAME_SIZE];
-				uint64_t first_lba, last_lba, size;
-
-				// guid
-				memcpy(&type_guid,
-			       &buf[(j * gpthdr.partition_entry_size)],
-			       PARTITION_TYPE_GUID_SIZE);
-				if (type_guid[0]==0 && type_guid[1]==0) {
-					i = ROUNDUP(gpthdr.max_partition_count, part_entry_cnt);
-					break;
-				}
-
-				// size
-				first_lba = GET_LLWORD_FROM_BYTE(&buf[(j * gpthdr.partition_entry_size) + FIRST_LBA_OFFSET]);
-				last_lba = GET_LLWORD_FROM_BYTE(&buf[(j * gpthdr.partition_entry_size) + LAST_LBA_OFFSET]);
-				size = last_lba - first_lba + 1;
-
-				// name
-				memset(&UTF16_name, 0x00, MAX_GPT_NAME_SIZE);
-				memcpy(UTF16_name, &buf[(j * gpthdr.partition_entry_size) +
-					PARTITION_NAME_OFFSET], MAX_GPT_NAME_SIZE);
-
-				/*
-				 * Currently partition names in *.xml are UTF-8 and lowercase
-				 * Only supporting english for now so removing 2nd byte of UTF-16
-				 */
-				for (n = 0; n < MAX_GPT_NAME_SIZE / 2; n++) {
-					name[n] = UTF16_name[n * 2];
-				}
-
-				//dprintf(CRITICAL, "got part '%s' size=%llu!\n", name, size);
-				char subdevice[128];
-				sprintf(subdevice, "%sp%d", device, count+1);
-
-				err = bio_publish_subdevice(device, subdevice, first_lba, size);
-				if (err < 0) {
-					dprintf(INFO, "error publishing subdevice '%s'\n", name);
-					continue;
-				}
+			bdev_t *partdev = bio_open(subdevice);
+			partdev->label = strdup(entry.name);
+			partdev->is_gpt = true;
 
-				bdev_t *partdev = bio_open(subdevice);
-				partdev->label = strdup((char*)name);
-				partdev->is_gpt = true;
+			/* Some linux distros make use of subpartitions.
+			 * Scan some devices recursively to publish them. */
+			if (strcmp(entry.name, "system") == 0
+			    || strcmp(entry.name, "userdata") == 0
+			    || strcmp(entry.name, "rootfs") == 0
+			    || strcmp(entry.name, "MainOS") == 0
+			    || strcmp(entry.name, "Data") == 0)
+				partition_publish(subdevice, 0);
 
-				/* Some linux distros make use of subpartitions.
-				 * Scan some devices recursively to publish them. */
-				if (strcmp(name, "system") == 0
-				    || strcmp(name, "userdata") == 0
-				    || strcmp(name, "rootfs") == 0
-				    || strcmp(name, "MainOS") == 0
-				    || strcmp(name, "Data") == 0)
-					partition_publish(subdevice, 0);
-
-				count++;
-			}
+			count++;
 		}
+
+		/* Keep the validated table around for the platform partition code */
+		if (offset == 0)
+			partition_cache_gpt(device, &gpt);
+		else
+			gpt_free_table(&gpt);
 	} while(0);
 
 	bio_close(dev);
@@ -276,14 +213,20 @@ int partition_unpublish(const char *device)
 	bdev_t *dev;
 	char devname[512];	
 
+	partition_forget_gpt(device);
+
 	count = 0;
-	for (i=0; i < 16; i++) {
+	for (i=0; i < PARTITION_MAX_SUBDEVICES; i++) {
 		sprintf(devname, "%sp%d", device, i);
 
 		dev = bio_open(devname);
 		if (!dev)
 			continue;
 
+		/* GPT partitions may have been scanned for subpartitions */
+		if (dev->is_gpt)
+			partition_unpublish(devname);
+
 		bio_unregister_device(dev);
 		bio_close(dev);
 		count++;
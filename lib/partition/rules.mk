@@ -3,4 +3,5 @@ LOCAL_DIR := $(GET_LOCAL_DIR)
 MODULES += lib/bio
 
 OBJS += \
+	$(LOCAL_DIR)/gpt.o \
 	$(LOCAL_DIR)/partition.o
@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Android sparse image writer, split out of aboot's "fastboot flash" so
+ * the chunk parsing can be exercised without an eMMC partition.
+ */
+#include <arch/defines.h>
+#include <debug.h>
+#include <err.h>
+#include <limits.h>
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lib/sparse.h>
+#if WITH_LIB_WORKPOOL
+#include <lib/workpool.h>
+#endif
+
+/* FILL chunks are written in runs of up to this many bytes */
+#define SPARSE_FILL_BUF_SIZE	(1024 * 1024)
+#define SPARSE_FILL_JOBS	4
+
+struct sparse_fill_job {
+#if WITH_LIB_WORKPOOL
+	struct work work;
+#endif
+	uint32_t *buf;
+	uint32_t words;
+	uint32_t val;
+};
+
+static void sparse_fill_work(void *arg)
+{
+	struct sparse_fill_job *job = arg;
+	uint32_t i;
+
+	for (i = 0; i < job->words; i++)
+		job->buf[i] = job->val;
+}
+
+/* Fill the pattern buffer, split up between the SMP workers if there are any */
+static void sparse_fill_buf(uint32_t *buf, uint32_t len, uint32_t val)
+{
+	struct sparse_fill_job jobs[SPARSE_FILL_JOBS];
+	uint32_t words = len / sizeof(uint32_t);
+	uint32_t slice, start;
+	int i;
+
+	/* Keep the slices in separate cache lines */
+	slice = ROUNDUP(words / SPARSE_FILL_JOBS + 1, CACHE_LINE / sizeof(uint32_t));
+
+	for (i = 0; i < SPARSE_FILL_JOBS; i++) {
+		start = MIN(i * slice, words);
+		jobs[i].buf = buf + start;
+		jobs[i].words = MIN(slice, words - start);
+		jobs[i].val = val;
+#if WITH_LIB_WORKPOOL
+		work_init(&jobs[i].work, sparse_fill_work, &jobs[i]);
+		work_queue(&jobs[i].work);
+#else
+		sparse_fill_work(&jobs[i]);
+#endif
+	}
+
+#if WITH_LIB_WORKPOOL
+	for (i = 0; i < SPARSE_FILL_JOBS; i++)
+		work_wait(&jobs[i].work);
+#endif
+}
+
+int sparse_write(const struct sparse_dest *dest, void *data, unsigned sz,
+		 const char **err)
+{
+	unsigned int chunk;
+	unsigned int chunk_data_sz;
+	uint32_t *fill_buf = NULL;
+	uint32_t fill_val;
+	uint32_t chunk_blk_cnt = 0;
+	uint32_t blk_sz_actual = 0;
+	uint32_t fill_blks, fill_cnt;
+	sparse_header_t *sparse_header;
+	chunk_header_t *chunk_header;
+	uint32_t total_blocks = 0;
+	uint64_t size = dest->size;
+	uint32_t i;
+	/*End of the sparse image address*/
+	uint32_t data_end = (uint32_t)data + sz;
+
+	if (sz < sizeof(sparse_header_t)) {
+		*err = "size too low";
+		return ERR_NOT_VALID;
+	}
+
+	/* Read and skip over sparse image header */
+	sparse_header = (sparse_header_t *) data;
+
+	if (!sparse_header->blk_sz || (sparse_header->blk_sz % 4)){
+		*err = "Invalid block size\n";
+		return ERR_NOT_VALID;
+	}
+
+	if (((uint64_t)sparse_header->total_blks * (uint64_t)sparse_header->blk_sz) > size) {
+		*err = "size too large";
+		return ERR_NOT_VALID;
+	}
+
+	data += sizeof(sparse_header_t);
+
+	if (data_end < (uint32_t)data) {
+		*err = "buffer overreads occured due to invalid sparse header";
+		return ERR_NOT_VALID;
+	}
+
+	if(sparse_header->file_hdr_sz != sizeof(sparse_header_t))
+	{
+		*err = "sparse header size mismatch";
+		return ERR_NOT_VALID;
+	}
+
+	dprintf (SPEW, "=== Sparse Image Header ===\n");
+	dprintf (SPEW, "magic: 0x%x\n", sparse_header->magic);
+	dprintf (SPEW, "major_version: 0x%x\n", sparse_header->major_version);
+	dprintf (SPEW, "minor_version: 0x%x\n", sparse_header->minor_version);
+	dprintf (SPEW, "file_hdr_sz: %d\n", sparse_header->file_hdr_sz);
+	dprintf (SPEW, "chunk_hdr_sz: %d\n", sparse_header->chunk_hdr_sz);
+	dprintf (SPEW, "blk_sz: %d\n", sparse_header->blk_sz);
+	dprintf (SPEW, "total_blks: %d\n", sparse_header->total_blks);
+	dprintf (SPEW, "total_chunks: %d\n", sparse_header->total_chunks);
+
+	/* Start processing chunks */
+	for (chunk=0; chunk<sparse_header->total_chunks; chunk++)
+	{
+		/* Make sure the total image size does not exceed the partition size */
+		if(((uint64_t)total_blocks * (uint64_t)sparse_header->blk_sz) >= size) {
+			*err = "size too large";
+			return ERR_NOT_VALID;
+		}
+		/* Read and skip over chunk header */
+		chunk_header = (chunk_header_t *) data;
+		data += sizeof(chunk_header_t);
+
+		if (data_end < (uint32_t)data) {
+			*err = "buffer overreads occured due to invalid sparse header";
+			return ERR_NOT_VALID;
+		}
+
+		dprintf (SPEW, "=== Chunk Header ===\n");
+		dprintf (SPEW, "chunk_type: 0x%x\n", chunk_header->chunk_type);
+		dprintf (SPEW, "chunk_data_sz: 0x%x\n", chunk_header->chunk_sz);
+		dprintf (SPEW, "total_size: 0x%x\n", chunk_header->total_sz);
+
+		if(sparse_header->chunk_hdr_sz != sizeof(chunk_header_t))
+		{
+			*err = "chunk header size mismatch";
+			return ERR_NOT_VALID;
+		}
+
+		chunk_data_sz = sparse_header->blk_sz * chunk_header->chunk_sz;
+
+		switch (chunk_header->chunk_type)
+		{
+			case CHUNK_TYPE_RAW:
+			/* Make sure multiplication does not overflow uint32 size */
+			if (sparse_header->blk_sz && (chunk_header->chunk_sz != chunk_data_sz / sparse_header->blk_sz))
+			{
+			  *err = "Bogus size sparse and chunk header";
+			  return ERR_NOT_VALID;
+			}
+
+			/* Make sure that the chunk size calculated from sparse image does not
+			 * exceed partition size
+			 */
+			if ((uint64_t)total_blocks * (uint64_t)sparse_header->blk_sz + chunk_data_sz > size)
+			{
+			  *err = "Chunk data size exceeds partition size";
+			  return ERR_NOT_VALID;
+			}
+
+			if(chunk_header->total_sz != (sparse_header->chunk_hdr_sz +
+											chunk_data_sz))
+			{
+				*err = "Bogus chunk size for chunk type Raw";
+				return ERR_NOT_VALID;
+			}
+
+			if (data_end < (uint32_t)data + chunk_data_sz) {
+				*err = "buffer overreads occured due to invalid sparse header";
+				return ERR_NOT_VALID;
+			}
+
+			if(dest->write(dest->arg, (uint64_t)total_blocks*sparse_header->blk_sz,
+						data, chunk_data_sz))
+			{
+				*err = "flash write failure";
+				return ERR_IO;
+			}
+			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz)) {
+				*err = "Bogus size for RAW chunk type";
+				return ERR_NOT_VALID;
+			}
+			total_blocks += chunk_header->chunk_sz;
+			data += chunk_data_sz;
+			break;
+
+			case CHUNK_TYPE_FILL:
+			if(chunk_header->total_sz != (sparse_header->chunk_hdr_sz +
+											sizeof(uint32_t)))
+			{
+				*err = "Bogus chunk size for chunk type FILL";
+				return ERR_NOT_VALID;
+			}
+
+			chunk_blk_cnt = chunk_data_sz / sparse_header->blk_sz;
+
+			/* Write as many blocks at once as fit in the fill buffer */
+			fill_blks = MIN(chunk_blk_cnt, SPARSE_FILL_BUF_SIZE / sparse_header->blk_sz);
+			if (!fill_blks)
+				fill_blks = 1;
+
+			blk_sz_actual = ROUNDUP(fill_blks * sparse_header->blk_sz, CACHE_LINE);
+			/* Integer overflow detected */
+			if (blk_sz_actual < sparse_header->blk_sz)
+			{
+				*err = "Invalid block size";
+				return ERR_NOT_VALID;
+			}
+
+			fill_buf = (uint32_t *)memalign(CACHE_LINE, blk_sz_actual);
+			if (!fill_buf)
+			{
+				*err = "Malloc failed for: CHUNK_TYPE_FILL";
+				return ERR_NO_MEMORY;
+			}
+
+			if (data_end < (uint32_t)data + sizeof(uint32_t)) {
+				free(fill_buf);
+				*err = "buffer overreads occured due to invalid sparse header";
+				return ERR_NOT_VALID;
+			}
+			fill_val = *(uint32_t *)data;
+			data = (char *) data + sizeof(uint32_t);
+
+			sparse_fill_buf(fill_buf, fill_blks * sparse_header->blk_sz, fill_val);
+
+			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz))
+			{
+				free(fill_buf);
+				*err = "bogus size for chunk FILL type";
+				return ERR_NOT_VALID;
+			}
+
+			for (i = 0; i < chunk_blk_cnt; i += fill_cnt)
+			{
+				fill_cnt = MIN(fill_blks, chunk_blk_cnt - i);
+
+				/* Make sure that the data written to partition does not exceed partition size */
+				if ((uint64_t)total_blocks * (uint64_t)sparse_header->blk_sz +
+				    (uint64_t)fill_cnt * sparse_header->blk_sz > size)
+				{
+					free(fill_buf);
+					*err = "Chunk data size for fill type exceeds partition size";
+					return ERR_NOT_VALID;
+				}
+
+				if(dest->write(dest->arg, (uint64_t)total_blocks*sparse_header->blk_sz,
+							fill_buf, fill_cnt * sparse_header->blk_sz))
+				{
+					free(fill_buf);
+					*err = "flash write failure";
+					return ERR_IO;
+				}
+
+				total_blocks += fill_cnt;
+			}
+
+			free(fill_buf);
+			break;
+
+			case CHUNK_TYPE_DONT_CARE:
+			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz)) {
+				*err = "bogus size for chunk DONT CARE type";
+				return ERR_NOT_VALID;
+			}
+			total_blocks += chunk_header->chunk_sz;
+			break;
+
+			case CHUNK_TYPE_CRC:
+			if(chunk_header->total_sz != sparse_header->chunk_hdr_sz)
+			{
+				*err = "Bogus chunk size for chunk type Dont Care";
+				return ERR_NOT_VALID;
+			}
+			if(total_blocks > (UINT_MAX - chunk_header->chunk_sz)) {
+				*err = "bogus size for chunk CRC type";
+				return ERR_NOT_VALID;
+			}
+			total_blocks += chunk_header->chunk_sz;
+			if ((uint32_t)data > UINT_MAX - chunk_data_sz) {
+				*err = "integer overflow occured";
+				return ERR_NOT_VALID;
+			}
+			data += chunk_data_sz;
+			if (data_end < (uint32_t)data) {
+				*err = "buffer overreads occured due to invalid sparse header";
+				return ERR_NOT_VALID;
+			}
+			break;
+
+			default:
+			dprintf(CRITICAL, "Unkown chunk type: %x\n",chunk_header->chunk_type);
+			*err = "Unknown chunk type";
+			return ERR_NOT_VALID;
+		}
+	}
+
+	dprintf(INFO, "Wrote %d blocks, expected to write %d blocks\n",
+					total_blocks, sparse_header->total_blks);
+
+	if(total_blocks != sparse_header->total_blks)
+	{
+		*err = "sparse image write failure";
+		return ERR_NOT_VALID;
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <arch/defines.h>
+#include <debug.h>
+#include <kernel/thread.h>
+#include <lib/workpool.h>
+
+enum {
+	WORK_IDLE,
+	WORK_QUEUED,
+	WORK_RUNNING,
+	WORK_DONE,
+};
+
+static struct list_node work_list = LIST_INITIAL_VALUE(work_list);
+static volatile int work_lock;
+static volatile int workers_online;
+static volatile int workers_stop;
+
+/*
+ * The worker CPUs do not know anything about the LK kernel, so the queue is
+ * protected by a plain spin lock. On CPU0 interrupts are additionally
+ * disabled while holding it to avoid being preempted with the lock held.
+ */
+static inline void work_spin_lock(void)
+{
+#if ARM_ISA_ARMV7
+	int tmp;
+
+	__asm__ volatile(
+		"1:	ldrex	%0, [%1]\n"
+		"	cmp	%0, #0\n"
+		"	bne	1b\n"
+		"	strex	%0, %2, [%1]\n"
+		"	cmp	%0, #0\n"
+		"	bne	1b\n"
+		: "=&r" (tmp)
+		: "r" (&work_lock), "r" (1)
+		: "cc", "memory");
+	dmb();
+#endif
+}
+
+static inline void work_spin_unlock(void)
+{
+#if ARM_ISA_ARMV7
+	dmb();
+	work_lock = 0;
+	dsb();
+	__asm__ volatile("sev" ::: "memory");
+#endif
+}
+
+static inline void work_wait_event(void)
+{
+#if ARM_ISA_ARMV7
+	__asm__ volatile("wfe" ::: "memory");
+#endif
+}
+
+static inline void work_signal_event(void)
+{
+#if ARM_ISA_ARMV7
+	dsb();
+	__asm__ volatile("sev" ::: "memory");
+#endif
+}
+
+static struct work *work_dequeue(void)
+{
+	struct work *work;
+
+	work_spin_lock();
+	work = list_remove_head_type(&work_list, struct work, node);
+	if (work)
+		work->state = WORK_RUNNING;
+	work_spin_unlock();
+
+	return work;
+}
+
+static void work_run(struct work *work)
+{
+	work->cb(work->arg);
+
+	dmb();
+	work->state = WORK_DONE;
+	work_signal_event();
+}
+
+void work_init(struct work *work, work_callback cb, void *arg)
+{
+	list_clear_node(&work->node);
+	work->cb = cb;
+	work->arg = arg;
+	work->state = WORK_IDLE;
+}
+
+void work_queue(struct work *work)
+{
+	ASSERT(work->state != WORK_QUEUED && work->state != WORK_RUNNING);
+
+	enter_critical_section();
+	work_spin_lock();
+	work->state = WORK_QUEUED;
+	list_add_tail(&work_list, &work->node);
+	work_spin_unlock();
+	exit_critical_section();
+}
+
+void work_wait(struct work *work)
+{
+	struct work *next;
+
+	ASSERT(work->state != WORK_IDLE);
+
+	while (work->state != WORK_DONE) {
+		/* Help with the queue instead of waiting idle */
+		enter_critical_section();
+		next = work_dequeue();
+		exit_critical_section();
+
+		if (next)
+			work_run(next);
+		else if (work->state != WORK_DONE)
+			work_wait_event();
+	}
+	dmb();
+}
+
+void workpool_worker(void)
+{
+	struct work *work;
+
+	work_spin_lock();
+	workers_online++;
+	work_spin_unlock();
+
+	while (!workers_stop) {
+		work = work_dequeue();
+		if (work)
+			work_run(work);
+		else
+			work_wait_event();
+	}
+
+	work_spin_lock();
+	workers_online--;
+	work_spin_unlock();
+}
+
+void workpool_stop(void)
+{
+	workers_stop = 1;
+	work_signal_event();
+
+	while (workers_online)
+		work_wait_event();
+}
+
+int workpool_num_workers(void)
+{
+	return workers_online;
+}
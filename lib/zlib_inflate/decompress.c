@@ -30,9 +30,10 @@
 
 #include "zutil.h"
 
-#ifdef DYNAMIC_CRC_TABLE
+/* slicing-by-4 tables for the gzip trailer CRC, see crc32.c */
+#define BYFOUR
+#define TBLS 8
 #include "crc32.h"
-#endif
 
 #include "zconf.h"
 #include "zlib.h"
@@ -47,6 +48,12 @@
 
 #define GZIP_HEADER_LEN 10
 #define GZIP_FILENAME_LIMIT 256
+#define GZIP_TRAILER_LEN 8
+
+#define GZIP_FHCRC	0x02
+#define GZIP_FEXTRA	0x04
+#define GZIP_FNAME	0x08
+#define GZIP_FCOMMENT	0x10
 
 static void zlib_free(voidpf qpaque, void *addr)
 {
@@ -58,6 +65,31 @@ static void *zlib_alloc(voidpf qpaque, uInt items, size_t size)
 	return malloc(items * size);
 }
 
+/* CRC-32 as in the gzip trailer, crc32_little() from crc32.c */
+static uint32_t gzip_crc32(uint32_t crc, const unsigned char *buf, unsigned int len)
+{
+	const uint32_t *buf4;
+
+	crc = ~crc;
+	while (len && ((uintptr_t)buf & 3)) {
+		crc = crc_table[0][(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+		len--;
+	}
+
+	buf4 = (const uint32_t *)buf;
+	for (; len >= 4; len -= 4) {
+		crc ^= *buf4++;
+		crc = crc_table[3][crc & 0xff] ^ crc_table[2][(crc >> 8) & 0xff] ^
+		      crc_table[1][(crc >> 16) & 0xff] ^ crc_table[0][crc >> 24];
+	}
+
+	buf = (const unsigned char *)buf4;
+	while (len--)
+		crc = crc_table[0][(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+
+	return ~crc;
+}
+
 /* decompress gzip file "in_buf", return 0 if decompressed successful,
  * return -1 if decompressed failed.
  * in_buf - input gzip file
@@ -138,6 +170,141 @@ gunzip_end:
 	return rc; /* returns 0 if decompressed successful */
 }
 
+/* return the length of the gzip header in "buf", 0 if it is truncated */
+static unsigned int gzip_header_len(unsigned char *buf, unsigned int len)
+{
+	unsigned int pos = GZIP_HEADER_LEN;
+	unsigned char flags = buf[3];
+
+	if (flags & GZIP_FEXTRA) {
+		if (pos + 2 > len)
+			return 0;
+		pos += 2 + (buf[pos] | buf[pos + 1] << 8);
+	}
+	if (flags & GZIP_FNAME) {
+		while (pos < len && buf[pos])
+			pos++;
+		pos++;
+	}
+	if (flags & GZIP_FCOMMENT) {
+		while (pos < len && buf[pos])
+			pos++;
+		pos++;
+	}
+	if (flags & GZIP_FHCRC)
+		pos += 2;
+
+	return pos < len ? pos : 0;
+}
+
+/* decompress gzip file "in_buf" in chunks, so the decompressed data does
+ * not need to fit in memory. return 0 if decompressed successful, -1 if
+ * decompression failed, or the error returned by "write".
+ * in_buf - input gzip file
+ * in_len - input the length file
+ * out_buf - buffer for the chunks, at least 2 * DECOMPRESS_STREAM_ALIGN
+ * out_buf_len - the length of out_buf
+ * write - called for each chunk, with a multiple of DECOMPRESS_STREAM_ALIGN
+ *         bytes except for the last one
+ * out_len - the length of decompressed data
+ */
+int decompress_stream(unsigned char *in_buf, unsigned int in_len,
+		      unsigned char *out_buf, unsigned int out_buf_len,
+		      decompress_write_t write, void *arg,
+		      unsigned long long *out_len)
+{
+	struct z_stream_s *stream;
+	unsigned int hdr_len, fill = 0, len;
+	unsigned long long total = 0;
+	unsigned char *trailer;
+	uint32_t crc = 0;
+	int rc = -1;
+
+	if (!is_gzip_package(in_buf, in_len) ||
+	    out_buf_len < 2 * DECOMPRESS_STREAM_ALIGN)
+		return rc;
+
+	hdr_len = gzip_header_len(in_buf, in_len);
+	if (!hdr_len || in_len - hdr_len < GZIP_TRAILER_LEN) {
+		dprintf(INFO, "header error\n");
+		return rc;
+	}
+
+	stream = malloc(sizeof(*stream));
+	if (stream == NULL) {
+		dprintf(INFO, "allocating z_stream failed.\n");
+		return rc;
+	}
+
+	stream->zalloc = zlib_alloc;
+	stream->zfree = zlib_free;
+	stream->next_in = in_buf + hdr_len;
+	stream->avail_in = in_len - hdr_len - GZIP_TRAILER_LEN;
+
+	rc = inflateInit2(stream, -MAX_WBITS);
+	if (rc != Z_OK) {
+		dprintf(INFO, "inflateInit2 failed!\n");
+		rc = -1;
+		goto gunzip_end;
+	}
+
+	for (;;) {
+		stream->next_out = out_buf + fill;
+		stream->avail_out = out_buf_len - fill;
+		rc = inflate(stream, Z_NO_FLUSH);
+		fill = stream->next_out - out_buf;
+
+		if (rc == Z_STREAM_END) {
+			crc = gzip_crc32(crc, out_buf, fill);
+			rc = fill ? write(arg, out_buf, fill) : 0;
+			total += fill;
+			break;
+		}
+
+		/* a full output buffer is the only reason to stop early */
+		if (rc != Z_OK || stream->avail_out) {
+			dprintf(INFO, "uncompression error \n");
+			rc = -1;
+			break;
+		}
+
+		/* keep the unaligned tail for the next chunk */
+		len = fill & ~(DECOMPRESS_STREAM_ALIGN - 1);
+		crc = gzip_crc32(crc, out_buf, len);
+		rc = write(arg, out_buf, len);
+		if (rc)
+			break;
+		total += len;
+		memmove(out_buf, out_buf + len, fill - len);
+		fill -= len;
+	}
+
+	/*
+	 * The trailer has the CRC-32 and the length modulo 2^32 of the data.
+	 * They can only be checked after everything has been written.
+	 */
+	trailer = stream->next_in;
+	if (!rc && (trailer[0] | trailer[1] << 8 | trailer[2] << 16 |
+		    (uint32_t)trailer[3] << 24) != crc) {
+		dprintf(INFO, "gzip crc mismatch\n");
+		rc = -1;
+	}
+	if (!rc && (trailer[4] | trailer[5] << 8 | trailer[6] << 16 |
+		    (uint32_t)trailer[7] << 24) != (uint32_t)total) {
+		dprintf(INFO, "gzip size mismatch\n");
+		rc = -1;
+	}
+
+	if (out_len)
+		*out_len = total;
+
+	inflateEnd(stream);
+
+gunzip_end:
+	free(stream);
+	return rc;
+}
+
 /* check if the input "buf" file was a gzip package.
  * Return true if the input "buf" is a gzip package.
  */
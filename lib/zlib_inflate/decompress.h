@@ -32,4 +32,14 @@
 int is_gzip_package(unsigned char *, unsigned int);
 
 int decompress(unsigned char *, unsigned int, unsigned char *, unsigned int, unsigned int *, unsigned int *);
+
+/* decompress_stream() passes the output on in multiples of this size */
+#define DECOMPRESS_STREAM_ALIGN	4096
+
+typedef int (*decompress_write_t)(void *arg, unsigned char *buf, unsigned int len);
+
+int decompress_stream(unsigned char *in_buf, unsigned int in_len,
+		      unsigned char *out_buf, unsigned int out_buf_len,
+		      decompress_write_t write, void *arg,
+		      unsigned long long *out_len);
 #endif /* __PLATFORM_MSM_SHARED_DECOMPRESS_H */
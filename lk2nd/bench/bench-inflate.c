@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Input for the inflate benchmark, generated with:
+ * python3 -c 'import gzip, sys; sys.stdout.buffer.write(gzip.compress("".join(
+ *	"lk2nd bench %04u %08x\n" % (i, (i * 2654435761) & 0xffffffff)
+ *	for i in range(372)).encode(), 9, mtime=0))' | xxd -i
+ */
+
+const unsigned int bench_inflate_size = 9672;
+const unsigned int bench_inflate_gz_size = 2929;
+const unsigned char bench_inflate_gz[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x9a,
+	0x4b, 0x8e, 0x2c, 0xb7, 0x0e, 0x44, 0xe7, 0x5e, 0x05, 0x97, 0x20, 0x91,
+	0x14, 0x45, 0x2d, 0x47, 0x5f, 0x18, 0xb0, 0xe1, 0xfd, 0x0f, 0x1d, 0xf5,
+	0x9c, 0x93, 0x17, 0x3d, 0xb8, 0xb8, 0x68, 0xf6, 0x27, 0x2b, 0x8f, 0x92,
+	0x3c, 0xac, 0xe8, 0xbf, 0xff, 0xd2, 0x7f, 0x8e, 0xac, 0xfb, 0xcf, 0xfe,
+	0x53, 0x0a, 0x3e, 0xfe, 0xf7, 0xcf, 0xef, 0xe3, 0x8f, 0xbf, 0xff, 0xbf,
+	0x52, 0x65, 0x5c, 0xeb, 0x7d, 0xac, 0xca, 0x15, 0x15, 0xdb, 0x71, 0x9f,
+	0x85, 0x72, 0xc5, 0xe4, 0xcc, 0x19, 0x71, 0xaa, 0x71, 0xc5, 0xa5, 0xe7,
+	0x39, 0x37, 0xb6, 0x73, 0xa5, 0x49, 0xed, 0xb5, 0x45, 0xe9, 0x8d, 0x2b,
+	0x21, 0xab, 0xf9, 0x3e, 0x53, 0x83, 0x2b, 0x5d, 0x9a, 0xa5, 0x37, 0x3b,
+	0x9d, 0x2b, 0x29, 0xaf, 0xae, 0xb5, 0x4f, 0x26, 0x57, 0x86, 0xe4, 0x7b,
+	0xe6, 0xdd, 0x06, 0x55, 0x6a, 0x11, 0xbd, 0x3a, 0x77, 0xb9, 0x93, 0x2b,
+	0x55, 0xf6, 0x0e, 0xb5, 0x39, 0x16, 0x57, 0x54, 0x62, 0x8e, 0xb1, 0xdc,
+	0x37, 0x57, 0x4c, 0x4a, 0x9e, 0xaa, 0xe7, 0x1d, 0xae, 0xb8, 0xcc, 0x5e,
+	0x72, 0xf6, 0x79, 0xb9, 0xd2, 0xc4, 0x9b, 0x17, 0xad, 0xed, 0x71, 0x25,
+	0xe4, 0x83, 0xc0, 0x7c, 0x6a, 0x97, 0xac, 0xf3, 0x55, 0xdf, 0xcc, 0xa7,
+	0xa6, 0xd4, 0x77, 0x23, 0x6f, 0x67, 0x3e, 0x75, 0xe0, 0xbf, 0xf5, 0x96,
+	0x54, 0xe6, 0xa3, 0x45, 0xda, 0x6e, 0x2d, 0xeb, 0x61, 0x3e, 0x5a, 0xe5,
+	0xcd, 0xdc, 0x6f, 0x25, 0xf3, 0x51, 0x95, 0x91, 0xdb, 0x7b, 0x33, 0xe6,
+	0xa3, 0x26, 0x16, 0x6f, 0xdd, 0x7b, 0x99, 0x8f, 0xba, 0x9c, 0x66, 0x16,
+	0x39, 0x98, 0x8f, 0x36, 0xe9, 0x16, 0xf3, 0xaa, 0x33, 0x1f, 0x0d, 0xa9,
+	0x75, 0x6a, 0x5b, 0x8f, 0xf9, 0x68, 0x97, 0xf9, 0xce, 0x38, 0x6d, 0x32,
+	0x1f, 0x4d, 0xf1, 0x5b, 0xab, 0xbf, 0xc6, 0x7c, 0x74, 0xc8, 0xdd, 0x9e,
+	0x7b, 0x14, 0xe6, 0x63, 0x45, 0x72, 0x66, 0x71, 0x5d, 0xcc, 0xc7, 0xaa,
+	0x68, 0xae, 0xbe, 0x76, 0x30, 0x1f, 0x53, 0xf9, 0x1e, 0x05, 0xe6, 0x63,
+	0x26, 0xd1, 0x34, 0x70, 0x7d, 0xcc, 0xc7, 0x5c, 0x8a, 0xb5, 0xab, 0x23,
+	0x99, 0x8f, 0x35, 0x99, 0x75, 0xb4, 0x69, 0xc6, 0x7c, 0x2c, 0xc4, 0xde,
+	0x3e, 0x75, 0x5f, 0xe6, 0x63, 0x5d, 0xce, 0x2d, 0x3e, 0x62, 0x30, 0x1f,
+	0x4b, 0xe9, 0xdb, 0x76, 0x2d, 0xce, 0x7c, 0x6c, 0x48, 0x9d, 0xdd, 0x72,
+	0x3c, 0xe6, 0xe3, 0x45, 0x56, 0xce, 0x55, 0x6c, 0x32, 0x1f, 0xaf, 0xd2,
+	0xe2, 0x6a, 0x3f, 0x8d, 0xf9, 0xb8, 0xca, 0x6b, 0x15, 0x3f, 0xab, 0x30,
+	0x1f, 0x37, 0x19, 0xd6, 0x6a, 0x2f, 0x8b, 0xf9, 0xb8, 0x8b, 0xd5, 0xcc,
+	0x3b, 0x83, 0xf9, 0x78, 0x93, 0xfd, 0x76, 0x09, 0xaf, 0xcc, 0xc7, 0x43,
+	0xe2, 0xbc, 0x7e, 0xce, 0x66, 0x3e, 0xde, 0xa5, 0x6c, 0x7d, 0xad, 0x77,
+	0xe6, 0xe3, 0x29, 0x5f, 0x43, 0x62, 0x3e, 0x3e, 0xc4, 0x73, 0x5c, 0x9f,
+	0x97, 0xf9, 0xb4, 0x22, 0x37, 0x4e, 0xdb, 0x3e, 0x98, 0x4f, 0xab, 0x92,
+	0xad, 0x1c, 0xbb, 0xce, 0x7c, 0x9a, 0x8a, 0x9a, 0xfb, 0xea, 0x8f, 0xf9,
+	0x34, 0x93, 0x5d, 0xc1, 0xa1, 0x4e, 0xe6, 0xd3, 0x5c, 0xda, 0x5b, 0x36,
+	0x57, 0x63, 0x3e, 0xad, 0xc9, 0x3b, 0x77, 0x69, 0x2b, 0xcc, 0xa7, 0x85,
+	0x8c, 0xad, 0x3a, 0xee, 0x62, 0x3e, 0xad, 0x8b, 0xcd, 0x36, 0x6b, 0x06,
+	0xf3, 0x69, 0x29, 0x27, 0x47, 0x1d, 0x5a, 0x99, 0x4f, 0x1b, 0xd2, 0x03,
+	0x4f, 0xc2, 0xda, 0xcc, 0x27, 0x8a, 0xd4, 0x86, 0x6e, 0xda, 0x3a, 0xf3,
+	0x89, 0x2a, 0xcb, 0xac, 0xbf, 0xa7, 0xcc, 0x27, 0x54, 0x5a, 0x8d, 0x87,
+	0x3e, 0xcf, 0x7c, 0xc2, 0xe4, 0xbe, 0x19, 0x4f, 0x93, 0xf9, 0x84, 0xcb,
+	0x37, 0x16, 0x98, 0x4f, 0x34, 0xd1, 0x5d, 0xdb, 0x6d, 0x8f, 0xf9, 0x44,
+	0xc8, 0x9e, 0x7e, 0xda, 0x9b, 0xcc, 0x27, 0xba, 0x44, 0xa6, 0x9f, 0xd1,
+	0x98, 0x4f, 0xa4, 0x94, 0x58, 0xbb, 0x59, 0x61, 0x3e, 0x31, 0x64, 0xfa,
+	0xb3, 0xbd, 0x17, 0xf3, 0xe9, 0x45, 0xdc, 0x74, 0x79, 0x04, 0xf3, 0xe9,
+	0x55, 0x6e, 0x0d, 0xdd, 0x68, 0xc2, 0x5c, 0x51, 0xe9, 0x6f, 0x4c, 0x1b,
+	0x9b, 0xf9, 0x74, 0x93, 0x7a, 0x4e, 0x5d, 0xd6, 0x99, 0x4f, 0x77, 0x59,
+	0xbb, 0x0c, 0x3d, 0xca, 0x7c, 0x7a, 0x93, 0x36, 0xbd, 0xcc, 0x38, 0xcc,
+	0xa7, 0x87, 0xbc, 0xec, 0xa9, 0x25, 0x99, 0x4f, 0xef, 0x32, 0xd0, 0x75,
+	0x70, 0x0d, 0xcc, 0xa7, 0xa7, 0x98, 0xdf, 0x5e, 0xed, 0x32, 0x9f, 0x3e,
+	0xe4, 0x58, 0xbd, 0x79, 0x06, 0xf3, 0xc9, 0x22, 0xdf, 0x70, 0x66, 0x3e,
+	0x59, 0xa5, 0xbc, 0x3c, 0x59, 0x0b, 0xf3, 0x49, 0x95, 0x79, 0xb6, 0xbf,
+	0xb9, 0x98, 0x4f, 0x9a, 0xf8, 0x7a, 0xbb, 0x7b, 0x30, 0x9f, 0x74, 0xb9,
+	0x68, 0x7b, 0xf7, 0x56, 0xe6, 0x93, 0x4d, 0x32, 0x63, 0x45, 0xdf, 0xcc,
+	0x27, 0x43, 0xd0, 0x5f, 0xf5, 0xd6, 0xce, 0x7c, 0xb2, 0xcb, 0xf6, 0x33,
+	0xdb, 0x52, 0xe6, 0x93, 0x29, 0x61, 0x15, 0x53, 0xee, 0x30, 0x9f, 0x1c,
+	0x82, 0x09, 0x3d, 0xfc, 0x26, 0xf3, 0x19, 0x45, 0xc6, 0xcb, 0xb2, 0xd3,
+	0x98, 0xcf, 0xa8, 0x62, 0x67, 0xa5, 0xd7, 0xcb, 0x7c, 0x86, 0xca, 0x59,
+	0xf7, 0xad, 0x35, 0x98, 0xcf, 0x30, 0xe9, 0x53, 0xbb, 0x35, 0x67, 0x3e,
+	0xc3, 0xa5, 0x66, 0xbb, 0xf3, 0x3e, 0xe6, 0x33, 0x9a, 0xac, 0x18, 0xa1,
+	0x39, 0x99, 0xcf, 0x08, 0xf9, 0x14, 0x89, 0xf9, 0x8c, 0x2e, 0xcf, 0xd0,
+	0xb1, 0x76, 0x65, 0x3e, 0x23, 0x65, 0x54, 0xdb, 0xa3, 0x6d, 0xe6, 0x33,
+	0x86, 0xe8, 0xeb, 0x5e, 0x5e, 0x27, 0x3e, 0x15, 0x9e, 0x88, 0xdf, 0xb2,
+	0x72, 0xa8, 0x73, 0xa5, 0x4a, 0xac, 0x6b, 0x45, 0x4f, 0xe3, 0x8a, 0x4a,
+	0x99, 0x98, 0x33, 0x3b, 0x83, 0x2b, 0x26, 0x33, 0x5b, 0x7d, 0x61, 0x9d,
+	0x2b, 0x2e, 0x0e, 0x39, 0x88, 0x77, 0x93, 0x2b, 0x4d, 0xae, 0xc3, 0xd1,
+	0xc6, 0x18, 0x5c, 0x09, 0x49, 0x7d, 0x19, 0xe6, 0x93, 0x2b, 0x5d, 0xb4,
+	0xea, 0x3b, 0xb0, 0x17, 0xae, 0xa4, 0xac, 0x17, 0xbd, 0xc5, 0xdc, 0x5c,
+	0x19, 0xd2, 0xce, 0xb8, 0xa7, 0x34, 0xe2, 0x53, 0xe1, 0x89, 0x6f, 0x9d,
+	0xf0, 0x59, 0x2e, 0x57, 0xe0, 0xca, 0xb3, 0x9c, 0x6d, 0xeb, 0x71, 0x05,
+	0xae, 0xfc, 0x9f, 0xa8, 0x16, 0xae, 0xc0, 0x95, 0x71, 0xa8, 0x57, 0xd7,
+	0xca, 0x15, 0xb8, 0xb2, 0x2f, 0xb7, 0x72, 0x94, 0x2b, 0x70, 0x65, 0xbd,
+	0x6b, 0xce, 0x64, 0x3e, 0xf0, 0xc4, 0x55, 0xd5, 0xd4, 0x8d, 0xf9, 0xc0,
+	0x13, 0x61, 0x41, 0x73, 0x9c, 0xcb, 0x7c, 0xe0, 0x89, 0xf7, 0x60, 0x2a,
+	0xf4, 0xc1, 0x7c, 0xe0, 0x89, 0xb9, 0xf6, 0x18, 0xd5, 0x99, 0x0f, 0x3c,
+	0x51, 0x27, 0x6e, 0xd2, 0x7c, 0xcc, 0x07, 0x9e, 0x88, 0x27, 0x04, 0xdd,
+	0x77, 0x32, 0x1f, 0x78, 0x22, 0x5a, 0xe8, 0x7b, 0xb7, 0x31, 0x1f, 0x78,
+	0x62, 0xf1, 0xd9, 0x7b, 0x16, 0xe6, 0x03, 0x4f, 0x9c, 0x7a, 0x2e, 0x5c,
+	0x9e, 0xf9, 0xc0, 0x13, 0x1d, 0x2f, 0x17, 0x1d, 0x81, 0xf9, 0xc0, 0x13,
+	0xcf, 0x73, 0xbc, 0xce, 0xca, 0x7c, 0xe0, 0x89, 0xfd, 0x64, 0x6b, 0x77,
+	0x33, 0x1f, 0x78, 0xe2, 0xb7, 0x2e, 0x30, 0x1f, 0x78, 0xe2, 0x1a, 0xcf,
+	0x9b, 0x1a, 0xf3, 0x81, 0x27, 0xb6, 0x54, 0xcc, 0xcc, 0xcb, 0x7c, 0xe0,
+	0x89, 0x2f, 0x70, 0x0e, 0xdb, 0x60, 0x3e, 0xf0, 0xc4, 0xe1, 0x63, 0xae,
+	0xe7, 0xcc, 0x07, 0x9e, 0x68, 0x68, 0xfd, 0x96, 0x8f, 0xf9, 0xc0, 0x13,
+	0x0f, 0x8e, 0xe3, 0xd2, 0xc9, 0x7c, 0xe0, 0x89, 0xf1, 0xbc, 0xea, 0x6e,
+	0xcc, 0x07, 0x9e, 0x58, 0x4e, 0xcf, 0x19, 0x85, 0xf9, 0xc0, 0x13, 0xe7,
+	0x5a, 0xa5, 0xbe, 0xc5, 0x7c, 0xe0, 0x89, 0x3e, 0x6e, 0x1f, 0x18, 0x1b,
+	0x5c, 0x81, 0x2b, 0x67, 0x7d, 0x78, 0x5d, 0xcc, 0x07, 0x9e, 0x98, 0xd1,
+	0x22, 0xf7, 0x66, 0x3e, 0xf0, 0x44, 0xf5, 0xbc, 0x98, 0xc5, 0xcc, 0x07,
+	0x9e, 0xb8, 0x71, 0xc9, 0x59, 0x94, 0xf9, 0xc0, 0x13, 0xa3, 0xbc, 0xfd,
+	0xc6, 0x61, 0x3e, 0xf0, 0xc4, 0x6f, 0x69, 0x63, 0x3e, 0xf0, 0xc4, 0x71,
+	0xd0, 0x79, 0x8e, 0x33, 0x1f, 0x78, 0xa2, 0xad, 0x69, 0x38, 0x72, 0xcc,
+	0x07, 0x9e, 0x88, 0x6d, 0x61, 0xde, 0x32, 0x99, 0x0f, 0x3c, 0xb1, 0x27,
+	0xce, 0xd6, 0x6c, 0xcc, 0x07, 0x9e, 0x58, 0xc3, 0xc7, 0xf1, 0xc2, 0x7c,
+	0xe0, 0x89, 0xcb, 0xb3, 0xfa, 0x59, 0xcc, 0x07, 0x9e, 0xd8, 0x74, 0xe5,
+	0xee, 0xc1, 0x7c, 0xe0, 0x89, 0xaf, 0x3c, 0xc8, 0x74, 0x65, 0x3e, 0xf0,
+	0xc4, 0x7c, 0xda, 0xd7, 0xdc, 0xcc, 0x07, 0x9e, 0x88, 0xe6, 0xfa, 0xbb,
+	0x0b, 0xcc, 0x07, 0x9e, 0xb8, 0xd7, 0xf8, 0x2d, 0x4d, 0xcc, 0x07, 0x9e,
+	0x18, 0x63, 0xff, 0x74, 0x9d, 0xf9, 0xc0, 0x13, 0x31, 0xd5, 0x7f, 0xa2,
+	0xc8, 0x7c, 0xe0, 0x89, 0x33, 0xec, 0xa7, 0x28, 0xcc, 0x07, 0x9e, 0xe8,
+	0xde, 0x7f, 0xc3, 0x91, 0xf9, 0xc0, 0x13, 0xbf, 0xd5, 0x99, 0xf9, 0xc0,
+	0x13, 0xb3, 0x5c, 0x34, 0x84, 0xc6, 0x7c, 0xe0, 0x89, 0x38, 0x53, 0x0b,
+	0x3b, 0x27, 0xf3, 0x81, 0x27, 0xae, 0xd3, 0x70, 0x13, 0x16, 0xf3, 0x81,
+	0x27, 0x36, 0x4c, 0x9f, 0xd7, 0x82, 0xf9, 0xc0, 0x13, 0xdf, 0xd8, 0xf0,
+	0xce, 0xca, 0x7c, 0xe0, 0x89, 0xa3, 0xbf, 0xbc, 0xb9, 0x99, 0x0f, 0x3c,
+	0xd1, 0xc2, 0x20, 0xac, 0x9d, 0xf9, 0xc0, 0x13, 0x8f, 0xe3, 0xe8, 0x6e,
+	0x65, 0x3e, 0xf0, 0xc4, 0xae, 0xb8, 0x00, 0x0c, 0x07, 0xaa, 0xc0, 0x13,
+	0x6b, 0x39, 0xb1, 0x5f, 0x32, 0x1f, 0x78, 0xe2, 0x7c, 0xe5, 0xfa, 0x30,
+	0xe6, 0x03, 0x4f, 0xf4, 0xe3, 0x98, 0xc0, 0x97, 0xf9, 0xc0, 0x13, 0xef,
+	0xea, 0x07, 0xf3, 0x99, 0xf9, 0xc0, 0x13, 0x73, 0x2c, 0x5f, 0xe1, 0xcc,
+	0x07, 0x9e, 0xa8, 0xfd, 0x62, 0x03, 0x7a, 0xcc, 0x07, 0x9e, 0xf8, 0xbd,
+	0x81, 0xc1, 0x7c, 0xe0, 0x89, 0xe1, 0x30, 0x24, 0x0b, 0xe6, 0x03, 0x4f,
+	0xc4, 0x96, 0xac, 0xe3, 0x54, 0xe6, 0x03, 0x4f, 0x9c, 0x65, 0xcf, 0x1a,
+	0x9b, 0xf9, 0xc0, 0x13, 0xed, 0x95, 0x3a, 0x20, 0xb3, 0x5c, 0xa9, 0x72,
+	0x0e, 0x1e, 0x5f, 0x2c, 0xf0, 0x5c, 0x81, 0x2b, 0xaf, 0x0e, 0x29, 0x3c,
+	0xcc, 0x07, 0x9e, 0x58, 0xc7, 0xec, 0xef, 0x24, 0xf3, 0x81, 0x27, 0xe2,
+	0xe6, 0xbc, 0x8e, 0xe5, 0x95, 0x2b, 0x70, 0xe5, 0xc0, 0x31, 0x80, 0x21,
+	0x70, 0x05, 0xae, 0xec, 0x7e, 0x63, 0x0e, 0xe6, 0x03, 0x4f, 0x1c, 0x0a,
+	0xe5, 0xc2, 0xe2, 0xc6, 0x15, 0xb8, 0x72, 0xc1, 0x59, 0x3c, 0x8f, 0xf9,
+	0xc0, 0x13, 0xf7, 0xc5, 0x98, 0xe9, 0x93, 0xf9, 0xc0, 0x13, 0xe3, 0xa0,
+	0xc1, 0x61, 0x69, 0xe1, 0x0a, 0x5c, 0x79, 0x85, 0xed, 0x55, 0x98, 0x0f,
+	0x3c, 0xf1, 0x7b, 0x1b, 0x89, 0xf9, 0xc0, 0x13, 0xbd, 0x1f, 0x5d, 0x10,
+	0x76, 0xae, 0xc0, 0x95, 0x03, 0x2d, 0x2c, 0x95, 0xf9, 0xc0, 0x13, 0xd3,
+	0xbd, 0xae, 0x7a, 0x98, 0x0f, 0x3c, 0x51, 0xb5, 0x0f, 0x34, 0x25, 0xe6,
+	0x03, 0x4f, 0xdc, 0x65, 0x95, 0xd9, 0x8c, 0xf9, 0xc0, 0x13, 0xdb, 0x45,
+	0xff, 0xbf, 0x97, 0xf9, 0xc0, 0x13, 0xdf, 0xa9, 0x6f, 0xe4, 0x20, 0x3e,
+	0x0a, 0x4f, 0x1c, 0xab, 0x75, 0xcc, 0xef, 0xe4, 0x0a, 0x5c, 0x79, 0xe0,
+	0x61, 0x5c, 0x6f, 0x70, 0x05, 0xae, 0xdc, 0x77, 0xa0, 0x27, 0x4d, 0xae,
+	0xc0, 0x95, 0xdb, 0x3b, 0xfd, 0xb5, 0xc5, 0x15, 0xb8, 0x32, 0x5c, 0xe7,
+	0x8d, 0xb2, 0xb9, 0x02, 0x57, 0xd6, 0xd8, 0x5d, 0xd7, 0xe1, 0x0a, 0x5c,
+	0x19, 0xb7, 0xed, 0xee, 0xb8, 0x5c, 0xe9, 0x72, 0x2f, 0xda, 0x78, 0xd4,
+	0xc7, 0x95, 0x94, 0xef, 0xcd, 0xbc, 0xc2, 0x15, 0xb8, 0xf2, 0xf2, 0xd9,
+	0x46, 0x12, 0x1f, 0x85, 0x27, 0x6e, 0x7c, 0xf6, 0x98, 0x29, 0x57, 0xe0,
+	0xca, 0x7d, 0x0d, 0xdf, 0xd7, 0xb8, 0x02, 0x57, 0x6e, 0xaf, 0xec, 0x18,
+	0xce, 0x15, 0xb8, 0xb2, 0x6b, 0x7a, 0xf1, 0xc6, 0x15, 0xb8, 0xb2, 0x36,
+	0xcc, 0xf3, 0x17, 0x5c, 0x81, 0x2b, 0x63, 0x01, 0x30, 0x9b, 0xcc, 0x07,
+	0x9e, 0x88, 0x46, 0x71, 0xe7, 0x69, 0xcc, 0x07, 0x9e, 0x58, 0xcf, 0xaf,
+	0x25, 0x16, 0xe6, 0x03, 0x4f, 0x44, 0x43, 0x3e, 0xb3, 0x2c, 0xe6, 0x03,
+	0x4f, 0x6c, 0xa3, 0xb7, 0x3a, 0x83, 0xf9, 0xc0, 0x13, 0x5f, 0xc7, 0x28,
+	0xf3, 0xca, 0x7c, 0xe0, 0x89, 0x03, 0x4f, 0x1c, 0x6c, 0x99, 0xf9, 0xc0,
+	0x13, 0x0d, 0x87, 0x37, 0x7b, 0x67, 0x3e, 0xf0, 0xc4, 0xa3, 0xd8, 0xdd,
+	0xe1, 0xf2, 0x5c, 0x81, 0x2b, 0xff, 0xf7, 0x96, 0x2a, 0xf3, 0x81, 0x27,
+	0x96, 0xbb, 0xeb, 0xf3, 0xc1, 0x7c, 0xe0, 0x89, 0x13, 0xae, 0x11, 0xd7,
+	0x99, 0x0f, 0x3c, 0xd1, 0x97, 0x95, 0xdb, 0x1f, 0xf3, 0x81, 0x27, 0xde,
+	0x11, 0x19, 0x75, 0x32, 0x1f, 0x78, 0x62, 0xf6, 0xf1, 0xce, 0x6a, 0xcc,
+	0x07, 0x9e, 0xa8, 0xed, 0xf4, 0xd6, 0x0a, 0xf3, 0x81, 0x27, 0x6e, 0xc7,
+	0xd5, 0xa1, 0xd1, 0x73, 0x05, 0xae, 0xac, 0x1e, 0x9e, 0xc1, 0x7c, 0xe0,
+	0x89, 0x58, 0xd4, 0x31, 0x98, 0x2a, 0xf3, 0x81, 0x27, 0x8e, 0xbb, 0x9a,
+	0xad, 0xcd, 0x7c, 0xe0, 0x89, 0xb6, 0xef, 0xc6, 0x03, 0xc9, 0x7c, 0xe0,
+	0x89, 0x67, 0xa9, 0xeb, 0x53, 0xe6, 0x03, 0x4f, 0xec, 0xa3, 0xad, 0x99,
+	0x87, 0xf9, 0xc0, 0x13, 0x31, 0x01, 0x0c, 0xf7, 0x82, 0xf9, 0xc0, 0x13,
+	0x57, 0xdb, 0x73, 0x6c, 0x63, 0x3e, 0xf0, 0xc4, 0xef, 0x8d, 0x6d, 0xe6,
+	0x03, 0x4f, 0x7c, 0xf8, 0xc6, 0x7c, 0x93, 0xf9, 0xc0, 0x13, 0x31, 0x47,
+	0x60, 0xbe, 0x8d, 0xf9, 0xc0, 0x13, 0xf5, 0xce, 0x4c, 0x2b, 0xcc, 0x07,
+	0x9e, 0xb8, 0xf7, 0x79, 0x6f, 0x2f, 0xe6, 0x03, 0x4f, 0x8c, 0x85, 0x69,
+	0x17, 0xc1, 0x7c, 0xe0, 0x89, 0xe5, 0xa7, 0x34, 0x98, 0xed, 0x5c, 0x81,
+	0x2b, 0xf7, 0x0c, 0x18, 0x14, 0xf3, 0x81, 0x27, 0x62, 0x68, 0x9e, 0x6b,
+	0x9d, 0xf9, 0xc0, 0x13, 0xaf, 0xfd, 0xf4, 0x40, 0x99, 0x0f, 0x3c, 0x11,
+	0xad, 0x7a, 0x9f, 0x38, 0xcc, 0x07, 0x9e, 0x88, 0xae, 0xe4, 0xad, 0x24,
+	0xf3, 0x81, 0x27, 0xae, 0x3b, 0x40, 0xd4, 0x98, 0x0f, 0x3c, 0xb1, 0xed,
+	0x63, 0x6e, 0x97, 0xf9, 0xc0, 0x13, 0x1f, 0x1a, 0xf9, 0xc2, 0xf6, 0xca,
+	0x15, 0xb8, 0xf2, 0x70, 0xa0, 0x75, 0xe6, 0x03, 0x4f, 0xfc, 0xe2, 0x05,
+	0xe6, 0x03, 0x4f, 0x3c, 0x0d, 0x3b, 0xe5, 0xe4, 0xfc, 0x47, 0xe1, 0x89,
+	0xdd, 0x6e, 0x4e, 0xe7, 0xfc, 0x47, 0xe1, 0x89, 0xd8, 0xf6, 0x4a, 0xbd,
+	0x9c, 0xff, 0x28, 0x3c, 0x71, 0x95, 0xd6, 0x47, 0xe7, 0xfc, 0x47, 0xe1,
+	0x89, 0x7e, 0xf3, 0x61, 0x4f, 0x65, 0x3e, 0xf0, 0xc4, 0xbb, 0x77, 0xe4,
+	0xe2, 0xfc, 0x47, 0xe1, 0x89, 0x39, 0xdf, 0x2d, 0xce, 0xf9, 0x8f, 0xc2,
+	0x13, 0x75, 0x58, 0xeb, 0x97, 0xf3, 0x1f, 0x85, 0x27, 0xc2, 0xc7, 0x21,
+	0x69, 0x9c, 0xff, 0x28, 0x3c, 0x31, 0xda, 0xf4, 0x5e, 0x39, 0xff, 0x51,
+	0x78, 0x62, 0xb1, 0xb3, 0xee, 0xe2, 0xfc, 0x47, 0xe1, 0x89, 0x13, 0xad,
+	0x39, 0x1a, 0xe7, 0x3f, 0x0a, 0x4f, 0x44, 0xaf, 0x9e, 0xd8, 0x5d, 0x99,
+	0x0f, 0x3c, 0xf1, 0xdc, 0xc4, 0xed, 0xe3, 0xfc, 0x47, 0xe1, 0x89, 0x1d,
+	0x22, 0x8f, 0x1e, 0xc7, 0x7c, 0xe0, 0x89, 0x5f, 0xc8, 0xc3, 0x7c, 0xe0,
+	0x89, 0x0b, 0xf2, 0xb2, 0x1b, 0xe7, 0x3f, 0x0a, 0x4f, 0x6c, 0x3d, 0x8a,
+	0x3d, 0xce, 0x7f, 0x14, 0x9e, 0xf8, 0xd0, 0xb0, 0xf1, 0x7d, 0xcc, 0x07,
+	0x9e, 0x38, 0x6c, 0x3f, 0x6c, 0xa2, 0xcc, 0x07, 0x9e, 0x68, 0x38, 0xa4,
+	0x73, 0x73, 0xfe, 0xa3, 0xf0, 0xc4, 0x53, 0xec, 0x82, 0x06, 0xf3, 0x81,
+	0x27, 0xc6, 0xed, 0x6d, 0x3c, 0xce, 0x7f, 0x14, 0x9e, 0x08, 0x81, 0x3c,
+	0x30, 0x08, 0xe6, 0x03, 0x4f, 0x9c, 0xf3, 0xa7, 0xca, 0x9c, 0xff, 0x28,
+	0x3c, 0x11, 0x4d, 0x7c, 0x97, 0xcd, 0xf9, 0x8f, 0xc2, 0x13, 0xf1, 0x6b,
+	0x2c, 0x83, 0xf3, 0x1f, 0xcc, 0x4b, 0xc9, 0x96, 0xab, 0x14, 0xce, 0x7f,
+	0xa0, 0x7b, 0xa2, 0xb6, 0xb5, 0x4f, 0xce, 0x7f, 0x14, 0x9e, 0x88, 0x79,
+	0x31, 0x9e, 0x71, 0xfe, 0xa3, 0xf0, 0x44, 0xdc, 0xcf, 0x1a, 0x87, 0xf3,
+	0x1f, 0x85, 0x27, 0x7e, 0x51, 0x1b, 0xf3, 0x81, 0x27, 0x8e, 0x3d, 0x4b,
+	0x14, 0xce, 0x7f, 0x14, 0x9e, 0x68, 0xf3, 0xf4, 0x33, 0x39, 0xff, 0x51,
+	0x78, 0xe2, 0x19, 0xe5, 0x35, 0xe7, 0xfc, 0x07, 0x3a, 0x2e, 0xbd, 0x7b,
+	0xec, 0xc3, 0xf9, 0x0f, 0x4e, 0xbb, 0x60, 0xa7, 0xbb, 0xde, 0x39, 0xff,
+	0x51, 0x78, 0xe2, 0x32, 0xf4, 0xe5, 0xca, 0xf9, 0x8f, 0xc2, 0x13, 0x5b,
+	0xbd, 0xc7, 0x26, 0xe7, 0x3f, 0x0a, 0x4f, 0x7c, 0xe8, 0x65, 0x10, 0x1b,
+	0xe6, 0x03, 0x4f, 0xcc, 0xfb, 0x5b, 0x58, 0x38, 0xff, 0x51, 0x78, 0xa2,
+	0xee, 0x61, 0x33, 0x39, 0xff, 0x51, 0x78, 0xe2, 0x9e, 0x7b, 0x69, 0xe5,
+	0xfc, 0xc7, 0xe0, 0x89, 0x31, 0xf0, 0x05, 0x8b, 0xf3, 0x1f, 0x0c, 0x79,
+	0x29, 0xdd, 0x26, 0x76, 0xe8, 0xc3, 0x15, 0xb8, 0x32, 0xd4, 0x32, 0x2f,
+	0xe7, 0x3f, 0x18, 0x07, 0xe2, 0xd8, 0x71, 0x4a, 0x72, 0xfe, 0x63, 0xf0,
+	0xc4, 0x2f, 0xf0, 0x2c, 0x5c, 0x81, 0x2b, 0x63, 0xa3, 0x79, 0x8b, 0xf3,
+	0x1f, 0xec, 0x85, 0x52, 0xaf, 0x3f, 0x9c, 0x5f, 0xe5, 0x4a, 0x97, 0xb5,
+	0x33, 0xa0, 0xff, 0xc6, 0x15, 0xb8, 0xf2, 0x5c, 0x38, 0x09, 0x9c, 0xff,
+	0x18, 0x3c, 0xf1, 0xe5, 0x6b, 0xd8, 0x92, 0x89, 0x8f, 0xc1, 0x13, 0x47,
+	0xc7, 0x66, 0xbf, 0x39, 0xff, 0x31, 0x78, 0xa2, 0x61, 0xd3, 0x3d, 0xc1,
+	0xf9, 0x8f, 0xc1, 0x13, 0xb1, 0x4c, 0x6d, 0x7f, 0x9c, 0xff, 0x18, 0x3c,
+	0xb1, 0xd7, 0xdf, 0xda, 0xc8, 0xf9, 0x8f, 0xc1, 0x13, 0xd1, 0xde, 0x97,
+	0x1b, 0xe7, 0x3f, 0x06, 0x4f, 0xc4, 0x23, 0xa7, 0x6b, 0x73, 0xfe, 0x83,
+	0xb3, 0x2e, 0xbe, 0xfb, 0xb4, 0xe0, 0xfc, 0xc7, 0xe0, 0x89, 0x17, 0x33,
+	0x01, 0xeb, 0x3b, 0xf3, 0x81, 0x27, 0x66, 0xde, 0xdf, 0xe2, 0xc8, 0x7c,
+	0xe0, 0x89, 0xe8, 0x64, 0xbf, 0x95, 0x85, 0xf9, 0xc0, 0x13, 0xbf, 0xd8,
+	0x99, 0xf9, 0xc0, 0x13, 0x03, 0x5f, 0x3f, 0x82, 0xf3, 0x1f, 0x08, 0x08,
+	0x56, 0x90, 0x0d, 0x41, 0xe0, 0xfc, 0xc7, 0xe0, 0x89, 0xe3, 0x3d, 0x8c,
+	0x26, 0xce, 0x7f, 0x0c, 0x9e, 0x68, 0xd7, 0xa2, 0x38, 0xe7, 0x3f, 0x06,
+	0x4f, 0x3c, 0x3b, 0xf0, 0x38, 0x72, 0xfe, 0x63, 0xf0, 0xc4, 0x3e, 0x27,
+	0x0e, 0x02, 0xe7, 0x3f, 0x06, 0x4f, 0xac, 0x79, 0x70, 0x09, 0x9c, 0xff,
+	0x18, 0x3c, 0x71, 0xfd, 0x12, 0x96, 0xc9, 0xf9, 0x8f, 0xc1, 0x13, 0x5b,
+	0xfb, 0x2d, 0xef, 0x9c, 0xff, 0x18, 0x3c, 0xf1, 0x61, 0x99, 0x3b, 0x97,
+	0xf3, 0x1f, 0x83, 0x27, 0x8e, 0xba, 0x70, 0xe8, 0x39, 0xff, 0xc1, 0x6a,
+	0x21, 0xd8, 0xf6, 0xeb, 0xa9, 0x9c, 0xff, 0x18, 0x3c, 0x71, 0x5f, 0x3c,
+	0xfb, 0x8b, 0xf3, 0x1f, 0x83, 0x27, 0x06, 0xd6, 0xac, 0xed, 0x9c, 0xff,
+	0x18, 0x3c, 0xb1, 0xcc, 0x91, 0x76, 0x39, 0xff, 0x31, 0x78, 0xe2, 0x17,
+	0xfe, 0x33, 0x1f, 0x78, 0xa2, 0x77, 0x3c, 0xa9, 0xca, 0xf9, 0x8f, 0xc1,
+	0x13, 0x6f, 0xc3, 0x2d, 0x58, 0x9c, 0xff, 0x18, 0x3c, 0x31, 0xad, 0x07,
+	0xac, 0x83, 0xf9, 0xc0, 0x13, 0xb5, 0xce, 0x33, 0x1e, 0xe7, 0x3f, 0xd8,
+	0x08, 0x64, 0xbd, 0xdb, 0xf0, 0x42, 0x99, 0x0f, 0x3c, 0xb1, 0xdd, 0xba,
+	0x87, 0x72, 0xfe, 0x03, 0x39, 0x92, 0xb7, 0xe1, 0x9d, 0x9b, 0xf3, 0x1f,
+	0x83, 0x27, 0x8e, 0x99, 0x78, 0x39, 0x9c, 0xff, 0x18, 0x3c, 0xd1, 0xf2,
+	0xf7, 0x16, 0x0a, 0xe7, 0x3f, 0x06, 0x4f, 0x44, 0xe3, 0x9f, 0x50, 0x5f,
+	0xe6, 0x03, 0x4f, 0xc4, 0xf8, 0xa9, 0x4f, 0x39, 0xff, 0x31, 0x78, 0x22,
+	0xec, 0x60, 0xc4, 0xe6, 0xfc, 0x07, 0xe3, 0x4d, 0x56, 0x9d, 0xe5, 0x06,
+	0xe7, 0x3f, 0x06, 0x4f, 0xf4, 0x77, 0xb2, 0x3d, 0xce, 0x7f, 0x0c, 0x9e,
+	0x78, 0x6f, 0x79, 0x67, 0x70, 0xfe, 0x63, 0xf0, 0xc4, 0xef, 0x4f, 0x30,
+	0x98, 0x0f, 0x3c, 0x51, 0x27, 0x76, 0xbd, 0xc3, 0xf9, 0x8f, 0xc1, 0x13,
+	0x77, 0xe2, 0x20, 0x06, 0xe7, 0x3f, 0x06, 0x4f, 0x8c, 0xb8, 0x67, 0x17,
+	0xce, 0x7f, 0xd0, 0x8d, 0xb0, 0x9f, 0xc2, 0x3d, 0x27, 0xe7, 0x3f, 0x70,
+	0x2d, 0x99, 0xd6, 0x36, 0x8e, 0x1b, 0xf3, 0x81, 0x27, 0x7a, 0x85, 0x76,
+	0x1e, 0xce, 0x7f, 0x0c, 0x9e, 0x78, 0xa0, 0xea, 0xb3, 0x73, 0xfe, 0x83,
+	0x97, 0x81, 0xfd, 0xf4, 0xd7, 0x16, 0x38, 0xff, 0x31, 0x78, 0x62, 0xdd,
+	0x68, 0xf2, 0x93, 0xf3, 0x1f, 0x83, 0x27, 0xe2, 0x47, 0x61, 0x1d, 0xe6,
+	0xfc, 0xc7, 0xe0, 0x89, 0xb0, 0xad, 0x91, 0x87, 0xf3, 0x1f, 0x83, 0x27,
+	0xbe, 0xb8, 0xb5, 0x74, 0xce, 0x7f, 0xa0, 0x74, 0xd8, 0x4f, 0x6b, 0x66,
+	0xe5, 0xfc, 0xc7, 0xe0, 0x89, 0x78, 0x86, 0x1e, 0x1c, 0x9b, 0xf9, 0xc0,
+	0x13, 0xf1, 0x24, 0x62, 0x40, 0x73, 0xfe, 0x63, 0xf0, 0xc4, 0xef, 0x0f,
+	0x61, 0x98, 0x0f, 0x3c, 0xb1, 0x9c, 0x17, 0x91, 0x9c, 0xff, 0x18, 0x3c,
+	0x71, 0x6e, 0xb4, 0x83, 0xca, 0xf9, 0x8f, 0xc1, 0x13, 0x7d, 0x46, 0x6b,
+	0x2b, 0xed, 0x8f, 0x7f, 0x01, 0xa4, 0x34, 0x4a, 0x34, 0xc8, 0x25, 0x00,
+	0x00,
+};
@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Microbenchmarks for the hot paths of the boot process. Results are
+ * reported in CPU cycles and nanoseconds per operation, together with the
+ * L1/L2 data cache refills counted by the PMU, so they can be compared
+ * between SoCs. Available as "oem bench" in fastboot and "bench" on the
+ * console, both take an optional benchmark name prefix.
+ */
+
+#include <arch/ops.h>
+#include <arch/arm/pmu.h>
+#include <crc32.h>
+#include <debug.h>
+#include <decompress.h>
+#include <dev/fbcon.h>
+#include <lk2nd.h>
+#include <malloc.h>
+#include <mmc.h>
+#include <platform.h>
+#include <sha.h>
+#include <stdio.h>
+#include <string.h>
+#include <target.h>
+
+#define BENCH_BUF_SIZE		(4 * 1024 * 1024)
+#define BENCH_LINE_SIZE		60
+#define BENCH_GLYPHS		32
+
+/* bench-inflate.c */
+extern const unsigned int bench_inflate_size;
+extern const unsigned int bench_inflate_gz_size;
+extern const unsigned char bench_inflate_gz[];
+
+/* From lib/openssl/crypto/armcap.c */
+extern unsigned int OPENSSL_armcap_P;
+void OPENSSL_cpuid_setup(void);
+
+#define ARMV8_SHA1		(1 << 3)
+#define ARMV8_SHA256		(1 << 4)
+
+struct bench_case {
+	const char *name;
+	/* returns false if the benchmark cannot run on this device */
+	bool (*run)(unsigned size, unsigned iterations);
+	unsigned size;
+	unsigned iterations;
+};
+
+static uint8_t *bench_src, *bench_dst;
+
+static bool bench_memcpy(unsigned size, unsigned iterations)
+{
+	while (iterations--)
+		memcpy(bench_dst, bench_src, size);
+	return true;
+}
+
+static bool bench_memmove(unsigned size, unsigned iterations)
+{
+	/* overlapping copy backwards, like relocating a loaded image */
+	while (iterations--)
+		memmove(bench_src + 64, bench_src, size);
+	return true;
+}
+
+static bool bench_crc32(unsigned size, unsigned iterations)
+{
+	while (iterations--)
+		crc32(0, bench_src, size);
+	return true;
+}
+
+static bool bench_sha(unsigned size, unsigned iterations, bool sha256,
+		      unsigned int armcap)
+{
+	unsigned char md[SHA256_DIGEST_LENGTH];
+	unsigned int saved;
+
+	OPENSSL_cpuid_setup();
+	if (armcap && !(OPENSSL_armcap_P & armcap))
+		return false;
+
+	/* The SW variants run the ARMv4 code even if the CPU has the CE */
+	saved = OPENSSL_armcap_P;
+	if (!armcap)
+		OPENSSL_armcap_P &= ~(ARMV8_SHA1 | ARMV8_SHA256);
+
+	while (iterations--) {
+		if (sha256)
+			SHA256(bench_src, size, md);
+		else
+			SHA1(bench_src, size, md);
+	}
+
+	OPENSSL_armcap_P = saved;
+	return true;
+}
+
+static bool bench_sha1(unsigned size, unsigned iterations)
+{
+	return bench_sha(size, iterations, false, 0);
+}
+
+static bool bench_sha1_ce(unsigned size, unsigned iterations)
+{
+	return bench_sha(size, iterations, false, ARMV8_SHA1);
+}
+
+static bool bench_sha256(unsigned size, unsigned iterations)
+{
+	return bench_sha(size, iterations, true, 0);
+}
+
+static bool bench_sha256_ce(unsigned size, unsigned iterations)
+{
+	return bench_sha(size, iterations, true, ARMV8_SHA256);
+}
+
+static bool bench_inflate(unsigned size, unsigned iterations)
+{
+	unsigned pos, out_len;
+
+	while (iterations--) {
+		if (decompress((unsigned char *)bench_inflate_gz, bench_inflate_gz_size,
+			       bench_dst, BENCH_BUF_SIZE, &pos, &out_len) ||
+		    out_len != bench_inflate_size)
+			return false;
+	}
+	return true;
+}
+
+/* Draws a line of glyphs without newlines, so nothing is flushed */
+static bool bench_fbcon_glyph(unsigned size, unsigned iterations)
+{
+	unsigned i;
+
+	if (!fbcon_display() || fbcon_get_max_x() < size)
+		return false;
+
+	while (iterations--) {
+		for (i = 0; i < size; i++)
+			fbcon_putc('A' + i % 26);
+		fbcon_putc('\r');
+	}
+	return true;
+}
+
+static bool bench_mmc_read(unsigned size, unsigned iterations)
+{
+	while (iterations--) {
+		if (mmc_read(0, (uint32_t *)bench_dst, size))
+			return false;
+	}
+	return true;
+}
+
+static bool bench_malloc(unsigned size, unsigned iterations)
+{
+	void *p;
+
+	while (iterations--) {
+		p = malloc(size);
+		if (!p)
+			return false;
+		free(p);
+	}
+	return true;
+}
+
+static const struct bench_case bench_cases[] = {
+	{ "memcpy",	 bench_memcpy,	   4096,	2048 },
+	{ "memcpy",	 bench_memcpy,	   65536,	128 },
+	{ "memcpy",	 bench_memcpy,	   1048576,	8 },
+	{ "memmove",	 bench_memmove,	   65536,	128 },
+	{ "crc32",	 bench_crc32,	   65536,	32 },
+	{ "sha1",	 bench_sha1,	   65536,	32 },
+	{ "sha1-ce",	 bench_sha1_ce,	   65536,	32 },
+	{ "sha256",	 bench_sha256,	   65536,	32 },
+	{ "sha256-ce",	 bench_sha256_ce,  65536,	32 },
+	{ "inflate",	 bench_inflate,	   0,		64 },
+	{ "fbcon-glyph", bench_fbcon_glyph, BENCH_GLYPHS, 64 },
+	{ "mmc-read",	 bench_mmc_read,   4096,	64 },
+	{ "mmc-read",	 bench_mmc_read,   65536,	16 },
+	{ "mmc-read",	 bench_mmc_read,   524288,	4 },
+	{ "mmc-read",	 bench_mmc_read,   4194304,	1 },
+	{ "malloc",	 bench_malloc,	   32,		4096 },
+	{ "malloc",	 bench_malloc,	   4096,	1024 },
+};
+
+static void bench_case_run(const struct bench_case *c, void (*print)(const char *line))
+{
+	unsigned size = c->size ? c->size : bench_inflate_size;
+	uint32_t cycles, l1d, l2d;
+	char line[BENCH_LINE_SIZE];
+	bigtime_t ns;
+	bool ok;
+
+	arm_pmu_reset_counters();
+	ns = current_time_hires();
+	cycles = arch_cycle_count();
+
+	ok = c->run(size, c->iterations);
+
+	cycles = arch_cycle_count() - cycles;
+	ns = (current_time_hires() - ns) * 1000;
+	l1d = arm_pmu_read_counter(0);
+	l2d = arm_pmu_read_counter(1);
+
+	if (!ok) {
+		snprintf(line, sizeof(line), "%-12s %7u %9s", c->name, size, "n/a");
+		print(line);
+		return;
+	}
+
+	snprintf(line, sizeof(line), "%-12s %7u %9u %9llu %7u %7u", c->name, size,
+		 cycles / c->iterations, ns / c->iterations,
+		 l1d / c->iterations, l2d / c->iterations);
+	print(line);
+}
+
+void lk2nd_bench(const char *filter, void (*print)(const char *line))
+{
+	unsigned i;
+
+	bench_src = target_get_scratch_address();
+	bench_dst = bench_src + BENCH_BUF_SIZE;
+	memset(bench_src, 0x5a, BENCH_BUF_SIZE);
+
+	arm_pmu_set_event(0, ARM_PMU_EVT_L1D_REFILL);
+	arm_pmu_set_event(1, ARM_PMU_EVT_L2D_REFILL);
+
+	print("bench           size    cyc/op     ns/op  l1d/op  l2d/op");
+	for (i = 0; i < ARRAY_SIZE(bench_cases); i++) {
+		if (filter && strncmp(bench_cases[i].name, filter, strlen(filter)))
+			continue;
+		bench_case_run(&bench_cases[i], print);
+	}
+}
+
+#if WITH_LIB_CONSOLE
+#include <lib/console.h>
+
+static void bench_print_console(const char *line)
+{
+	printf("%s\n", line);
+}
+
+static int cmd_bench(int argc, const cmd_args *argv)
+{
+	lk2nd_bench(argc > 1 ? argv[1].str : NULL, bench_print_console);
+	return 0;
+}
+
+STATIC_COMMAND_START
+	{ "bench", "run microbenchmarks [name prefix]", &cmd_bench },
+STATIC_COMMAND_END(bench);
+#endif
@@ -0,0 +1,8 @@
+LOCAL_DIR := $(GET_LOCAL_DIR)
+
+INCLUDES += -I$(LK_TOP_DIR)/lib/zlib_inflate
+MODULES += lib/zlib_inflate
+
+OBJS += \
+	$(LOCAL_DIR)/bench.o \
+	$(LOCAL_DIR)/bench-inflate.o
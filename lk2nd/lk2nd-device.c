@@ -441,6 +441,10 @@ void lk2nd_init(void)
 	dump_board();
 	lk2nd_fdt_parse();
 	lk2nd_target_keystatus();
+
+#ifdef LK2ND_SMP_WORKERS
+	smp_workers_start((struct smp_spin_table*)SMP_SPIN_TABLE_BASE);
+#endif
 }
 
 static void lk2nd_update_panel_compatible(void *fdt)
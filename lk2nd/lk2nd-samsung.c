@@ -4,6 +4,9 @@
 #include <libfdt.h>
 #include <platform/timer.h>
 #include "regmap/regmap-gpio-i2c.h"
+#if LK2ND_REGMAP_QUP_I2C
+#include "regmap/regmap-qup-i2c.h"
+#endif
 
 /*
  * On some Samsung devices, the bootloader sets the MUIC in a so-called
@@ -20,6 +23,20 @@
 /* TODO: Make this configurable? */
 #define MUIC_RESET_REG	0x1B
 
+#if LK2ND_REGMAP_QUP_I2C
+static const struct regmap *lk2nd_samsung_muic_qup(const void *fdt, int offset,
+						   struct regmap_qup_i2c *regmap)
+{
+	regmap->dev = qup_i2c_read_bus(fdt, offset);
+	if (!regmap->dev)
+		return NULL;
+	if (!regmap_qup_i2c_read_addr(fdt, offset, regmap))
+		return NULL;
+
+	return &regmap->map;
+}
+#endif
+
 void lk2nd_samsung_muic_reset(const void *fdt, int offset)
 {
 	gpio_i2c_info_t gpio_i2c = {
@@ -28,19 +45,32 @@ void lk2nd_samsung_muic_reset(const void *fdt, int offset)
 	struct regmap_gpio_i2c regmap = {
 		.map = REGMAP_GPIO_I2C("muic"),
 	};
+#if LK2ND_REGMAP_QUP_I2C
+	struct regmap_qup_i2c qup_regmap = {
+		.map = REGMAP_QUP_I2C("muic"),
+	};
+#endif
+	const struct regmap *map = NULL;
 
 	/* Check if MUIC reset is necessary */
 	offset = fdt_subnode_offset(fdt, offset, "samsung,muic-reset");
 	if (offset < 0)
 		return;
 
-	if (!gpio_i2c_read_pins(fdt, offset, &gpio_i2c))
-		return;
-	if (!regmap_gpio_i2c_read_addr(fdt, offset, &regmap))
-		return;
+#if LK2ND_REGMAP_QUP_I2C
+	map = lk2nd_samsung_muic_qup(fdt, offset, &qup_regmap);
+#endif
+	if (!map) {
+		if (!gpio_i2c_read_pins(fdt, offset, &gpio_i2c))
+			return;
+		if (!regmap_gpio_i2c_read_addr(fdt, offset, &regmap))
+			return;
+
+		gpio_i2c_add_bus(0, &gpio_i2c);
+		map = &regmap.map;
+	}
 
-	gpio_i2c_add_bus(0, &gpio_i2c);
-	if (regmap_write(&regmap.map, MUIC_RESET_REG, 1))
+	if (regmap_write(map, MUIC_RESET_REG, 1))
 		return;
 
 	/* Wait a bit to let the MUIC detect the cable again */
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-2.0-only
+
+#include <blsp_qup.h>
+#include <debug.h>
+#include <err.h>
+#include <libfdt.h>
+#include <string.h>
+#include <platform/iomap.h>
+#include "regmap-qup-i2c.h"
+
+#define QUP_I2C_DEFAULT_FREQ	100000
+#define QUP_I2C_SRC_CLK_FREQ	19200000
+
+/* Largest write, the register address is sent in the same buffer */
+#define QUP_I2C_MAX_WRITE	32
+
+status_t regmap_qup_i2c_raw_read(const struct regmap *map, uint8_t reg, void *val, size_t count)
+{
+	const struct regmap_qup_i2c *qup_i2c = (const struct regmap_qup_i2c*)map;
+	struct i2c_msg msgs[] = {
+		{
+			.addr = qup_i2c->addr,
+			.flags = I2C_M_WR,
+			.len = sizeof(reg),
+			.buf = &reg,
+		},
+		{
+			.addr = qup_i2c->addr,
+			.flags = I2C_M_RD,
+			.len = count,
+			.buf = val,
+		},
+	};
+
+	if (qup_i2c_xfer(qup_i2c->dev, msgs, ARRAY_SIZE(msgs)) != ARRAY_SIZE(msgs))
+		return ERR_IO;
+	return 0;
+}
+
+status_t regmap_qup_i2c_raw_write(const struct regmap *map, uint8_t reg, const void *val, size_t count)
+{
+	const struct regmap_qup_i2c *qup_i2c = (const struct regmap_qup_i2c*)map;
+	uint8_t buf[1 + QUP_I2C_MAX_WRITE];
+	struct i2c_msg msg = {
+		.addr = qup_i2c->addr,
+		.flags = I2C_M_WR,
+		.len = 1 + count,
+		.buf = buf,
+	};
+
+	if (count > QUP_I2C_MAX_WRITE)
+		return ERR_TOO_BIG;
+
+	buf[0] = reg;
+	memcpy(&buf[1], val, count);
+
+	if (qup_i2c_xfer(qup_i2c->dev, &msg, 1) != 1)
+		return ERR_IO;
+	return 0;
+}
+
+/*
+ * Set up the BLSP QUP selected with 'i2c-qup = <blsp qup>' and an optional
+ * 'i2c-clock-frequency'. Returns NULL if the node doesn't use a QUP so the
+ * caller can fall back to bit-banging on the GPIOs.
+ */
+struct qup_i2c_dev *qup_i2c_read_bus(const void *fdt, int offset)
+{
+	const uint32_t *prop;
+	uint32_t blsp_id, qup_id, freq = QUP_I2C_DEFAULT_FREQ;
+	struct qup_i2c_dev *dev;
+	int len;
+
+	prop = fdt_getprop(fdt, offset, "i2c-qup", &len);
+	if (!prop)
+		return NULL;
+	if (len != 2 * sizeof(*prop)) {
+		dprintf(CRITICAL, "Invalid 'i2c-qup' (len %d)\n", len);
+		return NULL;
+	}
+
+	blsp_id = fdt32_to_cpu(prop[0]);
+	qup_id = fdt32_to_cpu(prop[1]);
+
+	prop = fdt_getprop(fdt, offset, "i2c-clock-frequency", &len);
+	if (prop && len == sizeof(*prop))
+		freq = fdt32_to_cpu(*prop);
+
+	dev = qup_blsp_i2c_init(blsp_id, qup_id, freq, QUP_I2C_SRC_CLK_FREQ);
+	if (!dev) {
+		dprintf(CRITICAL, "Failed to initialize BLSP%u QUP%u for I2C\n",
+			blsp_id, qup_id);
+		return NULL;
+	}
+
+	/* The QUP I2C driver only handles one bus at a time */
+	if (dev->qup_base != BLSP_QUP_BASE(blsp_id, qup_id)) {
+		dprintf(CRITICAL, "QUP I2C already in use for another bus\n");
+		return NULL;
+	}
+
+	return dev;
+}
+
+bool regmap_qup_i2c_read_addr(const void *fdt, int offset, struct regmap_qup_i2c *qup_i2c)
+{
+	const uint32_t *i2c_addr;
+	int len;
+
+	i2c_addr = fdt_getprop(fdt, offset, "i2c-address", &len);
+	if (len != sizeof(*i2c_addr)) {
+		dprintf(CRITICAL, "Invalid/missing 'i2c-address' for regmap %s (len %d)\n",
+			qup_i2c->map.name, len);
+		return false;
+	}
+
+	qup_i2c->addr = fdt32_to_cpu(*i2c_addr);
+	return true;
+}
@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef __LK2ND_REGMAP_QUP_I2C_H
+#define __LK2ND_REGMAP_QUP_I2C_H
+#include "regmap.h"
+#include <i2c_qup.h>
+
+struct regmap_qup_i2c {
+	struct regmap map;
+	struct qup_i2c_dev *dev;
+	uint8_t addr;
+};
+
+status_t regmap_qup_i2c_raw_read(const struct regmap *map, uint8_t reg, void *val, size_t count);
+status_t regmap_qup_i2c_raw_write(const struct regmap *map, uint8_t reg, const void *val, size_t count);
+
+#define REGMAP_QUP_I2C(_name) { \
+	.name = _name, \
+	.raw_read = regmap_qup_i2c_raw_read, \
+	.raw_write = regmap_qup_i2c_raw_write, \
+}
+
+struct qup_i2c_dev *qup_i2c_read_bus(const void *fdt, int offset);
+bool regmap_qup_i2c_read_addr(const void *fdt, int offset, struct regmap_qup_i2c *map);
+
+#endif
@@ -3,3 +3,9 @@ MODULES += dev/gpio_i2c
 OBJS += \
 	$(LOCAL_DIR)/regmap.o \
 	$(LOCAL_DIR)/regmap-gpio-i2c.o
+
+# Hardware I2C through the BLSP QUPs, selected per device with 'i2c-qup'
+ifneq ($(filter PERIPH_BLK_BLSP=1,$(DEFINES)),)
+DEFINES += LK2ND_REGMAP_QUP_I2C=1
+OBJS += $(LOCAL_DIR)/regmap-qup-i2c.o
+endif
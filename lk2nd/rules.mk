@@ -8,6 +8,8 @@ OBJS += \
 	$(LOCAL_DIR)/lk2nd-smd-rpm.o \
 	$(LOCAL_DIR)/target_keys_lk2nd.o
 
+MODULES += lk2nd/bench
+
 ifneq ($(GPIO_I2C_BUS_COUNT),)
 MODULES += lk2nd/regmap
 OBJS += $(LOCAL_DIR)/lk2nd-samsung.o
@@ -17,6 +19,7 @@ ifeq ($(TARGET),msm8916)
 MODULES += lk2nd/smb1360
 endif
 
+# Set LK2ND_SMP_WORKERS := 1 to run lib/workpool jobs on the secondary CPUs
 ifneq ($(SMP_SPIN_TABLE_BASE),)
 MODULES += lk2nd/smp
 DEFINES += SMP_SPIN_TABLE_BASE=$(SMP_SPIN_TABLE_BASE)
@@ -4,6 +4,9 @@
 #include <platform/timer.h>
 #include "smb1360-i2c.h"
 #include "../regmap/regmap-gpio-i2c.h"
+#if LK2ND_REGMAP_QUP_I2C
+#include "../regmap/regmap-qup-i2c.h"
+#endif
 
 /* FG registers (on different I2C address) */
 #define FG_CFG_I2C_ADDR			0x1
@@ -28,6 +31,23 @@ static const struct regmap_gpio_i2c fg_regmap = {
 	.addr = SMB1360_FG_I2C_ADDR,
 };
 
+#if LK2ND_REGMAP_QUP_I2C
+static struct regmap_qup_i2c qup_regmap = {
+	.map = REGMAP_QUP_I2C("smb1360"),
+	.addr = SMB1360_I2C_ADDR,
+};
+
+static struct regmap_qup_i2c qup_fg_regmap = {
+	.map = REGMAP_QUP_I2C("smb1360-fg"),
+	.addr = SMB1360_FG_I2C_ADDR,
+};
+
+static const struct smb1360 smb1360_qup = {
+	.regmap = &qup_regmap.map,
+	.fg_regmap = &qup_fg_regmap.map,
+};
+#endif
+
 static const struct smb1360 smb1360 = {
 	.regmap = &regmap.map,
 	.fg_regmap = &fg_regmap.map,
@@ -35,6 +55,16 @@ static const struct smb1360 smb1360 = {
 
 const struct smb1360 *smb1360_setup_i2c(const void *fdt, int offset)
 {
+#if LK2ND_REGMAP_QUP_I2C
+	struct qup_i2c_dev *dev = qup_i2c_read_bus(fdt, offset);
+
+	if (dev) {
+		qup_regmap.dev = dev;
+		qup_fg_regmap.dev = dev;
+		return &smb1360_qup;
+	}
+#endif
+
 	if (!gpio_i2c_read_pins(fdt, offset, &gpio_i2c))
 		return NULL;
 
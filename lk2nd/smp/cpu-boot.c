@@ -72,13 +72,6 @@
 #define QCOM_SCM_BOOT_MC_FLAG_COLDBOOT	BIT(1)
 #define QCOM_SCM_BOOT_MC_FLAG_WARMBOOT	BIT(2)
 
-static inline uint32_t read_mpidr(void)
-{
-	uint32_t res;
-	__asm__ ("mrc p15, 0, %0, c0, c0, 5" : "=r" (res));
-	return res & 0x00ffffff;
-}
-
 int qcom_set_boot_addr(uint32_t addr, bool arm64)
 {
 	uint32_t aarch64 = arm64 ? QCOM_SCM_BOOT_MC_FLAG_AARCH64 : 0;
@@ -209,6 +202,42 @@ void qcom_power_up_arm_cortex(uint32_t mpidr, uint32_t base)
 	udelay(100);
 }
 
+/*
+ * Reverse of qcom_power_up_arm_cortex(): clamp and reset the core, then
+ * close its head switch. The core must not hold any dirty cache lines.
+ * It is left in the state qcom_power_up_arm_cortex() starts from.
+ */
+void qcom_power_down_arm_cortex(uint32_t mpidr, uint32_t base)
+{
+	uint32_t pwr_ctl;
+
+	if (mpidr == read_mpidr())
+		return;
+
+	pwr_ctl = readl(base + CPU_PWR_CTL);
+	pwr_ctl &= ~CPU_PWR_CTL_CORE_PWRD_UP;
+	writel(pwr_ctl, base + CPU_PWR_CTL);
+	dsb();
+
+	pwr_ctl |= CPU_PWR_CTL_CLAMP;
+	writel(pwr_ctl, base + CPU_PWR_CTL);
+	dsb();
+	udelay(2);
+
+	pwr_ctl |= CPU_PWR_CTL_CORE_RST | CPU_PWR_CTL_COREPOR_RST;
+	writel(pwr_ctl, base + CPU_PWR_CTL);
+	dsb();
+
+	pwr_ctl &= ~CPU_PWR_CTL_CORE_MEM_HS;
+	pwr_ctl |= CPU_PWR_CTL_CORE_MEM_CLAMP;
+	writel(pwr_ctl, base + CPU_PWR_CTL);
+	dsb();
+	udelay(2);
+
+	writel(0, base + APC_PWR_GATE_CTL);
+	dsb();
+}
+
 /*
  * The MSM8974 CPU boot sequence is adapted from the Linux kernel:
  * https://git.kernel.org/pub/scm/linux/kernel/git/torvalds/linux.git/tree/arch/arm/mach-qcom/platsmp.c
@@ -277,3 +306,17 @@ void qcom_power_up_kpssv2(uint32_t mpidr, uint32_t reg, uint32_t l2_saw_base)
 	/* Give CPU some time to boot */
 	udelay(100);
 }
+
+/*
+ * Hold the core in reset with its outputs clamped, which is the state
+ * qcom_power_up_kpssv2() starts from. The head switch is left alone.
+ */
+void qcom_power_down_kpssv2(uint32_t mpidr, uint32_t reg)
+{
+	if (mpidr == read_mpidr())
+		return;
+
+	writel(CPU_PWR_CTL_COREPOR_RST | CPU_PWR_CTL_CLAMP, reg + CPU_PWR_CTL);
+	dsb();
+	udelay(2);
+}
@@ -3,8 +3,17 @@
 #ifndef __LK2ND_SMP_CPU_BOOT_H
 #define __LK2ND_SMP_CPU_BOOT_H
 
+static inline uint32_t read_mpidr(void)
+{
+	uint32_t res;
+	__asm__ ("mrc p15, 0, %0, c0, c0, 5" : "=r" (res));
+	return res & 0x00ffffff;
+}
+
 int qcom_set_boot_addr(uint32_t addr, bool arm64);
 void qcom_power_up_arm_cortex(uint32_t mpidr, uint32_t base);
 void qcom_power_up_kpssv2(uint32_t mpidr, uint32_t base, uint32_t l2_saw_base);
+void qcom_power_down_arm_cortex(uint32_t mpidr, uint32_t base);
+void qcom_power_down_kpssv2(uint32_t mpidr, uint32_t base);
 
 #endif
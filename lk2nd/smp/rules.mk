@@ -2,3 +2,13 @@ LOCAL_DIR := $(GET_LOCAL_DIR)
 OBJS += \
 	$(LOCAL_DIR)/cpu-boot.o \
 	$(LOCAL_DIR)/spin-table.o
+
+ifeq ($(LK2ND_SMP_WORKERS),1)
+MODULES += lib/workpool
+DEFINES += LK2ND_SMP_WORKERS=1
+# The workers share LK's translation table, map normal memory shareable
+DEFINES += ARM_MMU_SHAREABLE=1
+OBJS += \
+	$(LOCAL_DIR)/worker.o \
+	$(LOCAL_DIR)/worker-entry.o
+endif
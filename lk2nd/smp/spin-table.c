@@ -6,11 +6,7 @@
 #include <scm.h>
 
 #include "cpu-boot.h"
-
-struct smp_spin_table {
-	uint8_t code[4096];
-	uint64_t release_addr;
-};
+#include "spin-table.h"
 
 static uint8_t smp_spin_table_a64[] = {
 	0x5f, 0x20, 0x03, 0xd5,	/* wfe */
@@ -26,7 +22,7 @@ static uint8_t smp_spin_table_a32[] = {
 	0x1e, 0xff, 0x2f, 0xe1,	/* bx	lr */
 };
 
-static int lkfdt_lookup_phandle(void *fdt, int node, const char *prop_name)
+static int lkfdt_lookup_phandle(const void *fdt, int node, const char *prop_name)
 {
 	const uint32_t *phandle;
 	int len;
@@ -40,48 +36,49 @@ static int lkfdt_lookup_phandle(void *fdt, int node, const char *prop_name)
 	return fdt_node_offset_by_phandle(fdt, fdt32_to_cpu(*phandle));
 }
 
-static void smp_spin_table_setup_cpu(struct smp_spin_table *table,
-				     void *fdt, int cpu_node)
+int smp_cpu_get_mpidr(const void *fdt, int cpu_node, uint32_t *cpu)
 {
 	const uint32_t *val;
-	int node, len, ret;
-	uint32_t cpu, base;
+	int len;
 
 	val = fdt_getprop(fdt, cpu_node, "reg", &len);
 	if (len != sizeof(*val)) {
 		dprintf(CRITICAL, "Cannot read reg property of CPU node: %d\n", len);
-		return;
-	}
-	cpu = fdt32_to_cpu(*val);
-	dprintf(INFO, "Booting CPU%x\n", cpu);
-
-	/* Adjust device tree with properties needed for spin-table */
-	ret = fdt_setprop_u64(fdt, cpu_node, "cpu-release-addr",
-			      (uintptr_t)&table->release_addr);
-	if (ret) {
-		dprintf(CRITICAL, "Failed to set cpu-release-addr: %d\n", ret);
-		return;
+		return -1;
 	}
+	*cpu = fdt32_to_cpu(*val);
+	return 0;
+}
 
-	ret = fdt_setprop_string(fdt, cpu_node, "enable-method", "spin-table");
-	if (ret) {
-		dprintf(CRITICAL, "Failed to update enable-method: %d\n", ret);
-		return;
-	}
+int smp_cpu_get_acc(const void *fdt, int cpu_node, uint32_t *base)
+{
+	const uint32_t *val;
+	int node, len;
 
-	/* Power up the CPU core using registers in the ACC node */
 	node = lkfdt_lookup_phandle(fdt, cpu_node, "qcom,acc");
 	if (node < 0) {
 		dprintf(CRITICAL, "Cannot find qcom,acc node: %d\n", node);
-		return;
+		return -1;
 	}
 
 	val = fdt_getprop(fdt, node, "reg", &len);
 	if (len < sizeof(*val)) {
 		dprintf(CRITICAL, "Cannot read reg property of qcom,acc node: %d\n", len);
-		return;
+		return -1;
 	}
-	base = fdt32_to_cpu(*val);
+	*base = fdt32_to_cpu(*val);
+	return 0;
+}
+
+int smp_cpu_power_up(const void *fdt, int cpu_node, uint32_t cpu)
+{
+	const uint32_t *val;
+	int node, len;
+	uint32_t base;
+
+	/* Power up the CPU core using registers in the ACC node */
+	if (smp_cpu_get_acc(fdt, cpu_node, &base))
+		return -1;
 
 #if TARGET_MSM8916 || TARGET_MSM8226
 	qcom_power_up_arm_cortex(cpu, base);
@@ -89,25 +86,67 @@ static void smp_spin_table_setup_cpu(struct smp_spin_table *table,
 	node = lkfdt_lookup_phandle(fdt, cpu_node, "next-level-cache");
 	if (node < 0) {
 		dprintf(CRITICAL, "Cannot find next-level-cache: %d\n", node);
-		return;
+		return -1;
 	}
 
 	node = lkfdt_lookup_phandle(fdt, node, "qcom,saw");
 	if (node < 0) {
 		dprintf(CRITICAL, "Cannot find L2 SAW node: %d\n", node);
-		return;
+		return -1;
 	}
 
 	val = fdt_getprop(fdt, node, "reg", &len);
 	if (len < sizeof(*val)) {
 		dprintf(CRITICAL, "Cannot read reg property of L2 qcom,saw node: %d\n", len);
-		return;
+		return -1;
 	}
 	qcom_power_up_kpssv2(cpu, base, fdt32_to_cpu(*val));
 #else
 #error Unsupported target for CPU spin-table!
 #endif
 
+	return 0;
+}
+
+/* Power down a CPU core brought up with smp_cpu_power_up() */
+void smp_cpu_power_down(uint32_t cpu, uint32_t acc)
+{
+#if TARGET_MSM8916 || TARGET_MSM8226
+	qcom_power_down_arm_cortex(cpu, acc);
+#elif TARGET_MSM8974
+	qcom_power_down_kpssv2(cpu, acc);
+#else
+#error Unsupported target for CPU spin-table!
+#endif
+}
+
+static void smp_spin_table_setup_cpu(struct smp_spin_table *table,
+				     void *fdt, int cpu_node)
+{
+	int node, ret;
+	uint32_t cpu;
+
+	if (smp_cpu_get_mpidr(fdt, cpu_node, &cpu))
+		return;
+	dprintf(INFO, "Booting CPU%x\n", cpu);
+
+	/* Adjust device tree with properties needed for spin-table */
+	ret = fdt_setprop_u64(fdt, cpu_node, "cpu-release-addr",
+			      (uintptr_t)&table->release_addr);
+	if (ret) {
+		dprintf(CRITICAL, "Failed to set cpu-release-addr: %d\n", ret);
+		return;
+	}
+
+	ret = fdt_setprop_string(fdt, cpu_node, "enable-method", "spin-table");
+	if (ret) {
+		dprintf(CRITICAL, "Failed to update enable-method: %d\n", ret);
+		return;
+	}
+
+	if (smp_cpu_power_up(fdt, cpu_node, cpu))
+		return;
+
 	/* Enable the SAW/SPM node for CPU idle functionality */
 	node = lkfdt_lookup_phandle(fdt, cpu_node, "qcom,saw");
 	if (node < 0) {
@@ -157,6 +196,24 @@ static void smp_spin_table_setup_idle_states(void *fdt, int node)
 	}
 }
 
+int smp_spin_table_install(struct smp_spin_table *table, bool arm64)
+{
+	int ret;
+
+	if (arm64)
+		memcpy(table->code, smp_spin_table_a64, sizeof(smp_spin_table_a64));
+	else
+		memcpy(table->code, smp_spin_table_a32, sizeof(smp_spin_table_a32));
+
+	table->release_addr = 0;
+
+	ret = qcom_set_boot_addr((uint32_t)table, arm64);
+	if (ret)
+		dprintf(CRITICAL, "Failed to set CPU boot address: %d\n", ret);
+
+	return ret;
+}
+
 /*
  * If the other CPU cores are booted in aarch64 state before the main CPU
  * switches to aarch64, qhypstub has no way to detect that and will boot them
@@ -221,18 +278,8 @@ void smp_spin_table_setup(struct smp_spin_table *table, void *fdt,
 		return;
 	}
 
-	if (arm64)
-		memcpy(table->code, smp_spin_table_a64, sizeof(smp_spin_table_a64));
-	else
-		memcpy(table->code, smp_spin_table_a32, sizeof(smp_spin_table_a32));
-
-	table->release_addr = 0;
-
-	ret = qcom_set_boot_addr((uint32_t)table, arm64);
-	if (ret) {
-		dprintf(CRITICAL, "Failed to set CPU boot address: %d\n", ret);
+	if (smp_spin_table_install(table, arm64))
 		return;
-	}
 
 #if TARGET_MSM8916
 	if (arm64)
@@ -0,0 +1,19 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef __LK2ND_SMP_SPIN_TABLE_H
+#define __LK2ND_SMP_SPIN_TABLE_H
+
+#include <stdint.h>
+
+struct smp_spin_table {
+	uint8_t code[4096];
+	uint64_t release_addr;
+};
+
+int smp_spin_table_install(struct smp_spin_table *table, bool arm64);
+int smp_cpu_get_mpidr(const void *fdt, int cpu_node, uint32_t *cpu);
+int smp_cpu_get_acc(const void *fdt, int cpu_node, uint32_t *base);
+int smp_cpu_power_up(const void *fdt, int cpu_node, uint32_t cpu);
+void smp_cpu_power_down(uint32_t cpu, uint32_t acc);
+
+#endif
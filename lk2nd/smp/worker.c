@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: GPL-2.0-only
+#include <arch/arm.h>
+#include <arch/arm/mmu.h>
+#include <arch/defines.h>
+#include <arch/ops.h>
+#include <debug.h>
+#include <kernel/thread.h>
+#include <lib/workpool.h>
+#include <libfdt.h>
+#include <lk2nd.h>
+#include <malloc.h>
+#include <platform.h>
+#include <psci.h>
+#include <scm.h>
+
+#include "cpu-boot.h"
+#include "spin-table.h"
+
+#define SMP_WORKER_MAX_CPUS	8
+#define SMP_WORKER_STACK_SIZE	4096
+#define SMP_WORKER_TIMEOUT	100 /* ms */
+
+/* Keep in sync with the offsets in worker-entry.S */
+struct smp_worker_boot {
+	uint32_t ttbr0;
+	uint32_t dacr;
+	uint32_t sctlr;
+	uint32_t vbar;
+	uint32_t stacks[SMP_WORKER_MAX_CPUS];
+	uint32_t parked[SMP_WORKER_MAX_CPUS];
+};
+
+struct smp_worker_boot smp_worker_boot __ALIGNED(CACHE_LINE);
+static struct smp_spin_table *smp_worker_table;
+static uint32_t smp_worker_cpu[SMP_WORKER_MAX_CPUS];
+static uint32_t smp_worker_acc[SMP_WORKER_MAX_CPUS];
+
+extern void smp_worker_entry(void);
+extern void smp_worker_exit(uint32_t *parked) __NO_RETURN;
+
+static inline unsigned smp_worker_index(uint32_t mpidr)
+{
+	return (mpidr & 0xff) + ((mpidr >> 8) & 0xff) * 4;
+}
+
+static void smp_worker_sync(void)
+{
+	arch_clean_invalidate_cache_range((addr_t)&smp_worker_boot,
+					  ROUNDUP(sizeof(smp_worker_boot), CACHE_LINE));
+}
+
+/* Called from smp_worker_entry with MMU and caches enabled */
+void smp_worker_main(unsigned idx)
+{
+#if ARM_WITH_NEON
+	uint32_t val;
+
+	/* enable cp10 and cp11 */
+	__asm__ volatile("mrc	p15, 0, %0, c1, c0, 2" : "=r" (val));
+	val |= (3<<22)|(3<<20);
+	__asm__ volatile("mcr	p15, 0, %0, c1, c0, 2" :: "r" (val));
+	isb();
+
+	/* set enable bit in fpexc */
+	__asm__ volatile("mrc  p10, 7, %0, c8, c0, 0" : "=r" (val));
+	val |= (1<<30);
+	__asm__ volatile("mcr  p10, 7, %0, c8, c0, 0" :: "r" (val));
+#endif
+
+	workpool_worker();
+
+	/*
+	 * The job data is coherent with CPU0 and written back by whoever
+	 * uses it, only the stack is private to this CPU. Clean it by MVA,
+	 * set/way maintenance would also hit the L2 that CPU0 is using.
+	 */
+	arch_clean_invalidate_cache_range(smp_worker_boot.stacks[idx] - SMP_WORKER_STACK_SIZE,
+					  SMP_WORKER_STACK_SIZE);
+	smp_worker_exit(&smp_worker_boot.parked[idx]);
+}
+
+static bool smp_worker_psci_available(void)
+{
+	scmcall_arg arg = {PSCI_0_2_FN_PSCI_VERSION};
+
+	if (!is_scm_armv8_support())
+		return false;
+
+	return scm_call2(&arg, NULL) != PSCI_RET_NOT_SUPPORTED;
+}
+
+void smp_workers_start(struct smp_spin_table *table)
+{
+	void *fdt = lk2nd_dev.fdt;
+	uint32_t cpu, self = read_mpidr();
+	unsigned idx, started = 0;
+	int offset, node;
+	time_t start;
+	void *stack;
+
+	if (!fdt)
+		return;
+
+	/* CPUs are managed by the firmware, they must stay off */
+	if (smp_worker_psci_available()) {
+		dprintf(INFO, "PSCI detected, not starting SMP workers\n");
+		return;
+	}
+
+	offset = fdt_path_offset(fdt, "/cpus");
+	if (offset < 0) {
+		dprintf(INFO, "Cannot find /cpus node, not starting SMP workers: %d\n",
+			offset);
+		return;
+	}
+
+	memset(&smp_worker_boot, 0, sizeof(smp_worker_boot));
+	__asm__ volatile("mrc	p15, 0, %0, c2, c0, 0" : "=r" (smp_worker_boot.ttbr0));
+	__asm__ volatile("mrc	p15, 0, %0, c3, c0, 0" : "=r" (smp_worker_boot.dacr));
+	__asm__ volatile("mrc	p15, 0, %0, c12, c0, 0" : "=r" (smp_worker_boot.vbar));
+	smp_worker_boot.sctlr = arm_read_cr1();
+
+	if (smp_spin_table_install(table, false))
+		return;
+	table->release_addr = (uintptr_t)smp_worker_entry;
+	arch_clean_cache_range((addr_t)table, sizeof(*table));
+	smp_worker_table = table;
+
+	fdt_for_each_subnode(node, fdt, offset) {
+		const char *name;
+		int len;
+
+		name = fdt_get_name(fdt, node, &len);
+		if (len < strlen("cpu@") || name[len] ||
+		    strncmp(name, "cpu@", strlen("cpu@")))
+			continue;
+		if (smp_cpu_get_mpidr(fdt, node, &cpu) || cpu == self)
+			continue;
+
+		idx = smp_worker_index(cpu);
+		if (idx >= SMP_WORKER_MAX_CPUS)
+			continue;
+		if (smp_cpu_get_acc(fdt, node, &smp_worker_acc[idx]))
+			continue;
+		smp_worker_cpu[idx] = cpu;
+
+		stack = memalign(CACHE_LINE, SMP_WORKER_STACK_SIZE);
+		if (!stack)
+			break;
+
+		smp_worker_boot.stacks[idx] = (uint32_t)stack + SMP_WORKER_STACK_SIZE;
+		smp_worker_sync();
+
+		dprintf(INFO, "Starting SMP worker on CPU%x\n", cpu);
+		if (smp_cpu_power_up(fdt, node, cpu)) {
+			smp_worker_boot.stacks[idx] = 0;
+			smp_worker_sync();
+			free(stack);
+			continue;
+		}
+		started++;
+	}
+
+	start = current_time();
+	while (workpool_num_workers() < started &&
+	       current_time() - start < SMP_WORKER_TIMEOUT)
+		thread_sleep(1);
+
+	dprintf(INFO, "SMP workers: %d of %u CPUs online\n",
+		workpool_num_workers(), started);
+}
+
+/*
+ * Stop the workers and power their CPUs down again, which is the state
+ * both the spin-table code and the CPU boot method of the kernel start
+ * from. Called from boot_linux() before the device tree is updated.
+ */
+void smp_workers_stop(void)
+{
+	unsigned idx;
+	time_t start;
+
+	if (!smp_worker_table)
+		return;
+
+	/* CPUs restarted later must not enter the work pool again */
+	smp_worker_table->release_addr = 0;
+	arch_clean_cache_range((addr_t)smp_worker_table, sizeof(*smp_worker_table));
+
+	workpool_stop();
+
+	start = current_time();
+	for (idx = 0; idx < SMP_WORKER_MAX_CPUS; idx++) {
+		if (!smp_worker_boot.stacks[idx])
+			continue;
+
+		do {
+			arch_invalidate_cache_range((addr_t)&smp_worker_boot,
+						    ROUNDUP(sizeof(smp_worker_boot), CACHE_LINE));
+		} while (!smp_worker_boot.parked[idx] &&
+			 current_time() - start < SMP_WORKER_TIMEOUT);
+
+		if (!smp_worker_boot.parked[idx])
+			dprintf(CRITICAL, "SMP worker %u did not park\n", idx);
+
+		smp_cpu_power_down(smp_worker_cpu[idx], smp_worker_acc[idx]);
+		free((void *)(smp_worker_boot.stacks[idx] - SMP_WORKER_STACK_SIZE));
+		smp_worker_boot.stacks[idx] = 0;
+	}
+
+	smp_worker_table = NULL;
+	dprintf(INFO, "SMP workers stopped\n");
+}
@@ -1,9 +1,14 @@
 #include <stdlib.h>
 #include <debug.h>
+#include <err.h>
+#include <bits.h>
+#include <spmi.h>
 #include <target.h>
 #include <dev/keys.h>
 #include <pm8x41.h>
+#include <pm8x41_hw.h>
 #include <platform/gpio.h>
+#include <platform/irqs.h>
 #include <platform/timer.h>
 #include <lk2nd.h>
 
@@ -94,6 +99,134 @@ int target_volume_down() {
 	return target_key_pressed(KEY_VOLUMEDOWN);
 }
 
+/* PMIC peripherals and TLMM gpios the menu key interrupts come from */
+#define KEY_IRQ_MAX	4
+
+static uint32_t key_irq_periph[KEY_IRQ_MAX];
+static uint8_t key_irq_mask[KEY_IRQ_MAX];
+static int key_irq_periphs;
+static uint32_t key_irq_gpio[KEY_IRQ_MAX];
+static int key_irq_gpios;
+
+static int target_keys_irq_add_periph(uint32_t base, uint8_t mask,
+				      int_handler handler, void *arg)
+{
+	int i, ret;
+
+	for (i = 0; i < key_irq_periphs; i++) {
+		if (key_irq_periph[i] == base) {
+			key_irq_mask[i] |= mask;
+			return NO_ERROR;
+		}
+	}
+
+	if (key_irq_periphs == KEY_IRQ_MAX)
+		return ERR_NO_MEMORY;
+
+	ret = spmi_register_periph_irq(base, handler, arg);
+	if (ret)
+		return ret;
+
+	key_irq_periph[key_irq_periphs] = base;
+	key_irq_mask[key_irq_periphs] = mask;
+	key_irq_periphs++;
+	return NO_ERROR;
+}
+
+static int target_keys_irq_add_gpio(uint32_t gpio, int_handler handler, void *arg)
+{
+#ifdef TLMM_MSM_SUMM_IRQ
+	int ret;
+
+	if (key_irq_gpios == KEY_IRQ_MAX)
+		return ERR_NO_MEMORY;
+
+	ret = gpio_tlmm_register_irq(gpio, handler, arg);
+	if (ret)
+		return ret;
+
+	key_irq_gpio[key_irq_gpios++] = gpio;
+	return NO_ERROR;
+#else
+	return ERR_NOT_SUPPORTED;
+#endif
+}
+
+int target_keys_irq_enable(int_handler handler, void *arg)
+{
+	bool vol_up = false, vol_down = false;
+	int i, ret;
+
+	/* The menus read the power key from PON directly */
+	ret = target_keys_irq_add_periph(PON_PERIPHERAL_BASE, BIT(KPDPWR_ON_INT_BIT),
+					 handler, arg);
+
+	for (i = 0; !ret && keymap && keymap[i].key; i++) {
+		if (keymap[i].key == KEY_VOLUMEUP)
+			vol_up = true;
+		else if (keymap[i].key == KEY_VOLUMEDOWN)
+			vol_down = true;
+		else
+			continue;
+
+		switch (keymap[i].type) {
+			case KEY_RESIN:
+				ret = target_keys_irq_add_periph(PON_PERIPHERAL_BASE,
+						BIT(RESIN_ON_INT_BIT), handler, arg);
+				break;
+			case KEY_PWR:
+				break;
+			case KEY_GPIO:
+				ret = target_keys_irq_add_gpio(keymap[i].gpio, handler, arg);
+				break;
+			case KEY_PM_GPIO:
+				/* Bit 0 is the input level interrupt */
+				ret = target_keys_irq_add_periph(GPIO_N_PERIPHERAL_BASE(keymap[i].gpio),
+						BIT(0), handler, arg);
+				break;
+		}
+	}
+
+	/* The fallback handlers of the target can only be polled */
+	if (!ret && !(vol_up && vol_down))
+		ret = ERR_NOT_SUPPORTED;
+
+	if (ret) {
+		target_keys_irq_disable();
+		return ret;
+	}
+
+	for (i = 0; i < key_irq_periphs; i++)
+		pm8x41_periph_irq_enable(key_irq_periph[i], key_irq_mask[i]);
+
+	return NO_ERROR;
+}
+
+void target_keys_irq_ack(void)
+{
+	int i;
+
+	for (i = 0; i < key_irq_periphs; i++)
+		pm8x41_periph_irq_clear(key_irq_periph[i], key_irq_mask[i]);
+}
+
+void target_keys_irq_disable(void)
+{
+	int i;
+
+	for (i = 0; i < key_irq_periphs; i++) {
+		spmi_unregister_periph_irq(key_irq_periph[i]);
+		pm8x41_periph_irq_disable(key_irq_periph[i], key_irq_mask[i]);
+	}
+	key_irq_periphs = 0;
+
+#ifdef TLMM_MSM_SUMM_IRQ
+	for (i = 0; i < key_irq_gpios; i++)
+		gpio_tlmm_unregister_irq(key_irq_gpio[i]);
+#endif
+	key_irq_gpios = 0;
+}
+
 void lk2nd_target_keystatus()
 {
 	keys_init();
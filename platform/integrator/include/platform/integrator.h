@@ -36,6 +36,14 @@
 #define INTEGRATOR_LEDS_REG_BASE  0x1a000000
 #define INTEGRATOR_GPIO_REG_BASE  0x1b000000
 
+/* counter/timer block, timer 1 and 2 are clocked at 1 MHz */
+#define INTEGRATOR_TIMER1_BASE	(INTEGRATOR_TIMER_REG_BASE + 0x100)
+#define TIMER_LOAD		0x00
+#define TIMER_VALUE		0x04
+#define TIMER_CONTROL		0x08
+#define TIMER_CTRL_32BIT	(1 << 1)
+#define TIMER_CTRL_ENABLE	(1 << 7)
+
 /* uart stuff */
 #define PL011_UARTDR (0)
 #define PL011_UARTRSR (1)
@@ -43,10 +43,10 @@ void platform_early_init(void)
 
 	/* initialize the interrupt controller */
 	platform_init_interrupts();
+#endif
 
 	/* initialize the timer block */
 	platform_init_timer();
-#endif
 }
 
 void platform_init(void)
@@ -22,6 +22,7 @@
  */
 #include <sys/types.h>
 #include <err.h>
+#include <reg.h>
 #include <kernel/thread.h>
 #include <debug.h>
 #include <platform.h>
@@ -57,28 +58,28 @@ status_t platform_set_periodic_timer(platform_timer_callback callback, void *arg
 	return NO_ERROR;
 }
 
-time_t current_time(void)
+static bigtime_t hires_time;
+static uint32_t hires_last;
+
+/* Timer 1 free-runs down from 0xffffffff at 1 MHz, extend it to 64 bits */
+bigtime_t current_time_hires(void)
 {
-#if 0
-	time_t t;
-	uint32_t delta_ticks;
-	uint32_t delta_ticks2;
-	
-retry:
-	delta_ticks = OS_TIMER_TICK_COUNTER_REG;
-	t = system_time;
-	delta_ticks2 = OS_TIMER_TICK_COUNTER_REG;
-	if (delta_ticks2 > delta_ticks)
-		goto retry;
-
-	t += ((ticks_per_interval - delta_ticks2) * tick_interval) / ticks_per_interval;
+	uint32_t now;
+	bigtime_t t;
+
+	enter_critical_section();
+	now = readl(INTEGRATOR_TIMER1_BASE + TIMER_VALUE);
+	hires_time += hires_last - now;
+	hires_last = now;
+	t = hires_time;
+	exit_critical_section();
 
 	return t;
-#else
-	static time_t time = 0;
-	return time++;
-#endif
+}
 
+time_t current_time(void)
+{
+	return current_time_hires() / 1000;
 }
 
 static enum handler_return os_timer_tick(void *arg)
@@ -91,6 +92,12 @@ static enum handler_return os_timer_tick(void *arg)
 
 void platform_init_timer(void)
 {
+	/* free running counter for current_time() */
+	writel(0, INTEGRATOR_TIMER1_BASE + TIMER_CONTROL);
+	writel(0xffffffff, INTEGRATOR_TIMER1_BASE + TIMER_LOAD);
+	writel(TIMER_CTRL_ENABLE | TIMER_CTRL_32BIT, INTEGRATOR_TIMER1_BASE + TIMER_CONTROL);
+	hires_last = 0xffffffff;
+
 #if 0
 	OS_TIMER_CTRL_REG = 0; // stop the timer if it's already running
 
@@ -37,32 +37,26 @@
 #include <platform/clock.h>
 #include <blsp_qup.h>
 
+static struct clk_group_entry usb_clks[] = {
+	{ "usb_iface_clk", 0 },
+	{ "usb_core_clk", 80000000 },
+};
+static struct clk_group usb_clk_group = CLK_GROUP("usb", usb_clks);
+
 void hsusb_clock_init(void)
 {
 	int ret;
-	struct clk *iclk, *cclk;
 
-	ret = clk_get_set_enable("usb_iface_clk", 0, 1);
+	ret = clk_group_enable(&usb_clk_group);
 	if(ret)
 	{
-		dprintf(CRITICAL, "failed to set usb_iface_clk ret = %d\n", ret);
-		ASSERT(0);
-	}
-
-	ret = clk_get_set_enable("usb_core_clk", 80000000, 1);
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set usb_core_clk ret = %d\n", ret);
+		dprintf(CRITICAL, "failed to set usb clocks ret = %d\n", ret);
 		ASSERT(0);
 	}
 
 	mdelay(20);
 
-	iclk = clk_get("usb_iface_clk");
-	cclk = clk_get("usb_core_clk");
-
-	clk_disable(iclk);
-	clk_disable(cclk);
+	clk_group_disable(&usb_clk_group);
 
 	mdelay(20);
 
@@ -76,19 +70,10 @@ void hsusb_clock_init(void)
 
 	mdelay(20);
 
-	ret = clk_enable(iclk);
-
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set usb_iface_clk after async ret = %d\n", ret);
-		ASSERT(0);
-	}
-
-	ret = clk_enable(cclk);
-
+	ret = clk_group_enable(&usb_clk_group);
 	if(ret)
 	{
-		dprintf(CRITICAL, "failed to set usb_iface_clk after async ret = %d\n", ret);
+		dprintf(CRITICAL, "failed to set usb clocks after async ret = %d\n", ret);
 		ASSERT(0);
 	}
 }
@@ -193,41 +178,29 @@ void mdp_gdsc_ctrl(uint8_t enable)
 	}
 }
 
+static struct clk_group_entry mdp_clks[] = {
+	{ "mdp_ahb_clk", 0 },
+	{ "mdss_mdp_clk_src", 320000000 },
+	{ "mdss_vsync_clk", 0 },
+	{ "mdss_mdp_clk", 0 },
+};
+static struct clk_group mdp_clk_group = CLK_GROUP("mdp", mdp_clks);
+
 /* Enable all the MDP branch clocks */
 void mdp_clock_enable(void)
 {
 	int ret;
 
-	ret = clk_get_set_enable("mdp_ahb_clk", 0, 1);
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set mdp_ahb_clk ret = %d\n", ret);
-		ASSERT(0);
-	}
-
 	if (platform_is_msm8939() || platform_is_msm8929())
-		ret = clk_get_set_enable("mdss_mdp_clk_src", 307200000, 1);
+		mdp_clks[1].rate = 307200000;
 	else
 		/* Set MDP clock to 320MHz */
-		ret = clk_get_set_enable("mdss_mdp_clk_src", 320000000, 1);
-
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set mdp_clk_src ret = %d\n", ret);
-		ASSERT(0);
-	}
-
-	ret = clk_get_set_enable("mdss_vsync_clk", 0, 1);
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set mdss vsync clk ret = %d\n", ret);
-		ASSERT(0);
-	}
+		mdp_clks[1].rate = 320000000;
 
-	ret = clk_get_set_enable("mdss_mdp_clk", 0, 1);
+	ret = clk_group_enable(&mdp_clk_group);
 	if(ret)
 	{
-		dprintf(CRITICAL, "failed to set mdp_clk ret = %d\n", ret);
+		dprintf(CRITICAL, "failed to set mdp clocks ret = %d\n", ret);
 		ASSERT(0);
 	}
 }
@@ -235,10 +208,7 @@ void mdp_clock_enable(void)
 /* Disable all the MDP branch clocks */
 void mdp_clock_disable(void)
 {
-	clk_disable(clk_get("mdss_vsync_clk"));
-	clk_disable(clk_get("mdss_mdp_clk"));
-	clk_disable(clk_get("mdss_mdp_clk_src"));
-	clk_disable(clk_get("mdp_ahb_clk"));
+	clk_group_disable(&mdp_clk_group);
 }
 
 /* Disable all the bus clocks needed by MDSS */
@@ -343,40 +313,25 @@ static void ce_async_reset(uint8_t instance)
 	udelay(2);
 }
 
+/* Only CE1 exists on this platform */
+static struct clk_group_entry ce1_clks[] = {
+	{ "ce1_src_clk", 160000000 },
+	{ "ce1_core_clk", 0 },
+	{ "ce1_ahb_clk", 0 },
+	{ "ce1_axi_clk", 0 },
+};
+static struct clk_group ce1_clk_group = CLK_GROUP("ce1", ce1_clks);
+
 void clock_ce_enable(uint8_t instance)
 {
 	int ret;
-	char clk_name[64];
 
-	snprintf(clk_name, sizeof(clk_name), "ce%u_src_clk", instance);
-	ret = clk_get_set_enable(clk_name, 160000000, 1);
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set ce%u_src_clk ret = %d\n", instance, ret);
-		ASSERT(0);
-	}
+	ASSERT(instance == 1);
 
-	snprintf(clk_name, sizeof(clk_name), "ce%u_core_clk", instance);
-	ret = clk_get_set_enable(clk_name, 0, 1);
+	ret = clk_group_enable(&ce1_clk_group);
 	if(ret)
 	{
-		dprintf(CRITICAL, "failed to set ce%u_core_clk ret = %d\n", instance, ret);
-		ASSERT(0);
-	}
-
-	snprintf(clk_name, sizeof(clk_name), "ce%u_ahb_clk", instance);
-	ret = clk_get_set_enable(clk_name, 0, 1);
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set ce%u_ahb_clk ret = %d\n", instance, ret);
-		ASSERT(0);
-	}
-
-	snprintf(clk_name, sizeof(clk_name), "ce%u_axi_clk", instance);
-	ret = clk_get_set_enable(clk_name, 0, 1);
-	if(ret)
-	{
-		dprintf(CRITICAL, "failed to set ce%u_axi_clk ret = %d\n", instance, ret);
+		dprintf(CRITICAL, "failed to set ce%u clocks ret = %d\n", instance, ret);
 		ASSERT(0);
 	}
 
@@ -391,28 +346,9 @@ void clock_ce_enable(uint8_t instance)
 
 void clock_ce_disable(uint8_t instance)
 {
-	struct clk *ahb_clk;
-	struct clk *cclk;
-	struct clk *axi_clk;
-	struct clk *src_clk;
-	char clk_name[64];
-
-	snprintf(clk_name, sizeof(clk_name), "ce%u_src_clk", instance);
-	src_clk = clk_get(clk_name);
-
-	snprintf(clk_name, sizeof(clk_name), "ce%u_ahb_clk", instance);
-	ahb_clk = clk_get(clk_name);
-
-	snprintf(clk_name, sizeof(clk_name), "ce%u_axi_clk", instance);
-	axi_clk = clk_get(clk_name);
-
-	snprintf(clk_name, sizeof(clk_name), "ce%u_core_clk", instance);
-	cclk    = clk_get(clk_name);
+	ASSERT(instance == 1);
 
-	clk_disable(ahb_clk);
-	clk_disable(axi_clk);
-	clk_disable(cclk);
-	clk_disable(src_clk);
+	clk_group_disable(&ce1_clk_group);
 
 	/* Some delay for the clocks to stabalize. */
 	udelay(1);
@@ -31,6 +31,9 @@
 #include <platform/iomap.h>
 #include <platform/gpio.h>
 #include <blsp_qup.h>
+#include <err.h>
+#include <platform/irqs.h>
+#include <kernel/thread.h>
 
 void gpio_tlmm_config(uint32_t gpio, uint8_t func,
 			uint8_t dir, uint8_t pull,
@@ -146,3 +149,88 @@ void gpio_set(unsigned nr, unsigned on)
 		val = 0;
 	writel(val, GPIO_IN_OUT_ADDR(nr));
 }
+
+/* TLMM interrupts are routed to at most this many handlers */
+#define GPIO_MAX_IRQS	4
+
+struct gpio_irq {
+	uint32_t gpio;
+	int_handler handler;
+	void *arg;
+};
+
+static struct gpio_irq gpio_irqs[GPIO_MAX_IRQS];
+static bool gpio_irq_registered;
+
+static enum handler_return gpio_summary_irq(void *arg)
+{
+	enum handler_return ret = INT_NO_RESCHEDULE;
+	struct gpio_irq *irq;
+	int i;
+
+	for (i = 0; i < GPIO_MAX_IRQS; i++) {
+		irq = &gpio_irqs[i];
+		if (!irq->handler || !(readl(GPIO_INTR_STATUS_ADDR(irq->gpio)) & BIT(0)))
+			continue;
+
+		writel(0, GPIO_INTR_STATUS_ADDR(irq->gpio));
+		if (irq->handler(irq->arg) == INT_RESCHEDULE)
+			ret = INT_RESCHEDULE;
+	}
+
+	return ret;
+}
+
+/* Call handler on both edges of an input gpio */
+int gpio_tlmm_register_irq(uint32_t gpio, int_handler handler, void *arg)
+{
+	int i, slot = -1;
+
+	for (i = 0; i < GPIO_MAX_IRQS; i++) {
+		if (gpio_irqs[i].handler && gpio_irqs[i].gpio == gpio)
+			return ERR_ALREADY_EXISTS;
+		if (!gpio_irqs[i].handler && slot < 0)
+			slot = i;
+	}
+	if (slot < 0)
+		return ERR_NO_MEMORY;
+
+	enter_critical_section();
+	gpio_irqs[slot].gpio = gpio;
+	gpio_irqs[slot].arg = arg;
+	gpio_irqs[slot].handler = handler;
+
+	if (!gpio_irq_registered) {
+		register_int_handler(TLMM_MSM_SUMM_IRQ, gpio_summary_irq, NULL);
+		gpio_irq_registered = true;
+	}
+	exit_critical_section();
+
+	writel(GPIO_INTR_TARGET_KPSS | GPIO_INTR_RAW_STATUS | GPIO_INTR_DUAL_EDGE |
+	       GPIO_INTR_POL_HIGH, GPIO_INTR_CFG_ADDR(gpio));
+	writel(0, GPIO_INTR_STATUS_ADDR(gpio));
+	writel(readl(GPIO_INTR_CFG_ADDR(gpio)) | GPIO_INTR_ENABLE, GPIO_INTR_CFG_ADDR(gpio));
+	unmask_interrupt(TLMM_MSM_SUMM_IRQ);
+
+	return NO_ERROR;
+}
+
+void gpio_tlmm_unregister_irq(uint32_t gpio)
+{
+	bool in_use = false;
+	int i;
+
+	writel(0, GPIO_INTR_CFG_ADDR(gpio));
+	writel(0, GPIO_INTR_STATUS_ADDR(gpio));
+
+	enter_critical_section();
+	for (i = 0; i < GPIO_MAX_IRQS; i++) {
+		if (gpio_irqs[i].handler && gpio_irqs[i].gpio == gpio)
+			gpio_irqs[i].handler = NULL;
+		in_use |= !!gpio_irqs[i].handler;
+	}
+	exit_critical_section();
+
+	if (!in_use)
+		mask_interrupt(TLMM_MSM_SUMM_IRQ);
+}
@@ -31,6 +31,7 @@
 
 #include <bits.h>
 #include <gpio.h>
+#include <platform/interrupts.h>
 
 /* GPIO TLMM: Direction */
 #define GPIO_INPUT      0
@@ -60,6 +61,13 @@
 #define GPIO_IN         BIT(0)
 #define GPIO_OUT        BIT(1)
 
+/* GPIO_INTR_CFG register fields. */
+#define GPIO_INTR_ENABLE        BIT(0)
+#define GPIO_INTR_POL_HIGH      BIT(1)
+#define GPIO_INTR_DUAL_EDGE     (3 << 2)
+#define GPIO_INTR_RAW_STATUS    BIT(4)
+#define GPIO_INTR_TARGET_KPSS   (4 << 5)
+
 void gpio_config_uart_dm(uint8_t id);
 uint32_t gpio_status(uint32_t gpio);
 void gpio_set_dir(uint32_t gpio, uint32_t dir);
@@ -71,4 +79,6 @@ void gpio_tlmm_config(uint32_t gpio,
 			uint32_t enable);
 void gpio_set_value(uint32_t gpio, uint32_t value);
 void gpio_config_blsp_i2c(uint8_t blsp_id, uint8_t qup_id);
+int gpio_tlmm_register_irq(uint32_t gpio, int_handler handler, void *arg);
+void gpio_tlmm_unregister_irq(uint32_t gpio);
 #endif
@@ -91,6 +91,8 @@
 #define TLMM_BASE_ADDR              0x1000000
 #define GPIO_CONFIG_ADDR(x)         (TLMM_BASE_ADDR + (x)*0x1000)
 #define GPIO_IN_OUT_ADDR(x)         (TLMM_BASE_ADDR + 0x00000004 + (x)*0x1000)
+#define GPIO_INTR_CFG_ADDR(x)       (TLMM_BASE_ADDR + 0x00000008 + (x)*0x1000)
+#define GPIO_INTR_STATUS_ADDR(x)    (TLMM_BASE_ADDR + 0x0000000C + (x)*0x1000)
 
 #define MPM2_MPM_CTRL_BASE          0x004A0000
 #define MPM2_MPM_PS_HOLD            0x004AB000
@@ -58,6 +58,7 @@ int qtmr_irq();
 #define INT_USB_HS                             USB1_HS_IRQ
 
 #define EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ         (GIC_SPI_START + 190)
+#define TLMM_MSM_SUMM_IRQ                      (GIC_SPI_START + 208)
 
 #define NR_MSM_IRQS                            256
 #define NR_GPIO_IRQS                           173
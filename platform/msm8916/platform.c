@@ -27,6 +27,7 @@
  */
 
 #include <debug.h>
+#include <stdlib.h>
 #include <reg.h>
 #include <platform/iomap.h>
 #include <platform/irqs.h>
@@ -57,6 +58,18 @@
 #define SCRATCH_MEMORY       (MMU_MEMORY_TYPE_NORMAL_WRITE_BACK_ALLOCATE | \
                            MMU_MEMORY_AP_READ_WRITE | MMU_MEMORY_XN)
 
+/* DDR - cacheable, write back, so that kernel and ramdisk copies are fast */
+#define DDR_MEMORY           (MMU_MEMORY_TYPE_NORMAL_WRITE_BACK_ALLOCATE | \
+                           MMU_MEMORY_AP_READ_WRITE | MMU_MEMORY_XN)
+
+/*
+ * DDR from TZ apps onwards holds TZ, the hypervisor, SMEM and the firmware
+ * carveouts (modem, wcnss, venus, rmtfs), some of them XPU protected.
+ * Only DDR below it is mapped cacheable, so speculative accesses cannot
+ * hit a carveout. The regions LK needs above are mapped from the table below.
+ */
+#define DDR_HLOS_END         APP_REGION_ADDR
+
 static mmu_section_t mmu_section_table[] = {
 /*           Physical addr,     Virtual addr,     Size (in MB),     Flags */
 	{    MEMBASE,           MEMBASE,          (MEMSIZE / MB),   LK_MEMORY},
@@ -71,6 +84,9 @@ static mmu_section_t mmu_section_table[] = {
 #ifdef SMP_SPIN_TABLE_BASE
 	{    SMP_SPIN_TABLE_BASE, SMP_SPIN_TABLE_BASE, 1,     COMMON_MEMORY},
 #endif
+#ifdef LK_LOG_RAM_BASE
+	{    LK_LOG_RAM_BASE,   LK_LOG_RAM_BASE,  (LK_LOG_RAM_SIZE + MB - 1) / MB, COMMON_MEMORY},
+#endif
 };
 
 
@@ -125,23 +141,47 @@ int platform_use_identity_mmu_mappings(void)
 	/* Use only the mappings specified in this file. */
 	return 0;
 }
+/* Map the HLOS part of DDR in the SMEM RAM partition table as write back */
+static void platform_map_ddr(void)
+{
+	ram_partition ptn_entry;
+	uint64_t end;
+	uint32_t i, len;
+
+	if (!smem_ram_ptable_init_v1()) {
+		/*
+		 * Mapping the ddr start address for loading the kernel about 96 MB,
+		 * The ddr_start is at 0x80000000 and tz starts at 0x86000000 .
+		 */
+		dprintf(CRITICAL, "Failed to read RAM partition table\n");
+		arm_mmu_map_range(SDRAM_START_ADDR, SDRAM_START_ADDR,
+				  DDR_HLOS_END - SDRAM_START_ADDR, DDR_MEMORY);
+		return;
+	}
+
+	len = smem_get_ram_ptable_len();
+	for (i = 0; i < len; i++) {
+		smem_get_ram_ptable_entry(&ptn_entry, i);
+		if (ptn_entry.type != SYS_MEMORY || ptn_entry.category != SDRAM)
+			continue;
+		if (ptn_entry.start >= DDR_HLOS_END)
+			continue;
+
+		end = MIN(ptn_entry.start + ptn_entry.size, DDR_HLOS_END);
+		arm_mmu_map_range(ptn_entry.start, ptn_entry.start,
+				  end - ptn_entry.start, DDR_MEMORY);
+	}
+}
+
 /* Setup memory for this platform */
 void platform_init_mmu_mappings(void)
 {
 	uint32_t i;
 	uint32_t sections;
 	uint32_t table_size = ARRAY_SIZE(mmu_section_table);
-	uint32_t ddr_start = get_ddr_start();
-
-	/*
-	 * Mapping the ddr start address for loading the kernel about 96 MB,
-	 * The ddr_start is at 0x80000000 and tz starts at 0x86000000 .
-	 */
-	sections = 96;
-	while(sections--)
-	{
-		arm_mmu_map_section(ddr_start + sections * MB, ddr_start + sections* MB, COMMON_MEMORY);
-	}
+
+	platform_map_ddr();
+
 	/* Configure the MMU page entries for memory read from the
 	   mmu_section_table */
 	for (i = 0; i < table_size; i++)
@@ -161,14 +201,8 @@ void platform_init_mmu_mappings(void)
 
 addr_t platform_map_fb(addr_t phys_addr, uint32_t size)
 {
-	if (phys_addr != MIPI_FB_ADDR) {
-		addr_t end = phys_addr + size;
-		addr_t addr;
-		for (addr = phys_addr; addr < end; addr += MB) {
-			arm_mmu_map_section(addr, addr, COMMON_MEMORY);
-		}
-		arm_mmu_flush();
-	}
+	if (phys_addr != MIPI_FB_ADDR)
+		arm_mmu_map_range(phys_addr, phys_addr, size, COMMON_MEMORY);
 
 	return phys_addr;
 }
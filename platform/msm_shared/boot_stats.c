@@ -27,16 +27,25 @@
  */
 
 #include <boot_stats.h>
+#include <compiler.h>
 #include <debug.h>
 #include <reg.h>
 #include <platform/iomap.h>
 
 static uint32_t kernel_load_start;
+
+/* Overridden by spmi.c on platforms with a PMIC arbiter */
+__WEAK void spmi_stats_mark(enum bs_entry bs_id)
+{
+}
+
 void bs_set_timestamp(enum bs_entry bs_id)
 {
 	addr_t bs_imem = get_bs_info_addr();
 	uint32_t clk_count = 0;
 
+	spmi_stats_mark(bs_id);
+
 	if(bs_imem) {
 		if (bs_id >= BS_MAX) {
 			dprintf(CRITICAL, "bad bs id: %u, max: %u\n", bs_id, BS_MAX);
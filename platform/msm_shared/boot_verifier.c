@@ -391,6 +391,7 @@ static void read_oem_keystore()
 	{
 		oem_keystore = ks;
 		user_keystore = ks;
+		image_rsa_key_cache(ks->mykeybag->mykey->key_material);
 	}
 }
 
@@ -34,9 +34,20 @@
 #include <bits.h>
 #include <clock.h>
 #include <string.h>
+#include <platform.h>
+
+#define CLK_MAX_PENDING 16
 
 static struct clk_list msm_clk_list;
 
+/* Clocks whose status is polled at the end of clk_group_enable() */
+static struct clk_pending {
+	struct clk *clk;
+	bool (*ready)(struct clk *clk);
+} clk_pending[CLK_MAX_PENDING];
+static unsigned clk_pending_num;
+static bool clk_pending_defer;
+
 int clk_set_parent(struct clk *clk, struct clk *parent)
 {
 	if (!clk->ops->set_parent)
@@ -200,6 +211,89 @@ get_set_enable_error:
 	return ret;
 }
 
+bool clk_defer_status(struct clk *clk, bool (*ready)(struct clk *clk))
+{
+	if (!clk_pending_defer || clk_pending_num == CLK_MAX_PENDING)
+		return false;
+
+	clk_pending[clk_pending_num].clk = clk;
+	clk_pending[clk_pending_num].ready = ready;
+	clk_pending_num++;
+	return true;
+}
+
+static void clk_wait_pending(void)
+{
+	unsigned i;
+
+	while (clk_pending_num) {
+		for (i = 0; i < clk_pending_num;) {
+			if (clk_pending[i].ready(clk_pending[i].clk))
+				clk_pending[i] = clk_pending[--clk_pending_num];
+			else
+				i++;
+		}
+	}
+}
+
+int clk_group_enable(struct clk_group *group)
+{
+	struct clk_group_entry *entry;
+	bigtime_t start = current_time_hires();
+	int ret = NO_ERROR;
+	unsigned i;
+
+	clk_pending_defer = true;
+
+	for (i = 0; i < group->num; i++) {
+		entry = &group->clks[i];
+
+		if (!entry->clk) {
+			entry->clk = clk_get(entry->id);
+			if (!entry->clk) {
+				ret = ERR_NOT_VALID;
+				break;
+			}
+		}
+
+		if (entry->rate) {
+			ret = clk_set_rate(entry->clk, entry->rate);
+			if (ret) {
+				dprintf(CRITICAL, "Failed to set rate of %s: %d\n",
+					entry->id, ret);
+				break;
+			}
+		}
+
+		ret = clk_enable(entry->clk);
+		if (ret) {
+			dprintf(CRITICAL, "Failed to enable %s: %d\n", entry->id, ret);
+			break;
+		}
+	}
+
+	clk_pending_defer = false;
+	clk_wait_pending();
+
+	if (ret) {
+		while (i--)
+			clk_disable(group->clks[i].clk);
+		return ret;
+	}
+
+	dprintf(INFO, "Clock group %s enabled in %llu us\n", group->name,
+		current_time_hires() - start);
+	return NO_ERROR;
+}
+
+void clk_group_disable(struct clk_group *group)
+{
+	unsigned i = group->num;
+
+	while (i--)
+		clk_disable(group->clks[i].clk);
+}
+
 #ifdef DEBUG_CLOCK
 struct clk_list *clk_get_list()
 {
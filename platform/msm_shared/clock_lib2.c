@@ -51,6 +51,13 @@ void cxo_clk_disable(struct clk *clk)
 /*=============== Branch clock ops =============*/
 
 /* Branch clock enable */
+static bool clock_lib2_branch_clk_ready(struct clk *clk)
+{
+	struct branch_clk *bclk = to_branch_clk(clk);
+
+	return !(readl(bclk->cbcr_reg) & CBCR_BRANCH_OFF_BIT);
+}
+
 int clock_lib2_branch_clk_enable(struct clk *clk)
 {
 	int rc = 0;
@@ -62,7 +69,8 @@ int clock_lib2_branch_clk_enable(struct clk *clk)
 	writel(cbcr_val, bclk->cbcr_reg);
 
 	/* wait until status shows it is enabled */
-	while(readl(bclk->cbcr_reg) & CBCR_BRANCH_OFF_BIT);
+	if (!clk_defer_status(clk, clock_lib2_branch_clk_ready))
+		while(!clock_lib2_branch_clk_ready(clk));
 
 	return rc;
 }
@@ -195,22 +203,27 @@ void clock_lib2_rcg_set_rate_hid(struct rcg_clk *rclk, struct clk_freq_tbl *freq
 
 /*=============== Vote clock ops =============*/
 
+static bool clock_lib2_vote_clk_ready(struct clk *c)
+{
+	struct vote_clk *vclk = to_local_vote_clk(c);
+	uint32_t val = readl(vclk->cbcr_reg) & BRANCH_CHECK_MASK;
+
+	return val == BRANCH_ON_VAL || val == BRANCH_NOC_FSM_ON_VAL;
+}
+
 /* Vote clock enable */
 int clock_lib2_vote_clk_enable(struct clk *c)
 {
 	uint32_t vote_regval;
-	uint32_t val;
 	struct vote_clk *vclk = to_local_vote_clk(c);
 
 	vote_regval = readl(vclk->vote_reg);
 	vote_regval |= vclk->en_mask;
 	writel_relaxed(vote_regval, vclk->vote_reg);
-	do {
-		val = readl(vclk->cbcr_reg);
-		val &= BRANCH_CHECK_MASK;
-	}
+
 	/*  wait until status shows it is enabled */
-	while((val != BRANCH_ON_VAL) && (val != BRANCH_NOC_FSM_ON_VAL));
+	if (!clk_defer_status(c, clock_lib2_vote_clk_ready))
+		while(!clock_lib2_vote_clk_ready(c));
 
 	return 0;
 }
@@ -473,9 +473,17 @@ static void crypto5_set_auth_cfg(struct crypto_dev *dev, uint8_t **buffer,
 	REG_WRITE_EXEC(&dev->bam, 1, CRYPTO_WRITE_PIPE_INDEX);
 }
 
-uint32_t crypto5_send_data(struct crypto_dev *dev,
-						   void *ctx_ptr,
-						   uint8_t *data_ptr)
+/* Function: crypto5_queue_data
+ * Arg     : dev, ctx_ptr, data_ptr
+ * Return  : CRYPTO_ERR_NONE once the data and result dump descriptors are
+ *           queued on the BAM pipes.
+ * Flow    : Starts hashing ctx_ptr->bytes_to_write bytes at data_ptr without
+ *           waiting for the engine. crypto5_wait_data() must be called before
+ *           the next CE operation. The data must not change until then.
+ */
+uint32_t crypto5_queue_data(struct crypto_dev *dev,
+							void *ctx_ptr,
+							uint8_t *data_ptr)
 {
 	uint32_t bam_status;
 	crypto_SHA256_ctx *sha256_ctx = (crypto_SHA256_ctx *) ctx_ptr;
@@ -520,17 +528,41 @@ uint32_t crypto5_send_data(struct crypto_dev *dev,
 		goto CRYPTO_SEND_DATA_ERR;
 	}
 
+	return CRYPTO_ERR_NONE;
+
+CRYPTO_SEND_DATA_ERR:
+
+	crypto5_unlock_pipes(dev);
+
+	return ret_status;
+}
+
+/* Function: crypto5_wait_data
+ * Arg     : dev
+ * Return  : None
+ * Flow    : Waits for the operation started by crypto5_queue_data() and
+ *           makes the result dump visible to the CPU.
+ */
+void crypto5_wait_data(struct crypto_dev *dev)
+{
 	crypto_wait_for_data(&dev->bam, CRYPTO_WRITE_PIPE_INDEX);
 
 	crypto_wait_for_data(&dev->bam, CRYPTO_READ_PIPE_INDEX);
 
 	arch_clean_invalidate_cache_range((addr_t) (dev->dump), sizeof(struct output_dump));
 
-	ret_status = CRYPTO_ERR_NONE;
+	crypto5_unlock_pipes(dev);
+}
 
-CRYPTO_SEND_DATA_ERR:
+uint32_t crypto5_send_data(struct crypto_dev *dev,
+						   void *ctx_ptr,
+						   uint8_t *data_ptr)
+{
+	uint32_t ret_status;
 
-	crypto5_unlock_pipes(dev);
+	ret_status = crypto5_queue_data(dev, ctx_ptr, data_ptr);
+	if (ret_status == CRYPTO_ERR_NONE)
+		crypto5_wait_data(dev);
 
 	return ret_status;
 }
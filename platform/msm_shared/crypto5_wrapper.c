@@ -98,6 +98,20 @@ void crypto_send_data(void *ctx_ptr,
 	*ret_status = crypto5_send_data(&dev, ctx_ptr, data_ptr);
 }
 
+void crypto_queue_data(void *ctx_ptr,
+					   unsigned char *data_ptr,
+					   unsigned int bytes_to_write,
+					   unsigned int *ret_status)
+{
+	*ret_status = crypto5_queue_data(&dev, ctx_ptr, data_ptr);
+}
+
+void crypto_wait_data(unsigned int *ret_status)
+{
+	crypto5_wait_data(&dev);
+	*ret_status = CRYPTO_ERR_NONE;
+}
+
 void crypto_get_digest(unsigned char *digest_ptr,
 					   unsigned int *ret_status,
 					   crypto_auth_alg_type auth_alg,
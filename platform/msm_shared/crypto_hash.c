@@ -27,14 +27,52 @@
  */
 
 #include <string.h>
+#include <stdlib.h>
 #include <debug.h>
+#include <compiler.h>
+#include <limits.h>
 #include <sys/types.h>
+#include <sha.h>
+#if WITH_LIB_WORKPOOL
+#include <lib/workpool.h>
+#endif
 #include "crypto_hash.h"
 
+/*
+ * State of an incremental hash over a buffer that is filled front to back.
+ * Everything below base + sent has been handed to the engine, the bytes up
+ * to base + fed are valid but still pending.
+ */
+struct hash_stream {
+	unsigned char *base;
+	unsigned int fed;
+	unsigned int sent;
+	crypto_auth_alg_type auth_alg;
+	crypto_engine_type ce_type;
+	bool active;
+	bool first;
+	bool busy;
+	bool error;
+	union {
+		SHA_CTX sha1;
+		SHA256_CTX sha256;
+		crypto_SHA256_ctx ce;
+	} ctx;
+#if WITH_LIB_WORKPOOL
+	struct work work;
+	unsigned char *work_data;
+	unsigned int work_len;
+#endif
+};
+
 static crypto_SHA256_ctx g_sha256_ctx;
 static crypto_SHA1_ctx g_sha1_ctx;
+static struct hash_stream g_stream;
 static bool crypto_init_done;
 
+static bool hash_stream_find(unsigned char *addr, unsigned int size,
+			     unsigned char *digest, unsigned char auth_alg);
+
 extern void ce_clock_init(void);
 
 /*
@@ -50,6 +88,10 @@ hash_find(unsigned char *addr, unsigned int size, unsigned char *digest,
 	crypto_result_type ret_val = CRYPTO_SHA_ERR_NONE;
 	crypto_engine_type platform_ce_type = board_ce_type();
 
+	/* Reuse the digest if the buffer was hashed while it was read */
+	if (hash_stream_find(addr, size, digest, auth_alg))
+		return;
+
 	if (auth_alg == CRYPTO_AUTH_ALG_SHA1) {
 		if(platform_ce_type == CRYPTO_ENGINE_TYPE_SW)
 			/* Hardware CE is not present , use software hashing */
@@ -404,3 +446,271 @@ calc_num_bytes_to_send(void *ctx_ptr, unsigned int buff_size, bool last)
 	}
 	return bytes_to_write;
 }
+
+/*
+ * Default for crypto engines without asynchronous operation: hash the data
+ * right away, crypto_wait_data() has nothing left to do.
+ */
+
+__WEAK void
+crypto_queue_data(void *ctx_ptr, unsigned char *data_ptr,
+		  unsigned int bytes_to_write, unsigned int *ret_status)
+{
+	crypto_send_data(ctx_ptr, data_ptr, bytes_to_write, bytes_to_write,
+			 ret_status);
+}
+
+__WEAK void crypto_wait_data(unsigned int *ret_status)
+{
+	*ret_status = CRYPTO_ERR_NONE;
+}
+
+static void
+hash_stream_sw_update(struct hash_stream *hs, unsigned char *data,
+		      unsigned int size)
+{
+	if (hs->auth_alg == CRYPTO_AUTH_ALG_SHA1)
+		SHA1_Update(&hs->ctx.sha1, data, size);
+	else
+		SHA256_Update(&hs->ctx.sha256, data, size);
+}
+
+#if WITH_LIB_WORKPOOL
+static void hash_stream_work(void *arg)
+{
+	struct hash_stream *hs = arg;
+
+	hash_stream_sw_update(hs, hs->work_data, hs->work_len);
+}
+#endif
+
+/*
+ * Function to wait for the chunk that is currently being hashed and to
+ * collect the intermediate digest from the crypto engine.
+ */
+
+static void hash_stream_wait(struct hash_stream *hs)
+{
+	unsigned int ret_val = CRYPTO_ERR_NONE;
+
+	if (!hs->busy)
+		return;
+
+	hs->busy = FALSE;
+
+	if (hs->ce_type == CRYPTO_ENGINE_TYPE_HW) {
+		crypto_wait_data(&ret_val);
+		if (ret_val == CRYPTO_ERR_NONE)
+			crypto_get_digest((unsigned char *)hs->ctx.ce.auth_iv,
+					  &ret_val, hs->auth_alg, FALSE);
+
+		if (ret_val != CRYPTO_ERR_NONE) {
+			dprintf(CRITICAL, "hash_stream: crypto engine error\n");
+			hs->error = TRUE;
+			return;
+		}
+
+		crypto_get_ctx(&hs->ctx.ce);
+	}
+#if WITH_LIB_WORKPOOL
+	else {
+		work_wait(&hs->work);
+	}
+#endif
+}
+
+/*
+ * Function to start hashing the next len bytes of the stream. The previous
+ * chunk is completed first since the engine continues from its digest.
+ */
+
+static void
+hash_stream_submit(struct hash_stream *hs, unsigned int len, bool last)
+{
+	unsigned char *data = hs->base + hs->sent;
+	unsigned int ret_val = CRYPTO_ERR_NONE;
+
+	hash_stream_wait(hs);
+	if (hs->error)
+		return;
+
+	if (hs->ce_type == CRYPTO_ENGINE_TYPE_HW) {
+		crypto_set_sha_ctx(&hs->ctx.ce, len, hs->auth_alg,
+				   hs->first, last);
+		crypto_queue_data(&hs->ctx.ce, data, len, &ret_val);
+
+		if (ret_val != CRYPTO_ERR_NONE) {
+			dprintf(CRITICAL, "hash_stream: crypto_queue_data failed\n");
+			hs->error = TRUE;
+			return;
+		}
+
+		hs->first = FALSE;
+		hs->busy = TRUE;
+	} else {
+#if WITH_LIB_WORKPOOL
+		hs->work_data = data;
+		hs->work_len = len;
+		work_init(&hs->work, hash_stream_work, hs);
+		work_queue(&hs->work);
+		hs->busy = TRUE;
+#else
+		hash_stream_sw_update(hs, data, len);
+#endif
+	}
+
+	hs->sent += len;
+}
+
+static unsigned int hash_stream_max_chunk(struct hash_stream *hs)
+{
+	if (hs->ce_type == CRYPTO_ENGINE_TYPE_HW)
+		return ROUNDDOWN(crypto_get_max_auth_blk_size(),
+				 CRYPTO_SHA_BLOCK_SIZE);
+
+	return UINT_MAX;
+}
+
+/*
+ * Function to hash the stream up to size bytes and return the final digest.
+ * Bytes beyond what was fed are taken from memory as they are now.
+ */
+
+static int
+hash_stream_finish(struct hash_stream *hs, unsigned int size,
+		   unsigned char *digest)
+{
+	unsigned int max = hash_stream_max_chunk(hs);
+	unsigned int len;
+
+	while (!hs->error && (len = size - hs->sent) > 0) {
+		if (len > max)
+			hash_stream_submit(hs, max, FALSE);
+		else
+			hash_stream_submit(hs, len, TRUE);
+	}
+	hash_stream_wait(hs);
+
+	if (hs->error)
+		return -1;
+
+	if (hs->ce_type == CRYPTO_ENGINE_TYPE_HW) {
+		memcpy(digest, hs->ctx.ce.auth_iv,
+		       (hs->auth_alg == CRYPTO_AUTH_ALG_SHA1) ? 20 : 32);
+	} else if (hs->auth_alg == CRYPTO_AUTH_ALG_SHA1) {
+		SHA1_Final(digest, &hs->ctx.sha1);
+	} else {
+		SHA256_Final(digest, &hs->ctx.sha256);
+	}
+
+	return 0;
+}
+
+/*
+ * Function to start an incremental hash of the buffer at base. The buffer
+ * is announced chunk by chunk with hash_stream_update() as it is filled
+ * (e.g. after each mmc_read()). Hashing of each chunk overlaps with filling
+ * the next one, either on the crypto engine or on a secondary CPU.
+ * hash_find() on the same buffer then only has to hash the remaining bytes.
+ * hash_stream_stop() must be called before the buffer is reused.
+ */
+
+int hash_stream_start(unsigned char *base, unsigned char auth_alg)
+{
+	struct hash_stream *hs = &g_stream;
+
+	hash_stream_stop();
+
+	hs->base = base;
+	hs->auth_alg = auth_alg;
+	hs->ce_type = board_ce_type();
+	hs->first = TRUE;
+
+	if (auth_alg != CRYPTO_AUTH_ALG_SHA1 && auth_alg != CRYPTO_AUTH_ALG_SHA256)
+		return -1;
+
+	if (hs->ce_type == CRYPTO_ENGINE_TYPE_HW) {
+		crypto_init();
+		if (auth_alg == CRYPTO_AUTH_ALG_SHA1)
+			crypto_sha1_init((crypto_SHA1_ctx *)&hs->ctx.ce);
+		else
+			crypto_sha256_init(&hs->ctx.ce);
+	} else if (hs->ce_type == CRYPTO_ENGINE_TYPE_SW) {
+		if (auth_alg == CRYPTO_AUTH_ALG_SHA1)
+			SHA1_Init(&hs->ctx.sha1);
+		else
+			SHA256_Init(&hs->ctx.sha256);
+	} else {
+		return -1;
+	}
+
+	hs->active = TRUE;
+	return 0;
+}
+
+/*
+ * Function to announce that the next size bytes of the buffer are valid.
+ * Full blocks are sent to the engine right away, the tail is kept back
+ * since the engine has to see at least one byte with the last chunk.
+ */
+
+void hash_stream_update(unsigned int size)
+{
+	struct hash_stream *hs = &g_stream;
+	unsigned int max, len;
+
+	if (!hs->active || hs->error)
+		return;
+
+	hs->fed += size;
+	if (hs->fed - hs->sent <= CRYPTO_SHA_BLOCK_SIZE)
+		return;
+
+	max = hash_stream_max_chunk(hs);
+	len = ROUNDDOWN(hs->fed - hs->sent - 1, CRYPTO_SHA_BLOCK_SIZE);
+
+	while (len && !hs->error) {
+		unsigned int chunk = MIN(len, max);
+
+		hash_stream_submit(hs, chunk, FALSE);
+		len -= chunk;
+	}
+}
+
+/*
+ * Function to end the incremental hash and forget about the buffer.
+ */
+
+void hash_stream_stop(void)
+{
+	hash_stream_wait(&g_stream);
+	memset(&g_stream, 0, sizeof(g_stream));
+}
+
+/*
+ * Function to look up the digest of an incrementally hashed buffer.
+ * Returns TRUE if digest was filled in.
+ */
+
+static bool
+hash_stream_find(unsigned char *addr, unsigned int size,
+		 unsigned char *digest, unsigned char auth_alg)
+{
+	struct hash_stream hs;
+
+	if (!g_stream.active || g_stream.error || addr != g_stream.base ||
+	    auth_alg != g_stream.auth_alg || !g_stream.fed ||
+	    size < g_stream.fed)
+		return FALSE;
+
+	hash_stream_wait(&g_stream);
+	if (g_stream.error)
+		return FALSE;
+
+	/* Finish on a copy so the buffer can be hashed with different tails */
+	hs = g_stream;
+	if (hs.ce_type == CRYPTO_ENGINE_TYPE_HW)
+		crypto_init();
+
+	return hash_stream_finish(&hs, size, digest) == 0;
+}
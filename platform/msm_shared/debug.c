@@ -38,6 +38,8 @@
 #include <dev/uart.h>
 #include <platform/timer.h>
 #include <platform.h>
+#include <qtimer.h>
+#include <arch/ops.h>
 
 #if PON_VIB_SUPPORT
 #include <vibrator.h>
@@ -65,41 +67,161 @@ static void write_dcc(char c)
 #define LK_LOG_BUF_SIZE    (4096) /* align on 4k */
 #endif
 
-#define LK_LOG_COOKIE    0x474f4c52 /* "RLOG" in ASCII */
+/*
+ * The log uses the layout of a Linux pstore/ramoops persistent RAM zone.
+ * When it is placed in reserved RAM (LK_LOG_RAM_BASE), it survives warm
+ * reboots and the kernel picks it up as console-ramoops. Every line is a
+ * record, prefixed with the qtimer timestamp of when it was started.
+ */
+#define PERSISTENT_RAM_SIG    0x43474244 /* "DBGC" in ASCII */
 
-struct lk_log {
-	struct lk_log_header {
-		unsigned cookie;
-		unsigned max_size;
-		unsigned size_written;
-		unsigned idx;
-	} header;
-	char data[LK_LOG_BUF_SIZE];
+struct persistent_ram_buffer {
+	uint32_t sig;
+	uint32_t start;
+	uint32_t size;
+	uint8_t data[0];
 };
 
-static struct lk_log log = {
-	.header = {
-		.cookie = LK_LOG_COOKIE,
-		.max_size = sizeof(log.data),
-		.size_written = 0,
-		.idx = 0,
-	},
-	.data = {0}
-};
+#ifdef LK_LOG_RAM_BASE
+#if (LK_LOG_RAM_SIZE & (LK_LOG_RAM_SIZE - 1))
+#error LK_LOG_RAM_SIZE must be a power of two for ramoops
+#endif
+#define LK_LOG_SIZE    LK_LOG_RAM_SIZE
+static struct persistent_ram_buffer *const log =
+	(struct persistent_ram_buffer *)LK_LOG_RAM_BASE;
+#else
+#define LK_LOG_SIZE    LK_LOG_BUF_SIZE
+static uint32_t log_buf[LK_LOG_SIZE / sizeof(uint32_t)];
+static struct persistent_ram_buffer *const log =
+	(struct persistent_ram_buffer *)log_buf;
+#endif
+
+#define LK_LOG_DATA_SIZE    (LK_LOG_SIZE - sizeof(struct persistent_ram_buffer))
+
+static bool log_ready;
+static bool log_line_start = true;
+static unsigned log_seq; /* sequence number of the next record */
+
+static inline uint8_t log_byte(unsigned pos)
+{
+	/* pos counts from the oldest byte in the log */
+	return log->data[(log->start + LK_LOG_DATA_SIZE - log->size + pos) % LK_LOG_DATA_SIZE];
+}
+
+static void log_write(char c)
+{
+	log->data[log->start++] = c;
+	if (unlikely(log->start >= LK_LOG_DATA_SIZE))
+		log->start = 0;
+	if (log->size < LK_LOG_DATA_SIZE)
+		log->size++;
+}
+
+static void log_init(void)
+{
+	unsigned i;
+
+	log_ready = true;
+
+	/* Keep the log from before a warm reboot if it looks sane */
+	if (log->sig != PERSISTENT_RAM_SIG || log->size > LK_LOG_DATA_SIZE ||
+	    log->start >= LK_LOG_DATA_SIZE ||
+	    (log->size < LK_LOG_DATA_SIZE && log->start != log->size)) {
+		log->sig = PERSISTENT_RAM_SIG;
+		log->start = 0;
+		log->size = 0;
+		return;
+	}
+
+	for (i = 0; i < log->size; i++)
+		if (log_byte(i) == '\n')
+			log_seq++;
+
+	if (log->size && log_byte(log->size - 1) != '\n') {
+		log_write('\n');
+		log_seq++;
+	}
+}
+
+static void log_timestamp(void)
+{
+	uint64_t ticks = qtimer_get_phy_timer_cnt();
+	uint32_t rate = qtimer_tick_rate();
+	char ts[24];
+	int i, n;
+
+	/* The frequency is only read in qtimer_init() */
+	if (!rate)
+		rate = 19200000;
+
+	n = snprintf(ts, sizeof(ts), "[%5u.%06u] ", (unsigned)(ticks / rate),
+		     (unsigned)((ticks % rate) * 1000000 / rate));
+	for (i = 0; i < n; i++)
+		log_write(ts[i]);
+}
 
 static void log_putc(char c)
 {
 	if(!c) return;
-	log.data[log.header.idx++] = c;
-	log.header.size_written++;
-	if (unlikely(log.header.idx >= log.header.max_size))
-		log.header.idx = 0;
+	if (unlikely(!log_ready))
+		log_init();
+
+	if (log_line_start) {
+		log_timestamp();
+		log_line_start = false;
+		log_seq++;
+	}
+
+	log_write(c);
+	if (c == '\n')
+		log_line_start = true;
 }
-char* lk_log_getbuf(void) {
-    return log.data;
+
+/* Write the log back to RAM, it has to be there after a warm reboot */
+void lk_log_flush(void)
+{
+#ifdef LK_LOG_RAM_BASE
+	arch_clean_cache_range((addr_t)log, LK_LOG_SIZE);
+#endif
 }
-unsigned lk_log_getsize(void) {
-    return log.header.size_written;
+
+/*
+ * Copy the records starting with sequence number seq to buf, oldest first.
+ * If they do not fit, the oldest ones are left out. next_seq is set to the
+ * sequence number of the next record that will be logged.
+ */
+unsigned lk_log_read(unsigned seq, char *buf, unsigned max, unsigned *next_seq)
+{
+	unsigned records, start, pos, len, i;
+
+	if (unlikely(!log_ready))
+		log_init();
+
+	*next_seq = log_seq;
+	if (seq >= log_seq)
+		return 0;
+
+	/* Walk back to the start of the requested record */
+	records = log_seq - seq;
+	start = log->size;
+	for (pos = log->size; pos-- > 0;) {
+		if (pos == 0 || log_byte(pos - 1) == '\n') {
+			start = pos;
+			if (--records == 0)
+				break;
+		}
+	}
+
+	len = log->size - start;
+	if (len > max) {
+		start += len - max;
+		len = max;
+	}
+
+	for (i = 0; i < len; i++)
+		buf[i] = log_byte(start + i);
+
+	return len;
 }
 #endif /* WITH_DEBUG_LOG_BUF */
 
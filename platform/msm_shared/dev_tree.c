@@ -1355,6 +1355,42 @@ int dev_tree_add_mem_info(void *fdt, uint32_t offset, uint64_t addr, uint64_t si
 	return ret;
 }
 
+#ifdef LK_LOG_RAM_BASE
+/* Reserve the lk log and describe it as ramoops so the kernel can read it */
+static int dev_tree_add_lk_log(void *fdt)
+{
+	int parent, offset, ret;
+	char name[32];
+
+	if (fdt_node_offset_by_compatible(fdt, -1, "ramoops") >= 0)
+		return 0;
+
+	parent = fdt_path_offset(fdt, "/reserved-memory");
+	if (parent < 0) {
+		parent = fdt_add_subnode(fdt, 0, "reserved-memory");
+		if (parent < 0)
+			return parent;
+
+		ret = fdt_setprop_u32(fdt, parent, "#address-cells", fdt_address_cells(fdt, 0));
+		ret |= fdt_setprop_u32(fdt, parent, "#size-cells", fdt_size_cells(fdt, 0));
+		ret |= fdt_setprop_empty(fdt, parent, "ranges");
+		if (ret)
+			return ret;
+	}
+
+	snprintf(name, sizeof(name), "lk-log@%x", LK_LOG_RAM_BASE);
+	offset = fdt_add_subnode(fdt, parent, name);
+	if (offset < 0)
+		return offset;
+
+	ret = fdt_setprop_string(fdt, offset, "compatible", "ramoops");
+	ret |= fdt_appendprop_addrrange(fdt, parent, offset, "reg",
+					LK_LOG_RAM_BASE, LK_LOG_RAM_SIZE);
+	ret |= fdt_setprop_u32(fdt, offset, "console-size", LK_LOG_RAM_SIZE);
+	return ret;
+}
+#endif
+
 /* Top level function that updates the device tree. */
 int update_device_tree(void *fdt, const char *cmdline,
 					   void *ramdisk, uint32_t ramdisk_size, unsigned char* mac,
@@ -1517,6 +1553,15 @@ int update_device_tree(void *fdt, const char *cmdline,
 		}
 	}
 
+#ifdef LK_LOG_RAM_BASE
+	ret = dev_tree_add_lk_log(fdt);
+	if (ret)
+	{
+		dprintf(CRITICAL, "ERROR: Cannot add lk log ramoops node: %d\n", ret);
+		return ret;
+	}
+#endif
+
 #if WITH_LK2ND
 	lk2nd_update_device_tree(fdt, cmdline, arm64);
 #endif
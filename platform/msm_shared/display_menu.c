@@ -144,6 +144,7 @@ void exit_menu_keys_detection()
 	select_msg->info.is_exit = true;
 	mutex_release(&select_msg->msg_lock);
 
+	keys_detect_wakeup();
 	wait_for_exit();
 }
 
@@ -33,6 +33,9 @@
 #include <qpic_nand.h>
 #include <rand.h>
 
+/* Pages read at once to fetch both the EC and the VID header of a PEB */
+#define UBI_SCAN_HDR_PAGES	4
+
 static
 const uint32_t crc32_table[256] = {
 	0x00000000L, 0x77073096L, 0xee0e612cL, 0x990951baL, 0x076dc419L,
@@ -142,174 +145,95 @@ static int calc_data_len(int page_size, const void *buf, int len)
 }
 
 /**
- * read_ec_hdr - read and check an erase counter header.
- * @peb: number of the physical erase block to read the header for
- * @ec_hdr: a &struct ubi_ec_hdr object where to store the read erase counter
- * 			header
+ * check_ec_hdr - check an erase counter header.
+ * @peb: number of the physical erase block the header was read from
+ * @ec_hdr: the erase counter header read from the PEB
  *
- * This function reads erase counter header from physical eraseblock @peb and
- * stores it in @ec_hdr. This function also checks the validity of the read
- * header.
+ * This function checks the validity of the erase counter header read from
+ * physical eraseblock @peb.
  *
  * Return codes:
  * -1 - in case of error
  *  0 - if PEB was found valid
  *  1 - if PEB is empty
  */
-static int read_ec_hdr(uint32_t peb, struct ubi_ec_hdr *ec_hdr)
+static int check_ec_hdr(uint32_t peb, struct ubi_ec_hdr *ec_hdr)
 {
-	unsigned char *spare, *tmp_buf;
-	int ret = -1;
 	uint32_t crc;
-	int page_size = flash_page_size();
-	int num_pages_per_blk = flash_block_size()/page_size;
-
-	spare = (unsigned char *)malloc(flash_spare_size());
-	if (!spare)
-	{
-		dprintf(CRITICAL, "read_ec_hdr: Mem allocation failed\n");
-		return ret;
-	}
-
-	tmp_buf = (unsigned char *)malloc(page_size);
-	if (!tmp_buf)
-	{
-		dprintf(CRITICAL, "read_ec_hdr: Mem allocation failed\n");
-		goto out_tmp_buf;
-	}
-
-	if (qpic_nand_block_isbad(peb * num_pages_per_blk)) {
-		dprintf(CRITICAL, "read_ec_hdr: Bad block @ %d\n", peb);
-		goto out;
-	}
 
-	if (qpic_nand_read(peb * num_pages_per_blk, 1, tmp_buf, spare)) {
-		dprintf(CRITICAL, "read_ec_hdr: Read %d failed \n", peb);
-		goto out;
-	}
-	memcpy(ec_hdr, tmp_buf, UBI_EC_HDR_SIZE);
-
-	if (check_pattern((void *)ec_hdr, 0xFF, UBI_EC_HDR_SIZE)) {
-		ret = 1;
-		goto out;
-	}
+	if (check_pattern((void *)ec_hdr, 0xFF, UBI_EC_HDR_SIZE))
+		return 1;
 
 	/* Make sure we read a valid UBI EC_HEADER */
 	if (BE32(ec_hdr->magic) != (uint32_t)UBI_EC_HDR_MAGIC) {
 		dprintf(CRITICAL,
-			"read_ec_hdr: Wrong magic at peb-%d Expected: %d, received %d\n",
+			"check_ec_hdr: Wrong magic at peb-%d Expected: %d, received %d\n",
 			peb, UBI_EC_HDR_MAGIC, BE32(ec_hdr->magic));
-		goto out;
+		return -1;
 	}
 
 	if (ec_hdr->version != UBI_VERSION) {
 		dprintf(CRITICAL,
-			"read_ec_hdr: Wrong version at peb-%d Expected: %d, received %d\n",
+			"check_ec_hdr: Wrong version at peb-%d Expected: %d, received %d\n",
 			peb, UBI_VERSION, ec_hdr->version);
-		goto out;
+		return -1;
 	}
 
 	if (BE64(ec_hdr->ec) > UBI_MAX_ERASECOUNTER) {
 		dprintf(CRITICAL,
-			"read_ec_hdr: Wrong ec at peb-%d: %lld \n",
+			"check_ec_hdr: Wrong ec at peb-%d: %lld \n",
 			peb, BE64(ec_hdr->ec));
-		goto out;
+		return -1;
 	}
 
 	crc = mtd_crc32(UBI_CRC32_INIT, ec_hdr, UBI_EC_HDR_SIZE_CRC);
 	if (BE32(ec_hdr->hdr_crc) != crc) {
 		dprintf(CRITICAL,
-			"read_ec_hdr: Wrong crc at peb-%d: calculated %d, recived %d\n",
+			"check_ec_hdr: Wrong crc at peb-%d: calculated %d, recived %d\n",
 			peb,crc,  BE32(ec_hdr->hdr_crc));
-		goto out;
+		return -1;
 	}
 
-	ret = 0;
-out:
-	free(tmp_buf);
-out_tmp_buf:
-	free(spare);
-	return ret;
+	return 0;
 }
 
 /**
- * read_vid_hdr - read and check an Volume identifier header.
- * @peb: number of the physical erase block to read the header for
- * @vid_hdr: a &struct ubi_vid_hdr object where to store the read header
- * @vid_hdr_offset: offset of the VID header from the beginning of the PEB
- * 			 (in bytes)
+ * check_vid_hdr - check a Volume identifier header.
+ * @peb: number of the physical erase block the header was read from
+ * @vid_hdr: the volume identifier header read from the PEB
  *
- * This function reads the volume identifier header from physical
- * eraseblock @peb and stores it in @vid_hdr. This function also checks the
- * validity of the read header.
+ * This function checks the validity of the volume identifier header read
+ * from physical eraseblock @peb.
  *
  * Return codes:
  * -1 - in case of error
  *  0 - on success
  *  1 - if the PEB is free (no VID hdr)
  */
-static int read_vid_hdr(uint32_t peb, struct ubi_vid_hdr *vid_hdr,
-		int vid_hdr_offset)
+static int check_vid_hdr(uint32_t peb, struct ubi_vid_hdr *vid_hdr)
 {
-	unsigned char *spare, *tmp_buf;
-	int ret = -1;
 	uint32_t crc, magic;
-	int page_size = flash_page_size();
-	int num_pages_per_blk = flash_block_size()/page_size;
 
-	spare = (unsigned char *)malloc(flash_spare_size());
-	if (!spare)
-	{
-		dprintf(CRITICAL, "read_vid_hdr: Mem allocation failed\n");
-		return ret;
-	}
-
-	tmp_buf = (unsigned char *)malloc(page_size);
-	if (!tmp_buf)
-	{
-		dprintf(CRITICAL, "read_vid_hdr: Mem allocation failed\n");
-		goto out_tmp_buf;
-	}
-
-	if (qpic_nand_block_isbad(peb * num_pages_per_blk)) {
-		dprintf(CRITICAL, "read_vid_hdr: Bad block @ %d\n", peb);
-		goto out;
-	}
-
-	if (qpic_nand_read(peb * num_pages_per_blk + vid_hdr_offset/page_size,
-			1, tmp_buf, spare)) {
-		dprintf(CRITICAL, "read_vid_hdr: Read %d failed \n", peb);
-		goto out;
-	}
-	memcpy(vid_hdr, tmp_buf, UBI_VID_HDR_SIZE);
-
-	if (check_pattern((void *)vid_hdr, 0xFF, UBI_VID_HDR_SIZE)) {
-		ret = 1;
-		goto out;
-	}
+	if (check_pattern((void *)vid_hdr, 0xFF, UBI_VID_HDR_SIZE))
+		return 1;
 
 	magic = BE32(vid_hdr->magic);
 	if (magic != UBI_VID_HDR_MAGIC) {
 		dprintf(CRITICAL,
-				"read_vid_hdr: Wrong magic at peb-%d Expected: %d, received %d\n",
+				"check_vid_hdr: Wrong magic at peb-%d Expected: %d, received %d\n",
 				peb, UBI_VID_HDR_MAGIC, BE32(vid_hdr->magic));
-		goto out;
+		return -1;
 	}
 
 	crc = mtd_crc32(UBI_CRC32_INIT, vid_hdr, UBI_EC_HDR_SIZE_CRC);
 	if (BE32(vid_hdr->hdr_crc) != crc) {
 		dprintf(CRITICAL,
-			"read_vid_hdr: Wrong crc at peb-%d: calculated %d, received %d\n",
+			"check_vid_hdr: Wrong crc at peb-%d: calculated %d, received %d\n",
 			peb,crc,  BE32(vid_hdr->hdr_crc));
-		goto out;
+		return -1;
 	}
 
-	ret = 0;
-out:
-	free(tmp_buf);
-out_tmp_buf:
-	free(spare);
-	return ret;
+	return 0;
 }
 
 /**
@@ -496,22 +420,357 @@ out:
 	return ret;
 }
 
+/**
+ * scan_one_peb() - Read and classify the headers of one PEB
+ * @ptn: partition the PEB belongs to
+ * @si: pointer to struct ubi_scan_info to update
+ * @idx: index of the PEB in si->pebs_data (relative to ptn->start)
+ * @buf: buffer of at least UBI_SCAN_HDR_PAGES pages
+ * @spare: buffer for the spare data of one page
+ *
+ * Once the VID header offset is known, the EC and VID headers are fetched
+ * with a single multi-page read instead of two separate page reads.
+ */
+static void scan_one_peb(struct ptentry *ptn, struct ubi_scan_info *si,
+		unsigned idx, unsigned char *buf, unsigned char *spare)
+{
+	struct ubi_ec_hdr *ec_hdr = (struct ubi_ec_hdr *)buf;
+	struct ubi_vid_hdr *vid_hdr;
+	uint32_t peb = ptn->start + idx;
+	unsigned page_size = flash_page_size();
+	int num_pages_per_blk = flash_block_size() / page_size;
+	unsigned num_pages = 1;
+	unsigned vid_offs;
+	int ret;
+
+	if (qpic_nand_block_isbad(peb * num_pages_per_blk)) {
+		dprintf(CRITICAL, "scan_one_peb: Bad block @ %d\n", peb);
+		goto bad;
+	}
+
+	if (si->vid_hdr_offs && si->vid_hdr_offs < UBI_SCAN_HDR_PAGES * page_size)
+		num_pages = si->vid_hdr_offs / page_size + 1;
+
+	if (qpic_nand_read(peb * num_pages_per_blk, num_pages, buf, spare)) {
+		dprintf(CRITICAL, "scan_one_peb: Read %d failed \n", peb);
+		goto bad;
+	}
+
+	ret = check_ec_hdr(peb, ec_hdr);
+	if (ret == 1) {
+		si->empty_cnt++;
+		si->pebs_data[idx].ec = UBI_MAX_ERASECOUNTER;
+		si->pebs_data[idx].status = UBI_EMPTY_PEB;
+		return;
+	}
+	if (ret)
+		goto bad;
+
+	if (!si->vid_hdr_offs) {
+		si->vid_hdr_offs = BE32(ec_hdr->vid_hdr_offset);
+		si->data_offs = BE32(ec_hdr->data_offset);
+		if (!si->vid_hdr_offs || !si->data_offs ||
+			si->vid_hdr_offs % page_size ||
+			si->data_offs % page_size) {
+			si->vid_hdr_offs = 0;
+			goto bad;
+		}
+	}
+	si->read_image_seq = BE32(ec_hdr->image_seq);
+	si->pebs_data[idx].ec = BE64(ec_hdr->ec);
+
+	/* Now read the VID header to find if the peb is free */
+	vid_offs = BE32(ec_hdr->vid_hdr_offset);
+	if (vid_offs + UBI_VID_HDR_SIZE > num_pages * page_size) {
+		/* Not covered by the batched read, fetch its page separately */
+		if (vid_offs >= flash_block_size() ||
+			qpic_nand_read(peb * num_pages_per_blk + vid_offs / page_size,
+				1, buf + page_size, spare)) {
+			dprintf(CRITICAL, "scan_one_peb: Read %d failed \n", peb);
+			goto bad;
+		}
+		vid_offs = page_size + vid_offs % page_size;
+	}
+	vid_hdr = (struct ubi_vid_hdr *)(buf + vid_offs);
+
+	ret = check_vid_hdr(peb, vid_hdr);
+	switch (ret) {
+	case 1:
+		si->pebs_data[idx].status = UBI_FREE_PEB;
+		si->free_cnt++;
+		break;
+	case 0:
+		si->pebs_data[idx].status = UBI_USED_PEB;
+		si->pebs_data[idx].volume = BE32(vid_hdr->vol_id);
+		if (BE32(vid_hdr->vol_id) == UBI_LAYOUT_VOLUME_ID) {
+			if (si->vtbl_peb1 == -1)
+				si->vtbl_peb1 = idx;
+			else if (si->vtbl_peb2 == -1)
+				si->vtbl_peb2 = idx;
+			else
+				dprintf(CRITICAL,
+					"scan_partition: Found > 2 copies of vtbl");
+		}
+		if (BE32(vid_hdr->vol_id) == UBI_FM_SB_VOLUME_ID)
+			si->fastmap_sb = idx;
+		si->used_cnt++;
+		break;
+	case -1:
+	default:
+		goto bad;
+	}
+	return;
+
+bad:
+	si->bad_cnt++;
+	si->pebs_data[idx].ec = UBI_MAX_ERASECOUNTER;
+	si->pebs_data[idx].status = UBI_BAD_PEB;
+}
+
+/**
+ * fm_add_peb() - Record a PEB described by the fastmap
+ * @fm_pebs: temporary PEB info array filled from the fastmap
+ * @len: number of PEBs in the partition
+ * @fmec: fastmap erase counter record of the PEB
+ * @status: UBI_FREE_PEB or UBI_USED_PEB
+ *
+ * Returns -1 if the record is out of range or describes a PEB twice.
+ */
+static int fm_add_peb(struct peb_info *fm_pebs, unsigned len,
+		struct ubi_fm_ec *fmec, int status)
+{
+	uint32_t pnum = BE32(fmec->pnum);
+
+	if (pnum >= len || fm_pebs[pnum].status != UBI_UNKNOWN ||
+			BE32(fmec->ec) > UBI_MAX_ERASECOUNTER)
+		return -1;
+
+	fm_pebs[pnum].ec = BE32(fmec->ec);
+	fm_pebs[pnum].status = status;
+	fm_pebs[pnum].volume = -1;
+	return 0;
+}
+
+/**
+ * ubi_attach_fastmap() - Fill the scan information from an existing fastmap
+ * @ptn: partition to attach
+ * @si: scan information, with si->fastmap_sb already found
+ * @buf: header buffer, see scan_one_peb()
+ * @spare: spare buffer, see scan_one_peb()
+ *
+ * Reads the fastmap referenced by the superblock at si->fastmap_sb and
+ * takes the erase counters and the volume layout of all the free and used
+ * PEBs from it. Pool PEBs, PEBs scheduled for erasure and bad blocks are
+ * not described by the fastmap and are left for scan_one_peb(). Nothing in
+ * @si is modified for the fastmap contents unless the whole fastmap was
+ * found valid.
+ *
+ * Return codes:
+ * -1 - in case of error (fastmap not usable)
+ *  0 - on success
+ */
+static int ubi_attach_fastmap(struct ptentry *ptn, struct ubi_scan_info *si,
+		unsigned char *buf, unsigned char *spare)
+{
+	struct ubi_fm_sb *fmsb;
+	struct ubi_fm_hdr *fmhdr;
+	struct ubi_fm_scan_pool *fmpl;
+	struct ubi_fm_volhdr *fmvhdr;
+	struct ubi_fm_eba *fm_eba;
+	struct peb_info *fm_pebs = NULL;
+	unsigned char *fm_raw = NULL;
+	void *sb_leb;
+	unsigned leb_size = flash_block_size() - si->data_offs;
+	unsigned used_blocks, fm_size, fm_pos, i, j;
+	uint32_t free_cnt, used_cnt, scrub_cnt, erase_cnt;
+	uint64_t total;
+	int vtbl_peb1 = -1, vtbl_peb2 = -1;
+	uint32_t crc, pnum, vol_id, reserved_pebs;
+	int ret = -1;
+
+	if (!si->data_offs || si->data_offs >= flash_block_size())
+		return -1;
+
+	sb_leb = malloc(leb_size);
+	if (!sb_leb) {
+		dprintf(CRITICAL, "ubi_attach_fastmap: Mem allocation failed\n");
+		return -1;
+	}
+	if (read_leb_data(ptn->start + si->fastmap_sb, sb_leb, leb_size,
+			si->data_offs))
+		goto out;
+	fmsb = sb_leb;
+
+	used_blocks = BE32(fmsb->used_blocks);
+	if (BE32(fmsb->magic) != UBI_FM_SB_MAGIC ||
+			fmsb->version != UBI_FM_FMT_VERSION ||
+			used_blocks < 1 || used_blocks > UBI_FM_MAX_BLOCKS) {
+		dprintf(INFO, "ubi_attach_fastmap: unsupported fastmap superblock\n");
+		goto out;
+	}
+
+	fm_size = used_blocks * leb_size;
+	fm_raw = malloc(fm_size);
+	fm_pebs = malloc(ptn->length * sizeof(struct peb_info));
+	if (!fm_raw || !fm_pebs) {
+		dprintf(CRITICAL, "ubi_attach_fastmap: Mem allocation failed\n");
+		goto out;
+	}
+	memset(fm_pebs, 0, ptn->length * sizeof(struct peb_info));
+
+	/* Gather the fastmap data, the superblock LEB comes first */
+	memcpy(fm_raw, sb_leb, leb_size);
+	for (i = 1; i < used_blocks; i++) {
+		pnum = BE32(fmsb->block_loc[i]);
+		if (pnum >= ptn->length)
+			goto out;
+		if (si->pebs_data[pnum].status == UBI_UNKNOWN)
+			scan_one_peb(ptn, si, pnum, buf, spare);
+		if (si->pebs_data[pnum].status != UBI_USED_PEB ||
+				si->pebs_data[pnum].volume != UBI_FM_DATA_VOLUME_ID) {
+			dprintf(INFO, "ubi_attach_fastmap: bad fastmap data PEB %d\n",
+					pnum);
+			goto out;
+		}
+		if (read_leb_data(ptn->start + pnum, fm_raw + i * leb_size,
+				leb_size, si->data_offs))
+			goto out;
+	}
+
+	fmsb = (struct ubi_fm_sb *)fm_raw;
+	crc = BE32(fmsb->data_crc);
+	fmsb->data_crc = 0;
+	if (mtd_crc32(UBI_CRC32_INIT, fm_raw, fm_size) != crc) {
+		dprintf(INFO, "ubi_attach_fastmap: fastmap data CRC mismatch\n");
+		goto out;
+	}
+
+	fm_pos = sizeof(struct ubi_fm_sb);
+	if (fm_pos + sizeof(*fmhdr) + 2 * sizeof(*fmpl) > fm_size)
+		goto out;
+	fmhdr = (struct ubi_fm_hdr *)(fm_raw + fm_pos);
+	fm_pos += sizeof(*fmhdr);
+	if (BE32(fmhdr->magic) != UBI_FM_HDR_MAGIC)
+		goto out;
+
+	/* Pool PEBs may have been written since, scan_one_peb() handles them */
+	for (i = 0; i < 2; i++) {
+		fmpl = (struct ubi_fm_scan_pool *)(fm_raw + fm_pos);
+		fm_pos += sizeof(*fmpl);
+		if (BE32(fmpl->magic) != UBI_FM_POOL_MAGIC)
+			goto out;
+	}
+
+	/* Check the counts one by one, their sum could wrap around */
+	free_cnt = BE32(fmhdr->free_peb_count);
+	used_cnt = BE32(fmhdr->used_peb_count);
+	scrub_cnt = BE32(fmhdr->scrub_peb_count);
+	erase_cnt = BE32(fmhdr->erase_peb_count);
+	if (free_cnt > ptn->length || used_cnt > ptn->length ||
+			scrub_cnt > ptn->length || erase_cnt > ptn->length)
+		goto out;
+	total = (uint64_t)free_cnt + used_cnt + scrub_cnt + erase_cnt;
+	if (total > ptn->length ||
+			fm_pos + total * sizeof(struct ubi_fm_ec) > fm_size)
+		goto out;
+
+	for (i = 0; i < free_cnt; i++) {
+		if (fm_add_peb(fm_pebs, ptn->length,
+				(struct ubi_fm_ec *)(fm_raw + fm_pos), UBI_FREE_PEB))
+			goto out;
+		fm_pos += sizeof(struct ubi_fm_ec);
+	}
+
+	for (i = 0; i < used_cnt + scrub_cnt; i++) {
+		if (fm_add_peb(fm_pebs, ptn->length,
+				(struct ubi_fm_ec *)(fm_raw + fm_pos), UBI_USED_PEB))
+			goto out;
+		fm_pos += sizeof(struct ubi_fm_ec);
+	}
+
+	/* PEBs to be erased still hold stale data, leave them to the scan */
+	fm_pos += erase_cnt * sizeof(struct ubi_fm_ec);
+
+	for (i = 0; i < BE32(fmhdr->vol_count); i++) {
+		if (fm_pos + sizeof(*fmvhdr) + sizeof(*fm_eba) > fm_size)
+			goto out;
+		fmvhdr = (struct ubi_fm_volhdr *)(fm_raw + fm_pos);
+		fm_pos += sizeof(*fmvhdr);
+		fm_eba = (struct ubi_fm_eba *)(fm_raw + fm_pos);
+		fm_pos += sizeof(*fm_eba);
+		if (BE32(fmvhdr->magic) != UBI_FM_VHDR_MAGIC ||
+				BE32(fm_eba->magic) != UBI_FM_EBA_MAGIC)
+			goto out;
+
+		vol_id = BE32(fmvhdr->vol_id);
+		reserved_pebs = BE32(fm_eba->reserved_pebs);
+		if (reserved_pebs > ptn->length ||
+				fm_pos + reserved_pebs * sizeof(uint32_t) > fm_size)
+			goto out;
+		fm_pos += reserved_pebs * sizeof(uint32_t);
+
+		for (j = 0; j < reserved_pebs; j++) {
+			pnum = BE32(fm_eba->pnum[j]);
+			/* Unmapped LEB */
+			if ((int)pnum < 0)
+				continue;
+			if (pnum >= ptn->length)
+				goto out;
+			if (fm_pebs[pnum].status != UBI_USED_PEB)
+				continue;
+			fm_pebs[pnum].volume = vol_id;
+			if (vol_id == UBI_LAYOUT_VOLUME_ID) {
+				if (j == 0)
+					vtbl_peb1 = pnum;
+				else if (j == 1)
+					vtbl_peb2 = pnum;
+			}
+		}
+	}
+
+	/* The fastmap is valid, commit it for all PEBs not scanned yet */
+	for (i = 0; i < ptn->length; i++) {
+		if (fm_pebs[i].status == UBI_UNKNOWN ||
+				si->pebs_data[i].status != UBI_UNKNOWN)
+			continue;
+		si->pebs_data[i] = fm_pebs[i];
+		if (fm_pebs[i].status == UBI_FREE_PEB)
+			si->free_cnt++;
+		else
+			si->used_cnt++;
+	}
+	if (si->vtbl_peb1 == -1) {
+		si->vtbl_peb1 = vtbl_peb1;
+		si->vtbl_peb2 = vtbl_peb2;
+	}
+	ret = 0;
+
+out:
+	if (ret)
+		dprintf(INFO, "ubi_attach_fastmap: falling back to full scan\n");
+	free(fm_pebs);
+	free(fm_raw);
+	free(sb_leb);
+	return ret;
+}
+
 /**
  * scan_partition() - Collect the ec_headers info of a given partition
  * @ptn: partition to read the headers of
  *
+ * If a valid fastmap is found in the first UBI_FM_MAX_START PEBs, the
+ * information on the remaining PEBs is taken from it and only the PEBs it
+ * does not describe are read. Otherwise the headers of every PEB are read.
+ *
  * Returns allocated and filled struct ubi_scan_info (si).
  * Note: si should be released by caller.
  */
 static struct ubi_scan_info *scan_partition(struct ptentry *ptn)
 {
 	struct ubi_scan_info *si;
-	struct ubi_ec_hdr *ec_hdr;
-	struct ubi_vid_hdr vid_hdr;
-	unsigned i;
+	unsigned char *buf, *spare;
+	unsigned i, fm_scan_len;
 	unsigned long long sum = 0;
-	int page_size = flash_page_size();
-	int ret;
 
 	si = malloc(sizeof(*si));
 	if (!si) {
@@ -529,8 +788,9 @@ static struct ubi_scan_info *scan_partition(struct ptentry *ptn)
 	}
 	memset((void *)si->pebs_data, 0, ptn->length * sizeof(struct peb_info));
 
-	ec_hdr = malloc(UBI_EC_HDR_SIZE);
-	if (!ec_hdr) {
+	buf = malloc(UBI_SCAN_HDR_PAGES * flash_page_size());
+	spare = malloc(flash_spare_size());
+	if (!buf || !spare) {
 		dprintf(CRITICAL,"scan_partition: (%s) Memory allocation failed\n",
 				ptn->name);
 		goto out_failed;
@@ -541,79 +801,20 @@ static struct ubi_scan_info *scan_partition(struct ptentry *ptn)
 	si->vtbl_peb1 = -1;
 	si->vtbl_peb2 = -1;
 	si->fastmap_sb = -1;
-	for (i = 0; i < ptn->length; i++){
-		ret = read_ec_hdr(ptn->start + i, ec_hdr);
-		switch (ret) {
-		case 1:
-			si->empty_cnt++;
-			si->pebs_data[i].ec = UBI_MAX_ERASECOUNTER;
-			si->pebs_data[i].status = UBI_EMPTY_PEB;
-			break;
-		case 0:
-			if (!si->vid_hdr_offs) {
-				si->vid_hdr_offs = BE32(ec_hdr->vid_hdr_offset);
-				si->data_offs = BE32(ec_hdr->data_offset);
-				if (!si->vid_hdr_offs || !si->data_offs ||
-					si->vid_hdr_offs % page_size ||
-					si->data_offs % page_size) {
-					si->bad_cnt++;
-					si->pebs_data[i].ec = UBI_MAX_ERASECOUNTER;
-					si->vid_hdr_offs = 0;
-					continue;
-				}
-				if (BE32(ec_hdr->vid_hdr_offset) != si->vid_hdr_offs) {
-					si->bad_cnt++;
-					si->pebs_data[i].ec = UBI_MAX_ERASECOUNTER;
-					continue;
-				}
-				if (BE32(ec_hdr->data_offset) != si->data_offs) {
-					si->bad_cnt++;
-					si->pebs_data[i].ec = UBI_MAX_ERASECOUNTER;
-					continue;
-				}
-			}
-			si->read_image_seq = BE32(ec_hdr->image_seq);
-			si->pebs_data[i].ec = BE64(ec_hdr->ec);
-			/* Now read the VID header to find if the peb is free */
-			ret = read_vid_hdr(ptn->start + i, &vid_hdr,
-					BE32(ec_hdr->vid_hdr_offset));
-			switch (ret) {
-			case 1:
-				si->pebs_data[i].status = UBI_FREE_PEB;
-				si->free_cnt++;
-				break;
-			case 0:
-				si->pebs_data[i].status = UBI_USED_PEB;
-				si->pebs_data[i].volume = BE32(vid_hdr.vol_id);
-				if (BE32(vid_hdr.vol_id) == UBI_LAYOUT_VOLUME_ID) {
-					if (si->vtbl_peb1 == -1)
-						si->vtbl_peb1 = i;
-					else if (si->vtbl_peb2 == -1)
-						si->vtbl_peb2 = i;
-					else
-						dprintf(CRITICAL,
-							"scan_partition: Found > 2 copies of vtbl");
-				}
-				if (BE32(vid_hdr.vol_id) == UBI_FM_SB_VOLUME_ID)
-					si->fastmap_sb = i;
-				si->used_cnt++;
-				break;
-			case -1:
-			default:
-				si->bad_cnt++;
-				si->pebs_data[i].ec = UBI_MAX_ERASECOUNTER;
-				si->pebs_data[i].status = UBI_BAD_PEB;
-				break;
-			}
-			break;
-		case -1:
-		default:
-			si->bad_cnt++;
-			si->pebs_data[i].ec = UBI_MAX_ERASECOUNTER;
-			si->pebs_data[i].status = UBI_BAD_PEB;
-			break;
-		}
-	}
+
+	/* The fastmap superblock can only be located in the first PEBs */
+	fm_scan_len = MIN(ptn->length, UBI_FM_MAX_START);
+	for (i = 0; i < fm_scan_len; i++)
+		scan_one_peb(ptn, si, i, buf, spare);
+
+	if (si->fastmap_sb > -1 && !ubi_attach_fastmap(ptn, si, buf, spare))
+		dprintf(INFO, "scan_partition: (%s) attached using fastmap\n",
+				ptn->name);
+
+	/* Everything not described by the fastmap is scanned */
+	for (i = fm_scan_len; i < ptn->length; i++)
+		if (si->pebs_data[i].status == UBI_UNKNOWN)
+			scan_one_peb(ptn, si, i, buf, spare);
 
 	/* Sanity check */
 	if (si->bad_cnt + si->empty_cnt + si->free_cnt + si->used_cnt != (int)ptn->length) {
@@ -637,10 +838,13 @@ static struct ubi_scan_info *scan_partition(struct ptentry *ptn)
 	} else {
 		si->mean_ec = UBI_DEF_ERACE_COUNTER;
 	}
-	free(ec_hdr);
+	free(spare);
+	free(buf);
 	return si;
 
 out_failed:
+	free(spare);
+	free(buf);
 	free(si->pebs_data);
 out_failed_pebs:
 	free(si);
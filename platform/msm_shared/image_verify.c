@@ -27,15 +27,254 @@
 #include <x509.h>
 #include <certificate.h>
 #include <crypto_hash.h>
+#include <string.h>
 #include "image_verify.h"
 #include "scm.h"
 
+/*
+ * Public key operations for signature verification. The modulus is decoded
+ * once into 32-bit words together with the Montgomery constants and kept in
+ * a small cache, so verifying a boot image with a known key only costs the
+ * modular exponentiation. For the usual public exponent 65537 this is 17
+ * Montgomery multiplications; other exponents go through OpenSSL.
+ */
+
+#define RSA_MAX_WORDS		(4096 / 32)
+#define RSA_KEY_CACHE_SIZE	4
+#define RSA_F4_EXPONENT		65537
+
+struct rsa_pubkey {
+	unsigned int len;		/* Modulus length in 32-bit words */
+	uint32_t n0inv;			/* -1 / n[0] mod 2^32 */
+	uint32_t n[RSA_MAX_WORDS];	/* Modulus, least significant word first */
+	uint32_t rr[RSA_MAX_WORDS];	/* R^2 mod n, R = 2^(32 * len) */
+};
+
+static struct rsa_pubkey rsa_key_cache[RSA_KEY_CACHE_SIZE];
+static unsigned int rsa_key_cache_next;
+
+static void rsa_bytes_to_words(uint32_t *w, const unsigned char *b,
+			       unsigned int len)
+{
+	unsigned int i;
+
+	for (i = 0; i < len; i++) {
+		const unsigned char *p = b + 4 * (len - 1 - i);
+		w[i] = (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+	}
+}
+
+static void rsa_words_to_bytes(unsigned char *b, const uint32_t *w,
+			       unsigned int len)
+{
+	unsigned int i;
+
+	for (i = 0; i < len; i++) {
+		unsigned char *p = b + 4 * (len - 1 - i);
+		p[0] = w[i] >> 24;
+		p[1] = w[i] >> 16;
+		p[2] = w[i] >> 8;
+		p[3] = w[i];
+	}
+}
+
+/* Returns 1 if a >= n */
+static int rsa_geq(const struct rsa_pubkey *key, const uint32_t *a)
+{
+	unsigned int i = key->len;
+
+	while (i--) {
+		if (a[i] != key->n[i])
+			return a[i] > key->n[i];
+	}
+	return 1;
+}
+
+static void rsa_sub_mod(const struct rsa_pubkey *key, uint32_t *a)
+{
+	uint64_t borrow = 0;
+	unsigned int i;
+
+	for (i = 0; i < key->len; i++) {
+		borrow = (uint64_t)a[i] - key->n[i] - borrow;
+		a[i] = (uint32_t)borrow;
+		borrow = (borrow >> 32) & 1;
+	}
+}
+
+/* c = a * b / R mod n, c may alias a or b */
+static void rsa_mont_mul(const struct rsa_pubkey *key, uint32_t *c,
+			 const uint32_t *a, const uint32_t *b)
+{
+	uint32_t t[RSA_MAX_WORDS + 2];
+	unsigned int len = key->len;
+	unsigned int i, j;
+	uint64_t cs;
+	uint32_t m;
+
+	memset(t, 0, (len + 2) * sizeof(uint32_t));
+
+	for (i = 0; i < len; i++) {
+		cs = 0;
+		for (j = 0; j < len; j++) {
+			cs = (uint64_t)a[j] * b[i] + t[j] + (cs >> 32);
+			t[j] = (uint32_t)cs;
+		}
+		cs = (uint64_t)t[len] + (cs >> 32);
+		t[len] = (uint32_t)cs;
+		t[len + 1] = (uint32_t)(cs >> 32);
+
+		m = t[0] * key->n0inv;
+		cs = (uint64_t)m * key->n[0] + t[0];
+		for (j = 1; j < len; j++) {
+			cs = (uint64_t)m * key->n[j] + t[j] + (cs >> 32);
+			t[j - 1] = (uint32_t)cs;
+		}
+		cs = (uint64_t)t[len] + (cs >> 32);
+		t[len - 1] = (uint32_t)cs;
+		t[len] = t[len + 1] + (uint32_t)(cs >> 32);
+	}
+
+	if (t[len] || rsa_geq(key, t))
+		rsa_sub_mod(key, t);
+
+	memcpy(c, t, len * sizeof(uint32_t));
+}
+
+/* Precompute n0inv and R^2 mod n for a decoded modulus */
+static void rsa_pubkey_setup(struct rsa_pubkey *key)
+{
+	uint32_t *x = key->rr;
+	uint32_t inv = key->n[0];
+	unsigned int i, j;
+	uint32_t carry;
+
+	/* Newton iteration, each step doubles the number of correct bits */
+	for (i = 0; i < 5; i++)
+		inv *= 2 - key->n[0] * inv;
+	key->n0inv = -inv;
+
+	/* Start from 1 and double 2 * 32 * len times modulo n */
+	memset(x, 0, key->len * sizeof(uint32_t));
+	x[0] = 1;
+	for (i = 0; i < 64 * key->len; i++) {
+		carry = 0;
+		for (j = 0; j < key->len; j++) {
+			uint32_t w = x[j];
+			x[j] = (w << 1) | carry;
+			carry = w >> 31;
+		}
+		if (carry || rsa_geq(key, x))
+			rsa_sub_mod(key, x);
+	}
+}
+
+/* out = in ^ 65537 mod n, all numbers big endian with key->len words */
+static void rsa_mod_exp_f4(const struct rsa_pubkey *key, unsigned char *out,
+			   const unsigned char *in)
+{
+	uint32_t a[RSA_MAX_WORDS], ar[RSA_MAX_WORDS];
+	unsigned int i;
+
+	rsa_bytes_to_words(a, in, key->len);
+
+	rsa_mont_mul(key, ar, a, key->rr);	/* a * R */
+	for (i = 0; i < 16; i++)
+		rsa_mont_mul(key, ar, ar, ar);	/* a^65536 * R */
+	rsa_mont_mul(key, ar, ar, a);		/* a^65537 */
+
+	rsa_words_to_bytes(out, ar, key->len);
+}
+
+/* Find the decoded form of a 65537 public key, decode it if not cached yet */
+static struct rsa_pubkey *rsa_pubkey_get(RSA *rsa_key)
+{
+	unsigned char buf[RSA_MAX_WORDS * 4];
+	uint32_t n[RSA_MAX_WORDS];
+	struct rsa_pubkey *key;
+	unsigned int i, nbytes, len;
+
+	if (!rsa_key->n || !rsa_key->e ||
+	    BN_get_word(rsa_key->e) != RSA_F4_EXPONENT || !BN_is_odd(rsa_key->n))
+		return NULL;
+
+	nbytes = BN_num_bytes(rsa_key->n);
+	if (!nbytes || nbytes > sizeof(buf) || nbytes % 4)
+		return NULL;
+
+	len = nbytes / 4;
+	BN_bn2bin(rsa_key->n, buf);
+	rsa_bytes_to_words(n, buf, len);
+
+	for (i = 0; i < RSA_KEY_CACHE_SIZE; i++) {
+		key = &rsa_key_cache[i];
+		if (key->len == len && !memcmp(key->n, n, len * sizeof(uint32_t)))
+			return key;
+	}
+
+	key = &rsa_key_cache[rsa_key_cache_next];
+	rsa_key_cache_next = (rsa_key_cache_next + 1) % RSA_KEY_CACHE_SIZE;
+
+	key->len = len;
+	memcpy(key->n, n, len * sizeof(uint32_t));
+	rsa_pubkey_setup(key);
+
+	return key;
+}
+
+/*
+ * Same as RSA_public_decrypt() with RSA_PKCS1_PADDING for a signature
+ * as long as the modulus. Returns -1 on failure, otherwise the length of
+ * the data after the padding.
+ */
+static int rsa_public_decrypt_f4(const struct rsa_pubkey *key,
+				 unsigned char *signature_ptr,
+				 unsigned char *plain_text)
+{
+	unsigned char em[RSA_MAX_WORDS * 4];
+	uint32_t s[RSA_MAX_WORDS];
+	unsigned int nbytes = key->len * 4;
+	unsigned int i;
+
+	/* The signature must be smaller than the modulus */
+	rsa_bytes_to_words(s, signature_ptr, key->len);
+	if (rsa_geq(key, s))
+		return -1;
+
+	rsa_mod_exp_f4(key, em, signature_ptr);
+
+	/* PKCS #1 v1.5 block type 1: 00 01 FF .. FF 00 data, at least 8 FF */
+	if (em[0] != 0x00 || em[1] != 0x01)
+		return -1;
+
+	for (i = 2; i < nbytes && em[i] == 0xff; i++)
+		;
+
+	if (i == nbytes || em[i] != 0x00 || i - 2 < 8)
+		return -1;
+	i++;
+
+	memcpy(plain_text, em + i, nbytes - i);
+	return nbytes - i;
+}
+
+/*
+ * Decode a public key ahead of time so that verifying with it later only
+ * costs the exponentiation.
+ */
+void image_rsa_key_cache(RSA *rsa_key)
+{
+	if (rsa_key != NULL && RSA_size(rsa_key) == SIGNATURE_SIZE)
+		rsa_pubkey_get(rsa_key);
+}
+
 /*
  * Returns -1 if decryption failed otherwise size of plain_text in bytes
  */
 int image_decrypt_signature_rsa(unsigned char *signature_ptr,
 		unsigned char *plain_text, RSA *rsa_key)
 {
+	struct rsa_pubkey *key = NULL;
 	int ret = -1;
 
 	if (rsa_key == NULL) {
@@ -43,6 +282,16 @@ int image_decrypt_signature_rsa(unsigned char *signature_ptr,
 		return ret;
 	}
 
+	if (RSA_size(rsa_key) == SIGNATURE_SIZE)
+		key = rsa_pubkey_get(rsa_key);
+
+	if (key != NULL) {
+		ret = rsa_public_decrypt_f4(key, signature_ptr, plain_text);
+		dprintf(SPEW, "DEBUG: Return of rsa_public_decrypt_f4 = %d\n",
+			ret);
+		return ret;
+	}
+
 	ret = RSA_public_decrypt(SIGNATURE_SIZE, signature_ptr, plain_text,
 				 rsa_key, RSA_PKCS1_PADDING);
 	dprintf(SPEW, "DEBUG openssl: Return of RSA_public_decrypt = %d\n",
@@ -44,5 +44,6 @@ enum bs_entry {
 	BS_MAX,
 };
 void bs_set_timestamp(enum bs_entry bs_id);
+void spmi_stats_mark(enum bs_entry bs_id);
 
 #endif
@@ -177,6 +177,26 @@ struct clk_list {
 
 #define CLK_LOOKUP(con, c) { .con_id = con, .clk = &c }
 
+/**
+ * struct clk_group_entry - clock in a clock group
+ * @id: clock consumer ID
+ * @rate: rate to set before enabling, 0 to keep the current rate
+ * @clk: handle, resolved from @id the first time the group is used
+ */
+struct clk_group_entry {
+	const char *id;
+	unsigned long rate;
+	struct clk *clk;
+};
+
+struct clk_group {
+	const char *name;
+	struct clk_group_entry *clks;
+	unsigned num;
+};
+
+#define CLK_GROUP(n, entries) { .name = n, .clks = entries, .num = ARRAY_SIZE(entries) }
+
 #ifdef DEBUG_CLOCK
 struct clk_list *clk_get_list(void);
 #endif
@@ -187,6 +207,30 @@ struct clk_list *clk_get_list(void);
  * @num: number of clocks in the list
  */
 void clk_init(struct clk_lookup *clist, unsigned num);
+/**
+ * clk_group_enable - set the rates and enable all clocks of a group.
+ * The enable bits are written in order, the status bits of all branches
+ * are polled together at the end.
+ * @group: clock group
+ *
+ * Returns success (0) or negative errno.
+ */
+int clk_group_enable(struct clk_group *group);
+/**
+ * clk_group_disable - disable all clocks of a group in reverse order.
+ * @group: clock group
+ */
+void clk_group_disable(struct clk_group *group);
+/**
+ * clk_defer_status - defer waiting for a clock to a clock group.
+ * Called by clock enable ops after writing the enable bit.
+ * @clk: pointer to clock
+ * @ready: returns true once the clock is running
+ *
+ * Returns true if the clock group waits for the clock, false if the
+ * caller needs to wait itself.
+ */
+bool clk_defer_status(struct clk *clk, bool (*ready)(struct clk *clk));
 /**
  * clk_reset - Reset block using BCR
  * @clk: pointer to clock
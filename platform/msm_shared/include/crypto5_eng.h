@@ -171,6 +171,10 @@ void crypto5_set_ctx(struct crypto_dev *dev,
 uint32_t crypto5_send_data(struct crypto_dev *dev,
 						   void *ctx_ptr,
 						   uint8_t *data_ptr);
+uint32_t crypto5_queue_data(struct crypto_dev *dev,
+							void *ctx_ptr,
+							uint8_t *data_ptr);
+void crypto5_wait_data(struct crypto_dev *dev);
 void crypto5_cleanup(struct crypto_dev *dev);
 uint32_t crypto5_get_digest(struct crypto_dev *dev,
 							uint8_t *digest_ptr,
@@ -99,6 +99,13 @@ extern void crypto_send_data(void *ctx_ptr,
 			     unsigned int bytes_to_write,
 			     unsigned int *ret_status);
 
+extern void crypto_queue_data(void *ctx_ptr,
+			      unsigned char *data_ptr,
+			      unsigned int bytes_to_write,
+			      unsigned int *ret_status);
+
+extern void crypto_wait_data(unsigned int *ret_status);
+
 extern void crypto_get_digest(unsigned char *digest_ptr,
 			      unsigned int *ret_status,
 			      crypto_auth_alg_type auth_alg, bool last);
@@ -131,6 +138,13 @@ static crypto_result_type crypto_sha1(unsigned char *buff_ptr,
 				      unsigned int buff_size,
 				      unsigned char *digest_ptr);
 
+void hash_find(unsigned char *addr, unsigned int size, unsigned char *digest,
+	       unsigned char auth_alg);
+
+int hash_stream_start(unsigned char *base, unsigned char auth_alg);
+void hash_stream_update(unsigned int size);
+void hash_stream_stop(void);
+
 #if VERIFIED_BOOT
 bool crypto_initialized(void);
 #else
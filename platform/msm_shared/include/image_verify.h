@@ -44,6 +44,9 @@ int image_verify(unsigned char *image_ptr,
 int image_decrypt_signature_rsa(unsigned char *signature_ptr,
 		unsigned char *plain_text, RSA *rsa_key);
 
+/* Decode RSA public key in advance for image_decrypt_signature_rsa() */
+void image_rsa_key_cache(RSA *rsa_key);
+
 /* Find hash of image */
 void image_find_digest(unsigned char *image_ptr, unsigned int image_size,
 		unsigned hash_type, unsigned char *digest);
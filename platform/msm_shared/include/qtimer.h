@@ -37,6 +37,8 @@
 
 void qtimer_set_physical_timer(time_t msecs_interval,
 	platform_timer_callback tmr_callback, void *tmr_arg);
+void qtimer_set_oneshot_timer(time_t msecs,
+	platform_timer_callback tmr_callback, void *tmr_arg);
 void qtimer_disable();
 uint64_t qtimer_get_phy_timer_cnt();
 uint32_t qtimer_current_time();
@@ -89,6 +89,8 @@ typedef struct
 
 typedef rpm_cmd rpm_ack_msg;
 int rpm_send_data(uint32_t *data, uint32_t len, msg_type type);
+int rpm_send_data_async(uint32_t *data, uint32_t len);
+int rpm_wait_for_ack(const int *ids, uint32_t count);
 uint32_t rpm_recv_data(uint32_t *len);
 void rpm_clk_enable(uint32_t *data, uint32_t len);
 void rpm_clk_disable(uint32_t *data, uint32_t len);
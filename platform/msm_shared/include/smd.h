@@ -104,7 +104,9 @@ typedef struct
 	smd_shared_stream_info_type ch1;
 } smd_port_ctrl_info;
 
-typedef struct
+typedef struct smd_channel_info smd_channel_info_t;
+
+struct smd_channel_info
 {
 	smd_channel_alloc_entry_t alloc_entry;
 	uint8_t *send_buf;
@@ -114,7 +116,9 @@ typedef struct
 	uint32_t current_state;
 	event_t wevt;
 	event_t revt;
-} smd_channel_info_t;
+	/* Called from the SMD interrupt when there is data to read */
+	void (*read_notify)(smd_channel_info_t *ch);
+};
 
 int smd_init(smd_channel_info_t *ch, uint32_t ch_type);
 void smd_uninit(smd_channel_info_t *ch);
@@ -126,4 +130,5 @@ void smd_notify_rpm();
 enum handler_return smd_irq_handler(void* data);
 void smd_set_state(smd_channel_info_t *ch, uint32_t state, uint32_t flag);
 void smd_signal_read_complete(smd_channel_info_t *ch, uint32_t len);
+bool smd_read_avail(smd_channel_info_t *ch);
 #endif
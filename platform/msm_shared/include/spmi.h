@@ -29,6 +29,8 @@
 #ifndef __SPMI_H
 #define __SPMI_H
 
+#include <platform/interrupts.h>
+
 #if SPMI_CORE_V2
 #include <spmi_v2.h>
 #else
@@ -101,6 +103,9 @@
 #define SPMI_CMD_DEV_DESC_BLK_MASTER_READ    0x10
 #define SPMI_CMD_DEV_DESC_BLK_SLAVE_READ     0x11
 
+/* Max number of bytes a single read/write command can transfer */
+#define PMIC_ARB_MAX_BYTES                   8
+
 /* Max number of Peripherals supported by SPMI */
 #define MAX_PERIPH                           128
 #define PMIC_ARB_SPMI_HW_VERSION             (SPMI_BASE + 0xF000)
@@ -138,12 +143,12 @@ struct pmic_arb_param{
 	uint8_t size;
 };
 
-typedef void (*spmi_callback)();
-
 void spmi_init(uint32_t, uint32_t);
 unsigned int pmic_arb_write_cmd(struct pmic_arb_cmd *cmd,
 	struct pmic_arb_param *param);
 unsigned int pmic_arb_read_cmd(struct pmic_arb_cmd *cmd,
 	struct pmic_arb_param *param);
+int spmi_register_periph_irq(uint32_t periph, int_handler handler, void *arg);
+void spmi_unregister_periph_irq(uint32_t periph);
 
 #endif
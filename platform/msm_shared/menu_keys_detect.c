@@ -34,6 +34,7 @@
 #include <kernel/timer.h>
 #include <platform/timer.h>
 #include <kernel/thread.h>
+#include <kernel/event.h>
 #include <dev/keys.h>
 #include <dev/fbcon.h>
 #include <menu_keys_detect.h>
@@ -41,6 +42,9 @@
 #include <platform/gpio.h>
 #include <platform/iomap.h>
 #include <platform.h>
+#include <target.h>
+#include <err.h>
+#include <bits.h>
 #include <reboot.h>
 #include <sys/types.h>
 #include <../../../app/aboot/recovery.h>
@@ -48,6 +52,7 @@
 #include <string.h>
 
 #define KEY_DETECT_FREQUENCY		50
+#define KEY_DEBOUNCE_TIME		20
 
 static time_t before_time;
 
@@ -97,18 +102,62 @@ static uint32_t unlock_index_action[] = {
 		[1] = RESTART,
 };
 
-static int is_key_pressed(int keys_type)
+/*
+ * Keys are reported when they go down. If the target can raise an
+ * interrupt for them, the menu thread sleeps on key_event until a key
+ * changes state and only samples the keys then. Otherwise the keys are
+ * sampled every KEY_DETECT_FREQUENCY ms.
+ */
+static bool key_down[ARRAY_SIZE(keys)];
+static event_t key_event;
+static bool key_event_ready;
+static bool key_irq;
+
+static enum handler_return keys_irq_handler(void *arg)
 {
-	int count = 0;
+	event_signal(&key_event, false);
+	return INT_RESCHEDULE;
+}
 
-	if (keys[keys_type].keys_pressed_func()) {
-		/*if key is pressed, wait for 1 second to see if it is released*/
-		while(count++ < 10 && keys[keys_type].keys_pressed_func())
-			thread_sleep(100);
-		return 1;
+/* Returns a mask of the keys pressed since the last call */
+static uint32_t keys_sample(void)
+{
+	uint32_t pressed = 0;
+	bool down;
+	unsigned i;
+
+	for (i = 0; i < ARRAY_SIZE(keys); i++) {
+		down = !!keys[i].keys_pressed_func();
+		if (down && !key_down[i])
+			pressed |= BIT(i);
+		key_down[i] = down;
 	}
 
-	return 0;
+	return pressed;
+}
+
+/* Wait up to timeout ms for a key to change, returns the pressed keys */
+static uint32_t keys_wait(time_t timeout)
+{
+	if (!key_irq) {
+		thread_sleep(MIN(timeout, KEY_DETECT_FREQUENCY));
+		return keys_sample();
+	}
+
+	if (event_wait_timeout(&key_event, timeout) != NO_ERROR)
+		return 0;
+
+	/* Let the contacts settle, later bounces signal the event again */
+	thread_sleep(KEY_DEBOUNCE_TIME);
+	target_keys_irq_ack();
+	return keys_sample();
+}
+
+/* Make the menu thread re-check its exit condition */
+void keys_detect_wakeup(void)
+{
+	if (key_event_ready)
+		event_signal(&key_event, false);
 }
 
 static void update_device_status(struct select_msg_info* msg_info, int reason)
@@ -344,21 +393,47 @@ static struct pages_action menu_pages_action[] = {
 
 void keys_detect_init()
 {
-	/* Waiting for all keys are released */
-	while(1) {
-		if(!keys[VOLUME_UP].keys_pressed_func() &&
-			!keys[VOLUME_DOWN].keys_pressed_func() &&
-			!keys[POWER_KEY].keys_pressed_func()) {
-			break;
-		}
-		thread_sleep(KEY_DETECT_FREQUENCY);
+	if (!key_event_ready) {
+		event_init(&key_event, false, EVENT_FLAG_AUTOUNSIGNAL);
+		key_event_ready = true;
 	}
+	event_unsignal(&key_event);
+
+	key_irq = target_keys_irq_enable(keys_irq_handler, NULL) == NO_ERROR;
+	if (!key_irq)
+		dprintf(INFO, "Menu keys have no interrupt, polling them\n");
+
+	/* Keys held down already only count once released */
+	keys_sample();
 
 	before_time = current_time();
 }
 
+/* Time left until the menu times out */
+static time_t keys_detect_timeout(struct select_msg_info *msg_info)
+{
+	time_t timeout = INFINITE_TIME;
+	time_t elapsed;
+
+	mutex_acquire(&msg_info->msg_lock);
+	/* Never time out if the timeout_time is 0 */
+	if (msg_info->info.timeout_time) {
+		elapsed = current_time() - before_time;
+		if (elapsed > msg_info->info.timeout_time)
+			timeout = 0;
+		else
+			timeout = msg_info->info.timeout_time - elapsed + 1;
+	}
+	mutex_release(&msg_info->msg_lock);
+
+	return timeout;
+}
+
 int select_msg_keys_detect(void *param) {
 	struct select_msg_info *msg_info = (struct select_msg_info*)param;
+	struct pages_action *action;
+	uint32_t pressed;
+	unsigned i;
 
 	msg_lock_init();
 	keys_detect_init();
@@ -372,17 +447,29 @@ int select_msg_keys_detect(void *param) {
 		 *	eg: 5->0
 		 * 2: update device's status via select option's index
 		 */
-		if (is_key_pressed(VOLUME_UP)) {
-			mutex_acquire(&msg_info->msg_lock);
-			menu_pages_action[msg_info->info.msg_type].up_action_func(msg_info);
-			mutex_release(&msg_info->msg_lock);
-		} else if (is_key_pressed(VOLUME_DOWN)) {
-			mutex_acquire(&msg_info->msg_lock);
-			menu_pages_action[msg_info->info.msg_type].down_action_func(msg_info);
-			mutex_release(&msg_info->msg_lock);
-		} else if (is_key_pressed(POWER_KEY)) {
+		pressed = keys_wait(keys_detect_timeout(msg_info));
+		for (i = 0; pressed && i < ARRAY_SIZE(keys); i++) {
+			if (!(pressed & BIT(i)))
+				continue;
+
 			mutex_acquire(&msg_info->msg_lock);
-			menu_pages_action[msg_info->info.msg_type].enter_action_func(msg_info);
+			action = &menu_pages_action[msg_info->info.msg_type];
+			if (msg_info->info.is_exit) {
+				mutex_release(&msg_info->msg_lock);
+				break;
+			}
+
+			switch (keys[i].type) {
+			case VOLUME_UP:
+				action->up_action_func(msg_info);
+				break;
+			case VOLUME_DOWN:
+				action->down_action_func(msg_info);
+				break;
+			case POWER_KEY:
+				action->enter_action_func(msg_info);
+				break;
+			}
 			mutex_release(&msg_info->msg_lock);
 		}
 
@@ -399,8 +486,9 @@ int select_msg_keys_detect(void *param) {
 			break;
 		}
 		mutex_release(&msg_info->msg_lock);
-		thread_sleep(KEY_DETECT_FREQUENCY);
 	}
 
+	if (key_irq)
+		target_keys_irq_disable();
 	return 0;
 }
@@ -29,6 +29,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <crc32.h>
+#include <boot_device.h>
+#include <target.h>
+#include <lib/fnv.h>
+#include <lib/partition.h>
 #include "mmc.h"
 #include "partition_parser.h"
 #define GPT_HEADER_SIZE 92
@@ -55,6 +59,7 @@ __WEAK void mmc_read_partition_table(uint8_t arg)
 }
 
 static uint32_t mmc_boot_read_gpt(uint32_t block_size);
+static void mmc_boot_forget_gpt(void);
 static uint32_t mmc_boot_read_mbr(uint32_t block_size);
 static void mbr_fill_name(struct partition_entry *partition_ent,
 						  uint32_t type);
@@ -87,6 +92,22 @@ static unsigned partition_count;
 /* this is a pointer to ptn_entries_buffer */
 static unsigned char *new_buffer = NULL;
 
+/*
+ * Open addressing hash index from partition name to partition_entries.
+ * It has twice as many slots as there can be partitions so probing
+ * always terminates. Code changing partition_entries must call
+ * partition_invalidate_index(), the next lookup rebuilds it.
+ */
+#define PTN_INDEX_SIZE (2 * NUM_PARTITIONS)
+#define PTN_INDEX_MASK (PTN_INDEX_SIZE - 1)
+static int16_t ptn_index[PTN_INDEX_SIZE];
+static bool ptn_index_valid;
+
+static void partition_invalidate_index(void)
+{
+	ptn_index_valid = false;
+}
+
 unsigned partition_get_partition_count()
 {
 	return partition_count;
@@ -135,6 +156,8 @@ static void partition_split(uint32_t block_size, const char *base_name,
 	else
 		base->first_lba += num_blocks;
 	base->size -= num_blocks;
+
+	partition_invalidate_index();
 }
 
 static void partition_split_boot(uint32_t block_size)
@@ -162,6 +185,7 @@ unsigned int partition_read_table()
 
 	partition_count = 0;
 	gpt_partitions_exist = 0;
+	partition_invalidate_index();
 
 	/* Read MBR of the card */
 	ret = mmc_boot_read_mbr(block_size);
@@ -310,144 +334,97 @@ end:
 	return ret;
 }
 
+static int mmc_boot_gpt_read(void *cookie, uint64_t offset, void *buf, size_t len)
+{
+	return mmc_read(offset, (uint32_t *)buf, len) ? -1 : 0;
+}
+
 /*
- * Read GPT from MMC and fill partition table
+ * The boot eMMC is registered as a block device and lib/partition already
+ * validated its GPT when publishing it. Returns its name if there is one.
  */
-static unsigned int mmc_boot_read_gpt(uint32_t block_size)
+static bool mmc_boot_bdev_name(char *name, size_t len)
 {
-	int ret = 0;
-	unsigned int header_size;
-	unsigned long long first_usable_lba;
-	unsigned long long backup_header_lba;
-	unsigned long long card_size_sec;
-	unsigned int max_partition_count = 0;
-	unsigned int partition_entry_size;
-	unsigned int i = 0;	/* Counter for each block */
-	unsigned int j = 0;	/* Counter for each entry in a block */
-	unsigned int n = 0;	/* Counter for UTF-16 -> 8 conversion */
-	unsigned char UTF16_name[MAX_GPT_NAME_SIZE];
-	/* LBA of first partition -- 1 Block after Protected MBR + 1 for PT */
-	uint64_t device_density;
-	uint8_t *data = NULL;
-	uint8_t *data_org_ptr = NULL;
-	uint32_t part_entry_cnt = block_size / ENTRY_SIZE;
+#if MMC_SDHCI_SUPPORT && WITH_LIB_BIO
+	struct mmc_device *dev;
 
-	/* Get the density of the mmc device */
-
-	device_density = mmc_get_device_capacity();
-
-	data = (uint8_t *)memalign(CACHE_LINE, ROUNDUP(block_size, CACHE_LINE));
-	if (!data)
-	{
-		dprintf(CRITICAL, "Failed to Allocate memory to read partition table\n");
-		ret = -1;
-		goto end;
-	}
-	data_org_ptr = data;
+	if (!platform_boot_dev_isemmc())
+		return false;
 
-	/* Print out the GPT first */
-	ret = mmc_read(block_size, (unsigned int *)data, block_size);
-	if (ret)
-	{
-		dprintf(CRITICAL, "GPT: Could not read primary gpt from mmc\n");
-		goto end;
-	}
-	ret = partition_parse_gpt_header(data, &first_usable_lba,
-					 &partition_entry_size, &header_size,
-					 &max_partition_count);
-	if (ret) {
-		dprintf(INFO, "GPT: (WARNING) Primary signature invalid\n");
-
-		/* Check the backup gpt */
+	dev = (struct mmc_device *)target_mmc_device();
+	snprintf(name, len, "hd%d", dev->config.slot);
+	return true;
+#else
+	return false;
+#endif
+}
 
-		/* Get size of MMC */
-		card_size_sec = (device_density) / block_size;
-		ASSERT (card_size_sec > 0);
+/* Drop the GPT cached by lib/partition after the table was rewritten */
+static void mmc_boot_forget_gpt(void)
+{
+	char name[16];
 
-		backup_header_lba = card_size_sec - 1;
-		ret = mmc_read((backup_header_lba * block_size), (unsigned int *)data,
-						block_size);
+	if (mmc_boot_bdev_name(name, sizeof(name)))
+		partition_forget_gpt(name);
+}
 
+/*
+ * Read GPT from MMC and fill partition table
+ */
+static unsigned int mmc_boot_read_gpt(uint32_t block_size)
+{
+	const struct gpt_table *table = NULL;
+	struct gpt_table gpt;
+	struct gpt_entry entry;
+	struct partition_entry *ent;
+	char name[16];
+	unsigned int i;
+	int ret;
+
+	if (mmc_boot_bdev_name(name, sizeof(name)))
+		table = partition_get_gpt(name);
+
+	if (!table) {
+		ret = gpt_read_table(mmc_boot_gpt_read, NULL, block_size,
+				     mmc_get_device_capacity() / block_size, &gpt);
 		if (ret) {
-			dprintf(CRITICAL,
-				"GPT: Could not read backup gpt from mmc\n");
-			goto end;
-		}
-		parse_secondary_gpt = 1;
-		ret = partition_parse_gpt_header(data, &first_usable_lba,
-						 &partition_entry_size,
-						 &header_size,
-						 &max_partition_count);
-		if (ret) {
-			dprintf(CRITICAL,
-				"GPT: Primary and backup signatures invalid\n");
-			goto end;
+			dprintf(CRITICAL, "GPT: Could not read gpt from mmc: %d\n", ret);
+			return 1;
 		}
-		parse_secondary_gpt = 0;
+		table = &gpt;
 	}
 
-	/* Read GPT Entries */
-	for (i = 0; i < (ROUNDUP(max_partition_count, part_entry_cnt)) / part_entry_cnt; i++) {
+	for (i = 0; i < table->entry_count; i++) {
 		ASSERT(partition_count < NUM_PARTITIONS);
 
-		data = (new_buffer + (i * block_size));
-		for (j = 0; j < part_entry_cnt; j++) {
-			memcpy(&(partition_entries[partition_count].type_guid),
-			       &data[(j * partition_entry_size)],
-			       PARTITION_TYPE_GUID_SIZE);
-			if (partition_entries[partition_count].type_guid[0] ==
-			    0x00
-			    && partition_entries[partition_count].
-			    type_guid[1] == 0x00) {
-				i = ROUNDUP(max_partition_count, part_entry_cnt);
-				break;
-			}
-			memcpy(&
-			       (partition_entries[partition_count].
-				unique_partition_guid),
-			       &data[(j * partition_entry_size) +
-				     UNIQUE_GUID_OFFSET],
-			       UNIQUE_PARTITION_GUID_SIZE);
-			partition_entries[partition_count].first_lba =
-			    GET_LLWORD_FROM_BYTE(&data
-						 [(j * partition_entry_size) +
-						  FIRST_LBA_OFFSET]);
-			partition_entries[partition_count].last_lba =
-			    GET_LLWORD_FROM_BYTE(&data
-						 [(j * partition_entry_size) +
-						  LAST_LBA_OFFSET]);
-			partition_entries[partition_count].size =
-			    partition_entries[partition_count].last_lba -
-			    partition_entries[partition_count].first_lba + 1;
-			partition_entries[partition_count].attribute_flag =
-			    GET_LLWORD_FROM_BYTE(&data
-						 [(j * partition_entry_size) +
-						  ATTRIBUTE_FLAG_OFFSET]);
-
-			memset(&UTF16_name, 0x00, MAX_GPT_NAME_SIZE);
-			memcpy(UTF16_name, &data[(j * partition_entry_size) +
-						 PARTITION_NAME_OFFSET],
-			       MAX_GPT_NAME_SIZE);
-			partition_entries[partition_count].lun = mmc_get_lun();
-
-			/*
-			 * Currently partition names in *.xml are UTF-8 and lowercase
-			 * Only supporting english for now so removing 2nd byte of UTF-16
-			 */
-			for (n = 0; n < MAX_GPT_NAME_SIZE / 2; n++) {
-				partition_entries[partition_count].name[n] =
-				    UTF16_name[n * 2];
-			}
-			partition_count++;
-		}
+		gpt_get_entry(table, i, &entry);
+		if (entry.type_guid[0] == 0x00 && entry.type_guid[1] == 0x00)
+			break;
+
+		ent = &partition_entries[partition_count];
+		memcpy(ent->type_guid, entry.type_guid, PARTITION_TYPE_GUID_SIZE);
+		memcpy(ent->unique_partition_guid, entry.unique_guid,
+		       UNIQUE_PARTITION_GUID_SIZE);
+		ent->first_lba = entry.first_lba;
+		ent->last_lba = entry.last_lba;
+		ent->size = entry.last_lba - entry.first_lba + 1;
+		ent->attribute_flag = entry.attributes;
+		ent->lun = mmc_get_lun();
+		memset(ent->name, 0, sizeof(ent->name));
+		strlcpy((char *)ent->name, entry.name, sizeof(ent->name));
+		partition_count++;
 	}
-end:
-	if (data_org_ptr)
-		free (data_org_ptr);
-	if (new_buffer)
+
+	if (table == &gpt)
+		gpt_free_table(&gpt);
+
+	/* Left behind by partition_parse_gpt_header() when flashing the GPT */
+	if (new_buffer) {
 		free(new_buffer);
+		new_buffer = NULL;
+	}
 
-	return ret;
+	return 0;
 }
 
 static unsigned int write_mbr_in_blocks(uint32_t size, uint8_t *mbrImage, uint32_t block_size)
@@ -820,7 +797,9 @@ static unsigned int write_gpt(uint32_t size, uint8_t *gptImage, uint32_t block_s
 
 	/* Re-read the GPT partition table */
 	dprintf(INFO, "Re-reading the GPT Partition Table\n");
+	mmc_boot_forget_gpt();
 	partition_count = 0;
+	partition_invalidate_index();
 	flashing_gpt = 0;
 	mmc_read_partition_table(0);
 	partition_dump();
@@ -942,23 +921,51 @@ mbr_fill_name(struct partition_entry *partition_ent, unsigned int type)
 	};
 }
 
+static void partition_build_index(void)
+{
+	const char *name;
+	unsigned n, slot;
+
+	memset(ptn_index, 0xff, sizeof(ptn_index));
+
+	for (n = 0; n < partition_count && n < NUM_PARTITIONS; n++) {
+		name = (const char *)partition_entries[n].name;
+		slot = fnv1a_hash(name, strnlen(name, MAX_GPT_NAME_SIZE));
+		slot &= PTN_INDEX_MASK;
+
+		/* Keep the first entry for duplicate names reachable first */
+		while (ptn_index[slot] >= 0)
+			slot = (slot + 1) & PTN_INDEX_MASK;
+		ptn_index[slot] = n;
+	}
+
+	ptn_index_valid = true;
+}
+
 /*
  * Find index of parition in array of partition entries
  */
 int partition_get_index(const char *name)
 {
 	unsigned int input_string_length = strlen(name);
-	unsigned n;
+	unsigned slot;
+	int n;
 
 	if( partition_count >= NUM_PARTITIONS)
 	{
 		return INVALID_PTN;
 	}
-	for (n = 0; n < partition_count; n++) {
-		if ((input_string_length == strlen((const char *)&partition_entries[n].name))
+
+	if (!ptn_index_valid)
+		partition_build_index();
+
+	slot = fnv1a_hash(name, input_string_length) & PTN_INDEX_MASK;
+	while ((n = ptn_index[slot]) >= 0) {
+		if ((input_string_length == strnlen((const char *)&partition_entries[n].name, MAX_GPT_NAME_SIZE))
 			&& !memcmp(name, &partition_entries[n].name, input_string_length)) {
 			return n;
 		}
+		slot = (slot + 1) & PTN_INDEX_MASK;
 	}
 	return INVALID_PTN;
 }
@@ -1199,6 +1206,7 @@ partition_parse_gpt_header(unsigned char *buffer,
 	}
 
 	total_entry_block_size = ROUNDUP((*max_partition_count) * (*partition_entry_size), block_size);
+	free(new_buffer);
 	new_buffer = (uint8_t *)memalign(CACHE_LINE, ROUNDUP(total_entry_block_size, CACHE_LINE));
 
 	if (!new_buffer)
@@ -1240,6 +1248,7 @@ partition_parse_gpt_header(unsigned char *buffer,
 	return ret;
 fail:
 	free(new_buffer);
+	new_buffer = NULL;
 	return ret;
 }
 
@@ -46,6 +46,24 @@ status_t platform_set_periodic_timer(platform_timer_callback callback,
 	return 0;
 }
 
+#if PLATFORM_HAS_DYNAMIC_TIMER
+status_t platform_set_oneshot_timer(platform_timer_callback callback,
+	void *arg, time_t interval)
+{
+	enter_critical_section();
+
+	qtimer_set_oneshot_timer(interval, callback, arg);
+
+	exit_critical_section();
+	return 0;
+}
+
+void platform_stop_timer(void)
+{
+	qtimer_disable();
+}
+#endif
+
 time_t current_time(void)
 {
 	return qtimer_current_time();
@@ -110,7 +128,13 @@ void udelay(unsigned usecs)
 /* Return current time in micro seconds */
 bigtime_t current_time_hires(void)
 {
+#if PLATFORM_HAS_DYNAMIC_TIMER
+	if (!ticks_per_sec)
+		return 0;
+	return qtimer_get_phy_timer_cnt() * 1000000ULL / ticks_per_sec;
+#else
 	return qtimer_current_time() * 1000000ULL;
+#endif
 }
 
 void qtimer_init()
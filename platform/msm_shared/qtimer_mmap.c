@@ -42,11 +42,18 @@ static time_t timer_interval;
 /* time in ms from start of LK. */
 static volatile uint32_t current_time;
 static uint32_t tick_count;
+static bool timer_oneshot;
 
 static void qtimer_enable();
 
 static enum handler_return qtimer_irq(void *arg)
 {
+	if (timer_oneshot) {
+		/* Stop the down counter, the next deadline is set by the callback */
+		qtimer_disable();
+		return timer_callback(timer_arg, qtimer_current_time());
+	}
+
 	current_time += timer_interval;
 
 	/* Program the down counter again to get
@@ -71,6 +78,7 @@ void qtimer_set_physical_timer(time_t msecs_interval,
 	/* Save the timer interval and call back data*/
 	tick_count = msecs_interval * qtimer_tick_rate() / 1000;;
 	timer_interval = msecs_interval;
+	timer_oneshot = false;
 	timer_arg = tmr_arg;
 	timer_callback = tmr_callback;
 
@@ -86,6 +94,39 @@ void qtimer_set_physical_timer(time_t msecs_interval,
 }
 
 
+#if PLATFORM_HAS_DYNAMIC_TIMER
+/* Programs the Physical Down counter to fire once after msecs.
+ * The time passed to the callback is read from the physical counter.
+ */
+void qtimer_set_oneshot_timer(time_t msecs,
+							  platform_timer_callback tmr_callback,
+							  void *tmr_arg)
+{
+	static bool irq_registered;
+
+	qtimer_disable();
+
+	tick_count = (uint64_t) msecs * qtimer_tick_rate() / 1000;
+	if (!tick_count)
+		tick_count = 1;
+	timer_interval = msecs;
+	timer_oneshot = true;
+	timer_arg = tmr_arg;
+	timer_callback = tmr_callback;
+
+	writel(tick_count, QTMR_V1_CNTP_TVAL);
+	dsb();
+
+	if (!irq_registered) {
+		register_int_handler(INT_QTMR_FRM_0_PHYSICAL_TIMER_EXP, qtimer_irq, 0);
+		unmask_interrupt(INT_QTMR_FRM_0_PHYSICAL_TIMER_EXP);
+		irq_registered = true;
+	}
+
+	qtimer_enable();
+}
+#endif
+
 /* Function to return the frequency of the timer */
 uint32_t qtimer_get_frequency()
 {
@@ -144,5 +185,14 @@ inline __ALWAYS_INLINE uint64_t qtimer_get_phy_timer_cnt()
 
 uint32_t qtimer_current_time()
 {
+#if PLATFORM_HAS_DYNAMIC_TIMER
+	/* There is no periodic tick to count, use the physical counter */
+	uint32_t ticks_per_msec = qtimer_tick_rate() / 1000;
+
+	if (!ticks_per_msec)
+		return 0;
+	return qtimer_get_phy_timer_cnt() / ticks_per_msec;
+#else
 	return current_time;
+#endif
 }
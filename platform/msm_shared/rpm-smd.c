@@ -33,19 +33,49 @@
 #include <sys/types.h>
 #include <arch/defines.h>
 #include <debug.h>
+#include <err.h>
 #include <stdlib.h>
+#include <kernel/thread.h>
 
 #define RPM_REQ_MAGIC 0x00716572
 #define RPM_CMD_MAGIC 0x00646d63
+#define RPM_MSG_MAGIC 0x0067736d
 #define REQ_MSG_LENGTH 0x14
 #define CMD_MSG_LENGTH 0x08
 #define ACK_MSG_LENGTH 0x0C
+#define REQ_PAD_LENGTH 0x0C
+
+/* Requests in flight, each one waits for its ACK in a slot of the pool */
+#define RPM_MSG_POOL_SIZE 8
+#define RPM_MAX_KVP_LENGTH 96
+#define RPM_MAX_ACK_LENGTH 128
+
+enum rpm_msg_state
+{
+	RPM_MSG_FREE,
+	RPM_MSG_PENDING,
+	RPM_MSG_ACKED,
+	RPM_MSG_ERROR,
+};
+
+struct rpm_msg
+{
+	uint32_t id;
+	volatile enum rpm_msg_state state;
+};
 
 static uint32_t msg_id;
+static struct rpm_msg rpm_msg_pool[RPM_MSG_POOL_SIZE];
+/* Request staging buffer, smd_write() copies it into the FIFO right away */
+static uint32_t rpm_req_buf[(sizeof(rpm_gen_hdr) + sizeof(rpm_req_hdr) +
+			     RPM_MAX_KVP_LENGTH + REQ_PAD_LENGTH) / 4];
 smd_channel_info_t ch;
 
+static void rpm_read_acks(smd_channel_info_t *ch);
+
 void rpm_smd_init()
 {
+	ch.read_notify = rpm_read_acks;
 	smd_init(&ch, SMD_APPS_RPM);
 }
 
@@ -70,46 +100,133 @@ static void free_kvp_object(kvp_data **kdata)
 		free(*kdata);
 }
 
-int rpm_send_data(uint32_t *data, uint32_t len, msg_type type)
+static struct rpm_msg *rpm_find_msg(uint32_t id, enum rpm_msg_state state)
 {
-	rpm_req req;
-	rpm_cmd cmd;
-	uint32_t len_to_smd = 0;
+	int i;
+
+	for (i = 0; i < RPM_MSG_POOL_SIZE; i++)
+	{
+		if (rpm_msg_pool[i].state == state &&
+		    (state == RPM_MSG_FREE || rpm_msg_pool[i].id == id))
+			return &rpm_msg_pool[i];
+	}
+
+	return NULL;
+}
+
+/*
+ * Queue a resource request in the SMD FIFO without waiting for the ACK.
+ * Returns the message id to pass to rpm_wait_for_ack() or a negative error.
+ */
+int rpm_send_data_async(uint32_t *data, uint32_t len)
+{
+	rpm_gen_hdr *hdr = (rpm_gen_hdr *)rpm_req_buf;
+	rpm_req_hdr *req_hdr = (rpm_req_hdr *)(hdr + 1);
+	uint8_t *kvp = (uint8_t *)(req_hdr + 1);
+	struct rpm_msg *msg;
+	int ret;
+
+	if (len > RPM_MAX_KVP_LENGTH)
+	{
+		dprintf(CRITICAL, "RPM request too large: %u\n", len);
+		return ERR_TOO_BIG;
+	}
+
+	enter_critical_section();
+
+	msg = rpm_find_msg(0, RPM_MSG_FREE);
+	if (!msg)
+	{
+		exit_critical_section();
+		dprintf(CRITICAL, "No free RPM message, wait for pending ACKs first\n");
+		return ERR_NO_MEMORY;
+	}
+
+	/* Message ids are positive so they can be told apart from errors */
+	msg_id = (msg_id + 1) & 0x7fffffff;
+	if (!msg_id)
+		msg_id = 1;
+
+	hdr->type = RPM_REQ_MAGIC;
+	hdr->len = len + REQ_MSG_LENGTH;
+	req_hdr->id = msg_id;
+	req_hdr->set = 0;//assume active set. check sleep set.
+	req_hdr->resourceType = data[RESOURCETYPE];
+	req_hdr->resourceId = data[RESOURCEID];
+	req_hdr->dataLength = len;
+	memcpy(kvp, data + 2, len);
+	memset(kvp + len, 0, REQ_PAD_LENGTH);
+
+	ret = smd_write(&ch, rpm_req_buf, len + sizeof(*hdr) + sizeof(*req_hdr) +
+			REQ_PAD_LENGTH, SMD_APPS_RPM);
+	if (!ret)
+	{
+		msg->id = msg_id;
+		msg->state = RPM_MSG_PENDING;
+		ret = msg_id;
+	}
+	else
+	{
+		ret = ERR_IO;
+	}
+
+	exit_critical_section();
+	return ret;
+}
+
+/*
+ * Wait until all requests in ids are acknowledged by the RPM and release
+ * their messages. ACKs are collected from the SMD interrupt or polled here.
+ * Returns 0 if all requests were sent and succeeded.
+ */
+int rpm_wait_for_ack(const int *ids, uint32_t count)
+{
+	struct rpm_msg *msg;
 	int ret = 0;
-	uint32_t ack_msg_len = 0;
-	uint32_t rlen = 0;
-	void *smd_data = NULL;
+	uint32_t i;
 
-	switch(type)
+	for (i = 0; i < count; i++)
 	{
-		case RPM_REQUEST_TYPE:
-			req.hdr.type = RPM_REQ_MAGIC;
-			req.hdr.len = len + REQ_MSG_LENGTH;//20
-			req.req_hdr.id = ++msg_id;
-			req.req_hdr.set = 0;//assume active set. check sleep set.
-			req.req_hdr.resourceType = data[RESOURCETYPE];
-			req.req_hdr.resourceId = data[RESOURCEID];
-			req.req_hdr.dataLength = len;
+		if (ids[i] <= 0)
+		{
+			ret = ERR_IO;
+			continue;
+		}
 
-			fill_kvp_object(&req.data, data, len);
-			len_to_smd = req.req_hdr.dataLength + 0x28;
+		enter_critical_section();
 
-			smd_data = (void*) malloc(len_to_smd);
-			ASSERT(smd_data);
+		msg = rpm_find_msg(ids[i], RPM_MSG_PENDING);
+		while (msg && msg->state == RPM_MSG_PENDING)
+			rpm_read_acks(&ch);
 
-			memcpy(smd_data, &req.hdr, sizeof(rpm_gen_hdr));
-			memcpy(smd_data + sizeof(rpm_gen_hdr), &req.req_hdr, sizeof(rpm_req_hdr));
-			memcpy(smd_data + sizeof(rpm_gen_hdr)+ sizeof(rpm_req_hdr), req.data, len);
+		if (!msg)
+			msg = rpm_find_msg(ids[i], RPM_MSG_ACKED);
+		if (!msg)
+			msg = rpm_find_msg(ids[i], RPM_MSG_ERROR);
 
-			ret = smd_write(&ch, smd_data, len_to_smd, SMD_APPS_RPM);
+		if (!msg || msg->state == RPM_MSG_ERROR)
+			ret = ERR_IO;
+		if (msg)
+			msg->state = RPM_MSG_FREE;
 
-			/* Read the response */
-			ack_msg_len = rpm_recv_data(&rlen);
+		exit_critical_section();
+	}
+
+	return ret;
+}
 
-			smd_signal_read_complete(&ch, ack_msg_len);
+int rpm_send_data(uint32_t *data, uint32_t len, msg_type type)
+{
+	rpm_cmd cmd;
+	uint32_t len_to_smd = 0;
+	int ret = 0;
+	int id;
 
-			free(smd_data);
-			free_kvp_object(&req.data);
+	switch(type)
+	{
+		case RPM_REQUEST_TYPE:
+			id = rpm_send_data_async(data, len);
+			ret = rpm_wait_for_ack(&id, 1);
 		break;
 		case RPM_CMD_TYPE:
 			cmd.hdr.type = RPM_CMD_MAGIC;
@@ -132,9 +249,10 @@ uint32_t rpm_recv_data(uint32_t* len)
 {
 	rpm_ack_msg *resp;
 	msg_type type;
+	struct rpm_msg *msg;
 	uint32_t ret = 0;
-	/* As per the current design rpm response does not exceed 20 bytes */
-	uint32_t response[5];
+	/* Room for the ACK and a short error string */
+	uint32_t response[RPM_MAX_ACK_LENGTH / 4];
 
 	smd_read(&ch, len, SMD_APPS_RPM, response);
 
@@ -165,6 +283,16 @@ uint32_t rpm_recv_data(uint32_t* len)
 		dprintf(CRITICAL, "Received ERROR ACK \n");
 	}
 
+	/* The first message of a request ACK carries the id of the request */
+	if (type == RPM_REQUEST_TYPE && response[2] == RPM_MSG_MAGIC)
+	{
+		msg = rpm_find_msg(response[4], RPM_MSG_PENDING);
+		if (msg)
+			msg->state = ret ? RPM_MSG_ERROR : RPM_MSG_ACKED;
+		else
+			dprintf(SPEW, "Unexpected RPM ACK for message %u\n", response[4]);
+	}
+
 	if(!ret)
 	{
 		ret = sizeof(rpm_gen_hdr) + sizeof(kvp_data);
@@ -173,6 +301,19 @@ uint32_t rpm_recv_data(uint32_t* len)
 	return ret;
 }
 
+/* Complete all pending messages that have an ACK in the FIFO */
+static void rpm_read_acks(smd_channel_info_t *ch)
+{
+	uint32_t ack_msg_len;
+	uint32_t rlen = 0;
+
+	while (smd_read_avail(ch))
+	{
+		ack_msg_len = rpm_recv_data(&rlen);
+		smd_signal_read_complete(ch, ack_msg_len);
+	}
+}
+
 void rpm_clk_enable(uint32_t *data, uint32_t len)
 {
 	/* Send the request to SMD */
@@ -273,6 +273,13 @@ void smd_read(smd_channel_info_t *ch, uint32_t *len, int ch_type, uint32_t *resp
 	return response;
 }
 
+bool smd_read_avail(smd_channel_info_t *ch)
+{
+	arch_invalidate_cache_range((addr_t) ch->port_info, sizeof(*ch->port_info));
+
+	return ch->port_info->ch1.write_index != ch->port_info->ch1.read_index;
+}
+
 void smd_signal_read_complete(smd_channel_info_t *ch, uint32_t len)
 {
 	/* Clear the data_written flag */
@@ -434,5 +441,9 @@ enum handler_return smd_irq_handler(void* data)
 		dprintf(CRITICAL,"Channel alloc freed\n");
 	}
 
+	if (ch->current_state == SMD_SS_OPENED && ch->read_notify &&
+	    smd_read_avail(ch))
+		ch->read_notify(ch);
+
 	return INT_NO_RESCHEDULE;
 }
@@ -27,23 +27,35 @@
  */
 
 #include <debug.h>
+#include <err.h>
 #include <reg.h>
 #include <spmi.h>
 #include <bits.h>
 #include <platform/iomap.h>
 #include <platform/irqs.h>
 #include <platform/interrupts.h>
+#include <boot_stats.h>
+#include <kernel/thread.h>
 
 #define PMIC_ARB_V2 0x20010000
 #define CHNL_IDX(sid, pid) ((sid << 8) | pid)
 
 static uint32_t pmic_arb_chnl_num;
 static uint32_t pmic_arb_owner_id;
-static uint8_t pmic_irq_perph_id;
-static spmi_callback callback;
 static uint32_t pmic_arb_ver;
 static uint8_t *chnl_tbl;
 
+/* Arbiter round trips, snapshot at every boot stats timestamp */
+struct spmi_stats {
+	uint32_t reads;
+	uint32_t writes;
+	uint32_t bytes;
+};
+
+static struct spmi_stats spmi_stats;
+static struct spmi_stats spmi_stats_phase[BS_MAX];
+static bool spmi_stats_phase_valid[BS_MAX];
+
 static void spmi_lookup_chnl_number()
 {
 	int i;
@@ -84,6 +96,7 @@ void spmi_init(uint32_t chnl_num, uint32_t owner_id)
 	}
 	else
 	{
+		pmic_arb_owner_id = owner_id;
 		spmi_lookup_chnl_number();
 	}
 }
@@ -181,6 +194,8 @@ unsigned int pmic_arb_write_cmd(struct pmic_arb_cmd *cmd,
 	val |= ((uint32_t)(cmd->byte_cnt));
 
 	writel(val, PMIC_ARB_CHNLn_CMD0(pmic_arb_chnl_num));
+	spmi_stats.writes++;
+	spmi_stats.bytes += param->size;
 
 	/* Wait till CMD DONE status */
 	while (!(val = readl(PMIC_ARB_CHNLn_STATUS(pmic_arb_chnl_num))));
@@ -282,6 +297,8 @@ unsigned int pmic_arb_read_cmd(struct pmic_arb_cmd *cmd,
 #else
 		writel(val, PMIC_ARB_CHNLn_CMD0(pmic_arb_chnl_num));
 #endif
+	spmi_stats.reads++;
+	spmi_stats.bytes += param->size;
 
 	/* Wait till CMD DONE status */
 #if SPMI_CORE_V2
@@ -321,73 +338,172 @@ unsigned int pmic_arb_read_cmd(struct pmic_arb_cmd *cmd,
 }
 
 
-/* Funtion to determine if the peripheral that caused the interrupt
- * is of interest.
- * Also handles callback function and interrupt clearing if the
- * correct interrupt is fired.
- * periph_acc_irq: SPMI_PIC_OWNERm_ACC_STATUSn register id.
- * status: Bits of the periph_acc_irq.
- * return 1 if the peripheral is of interest,
- * 0 otherwise.
+/* Peripheral interrupts are routed to at most this many handlers */
+#define SPMI_MAX_PERIPH_IRQS 4
+
+struct spmi_periph_irq {
+	uint32_t chnl;
+	int_handler handler;
+	void *arg;
+};
+
+static struct spmi_periph_irq periph_irqs[SPMI_MAX_PERIPH_IRQS];
+static bool periph_irq_registered;
+
+/* Only touches the arbiter, handlers must not issue SPMI commands since
+ * the interrupted thread may be in the middle of one.
  */
-int spmi_acc_irq(uint32_t periph_acc_irq, uint32_t status)
+static enum handler_return spmi_irq(void *arg)
 {
-	uint8_t reg_id;
-	uint8_t offset;
-
-	/* Narrow down the correct register for the peripheral*/
-	reg_id = pmic_irq_perph_id / 32;
-	if (periph_acc_irq * 8 != reg_id)
-		return 0;
+	enum handler_return ret = INT_NO_RESCHEDULE;
+	struct spmi_periph_irq *irq;
+	uint32_t status;
+	int i;
 
-	/* Narrow down the correct interrupt within the register */
-	offset = pmic_irq_perph_id & 31;
-	if ((status & offset))
+	for (i = 0; i < SPMI_MAX_PERIPH_IRQS; i++)
 	{
-		/* Clear the interrupt */
-		writel(offset ^ status, SPMI_PIC_IRQ_CLEARn(reg_id));
+		irq = &periph_irqs[i];
+		if (!irq->handler)
+			continue;
 
-		/* Confirm that the interrupt has been cleared */
-		while(readl(SPMI_PIC_IRQ_STATUSn(reg_id)) & offset);
+		status = readl(SPMI_PIC_OWNERm_ACC_STATUSn(pmic_arb_owner_id, irq->chnl / 32));
+		if (!(status & BIT(irq->chnl % 32)))
+			continue;
 
-		/* Call the callback */
-		callback();
-		return 1;
+		/* Clear the interrupt in the arbiter */
+		writel(readl(SPMI_PIC_IRQ_STATUSn(irq->chnl)), SPMI_PIC_IRQ_CLEARn(irq->chnl));
+
+		if (irq->handler(irq->arg) == INT_RESCHEDULE)
+			ret = INT_RESCHEDULE;
 	}
-	else
-		return 0;
+
+	return ret;
 }
 
-void spmi_irq()
+#if SPMI_CORE_V2
+/* periph: peripheral base address, including the slave id */
+static uint32_t spmi_periph_chnl(uint32_t periph)
 {
-	int i;
-	uint32_t status;
+	uint8_t slave_id = (periph >> 16) & 0xf;
+	uint8_t ppid_address = (periph >> 8) & 0xff;
 
-	/* Go through the Peripheral list to figure out the periperal
-	 * that caused the interrupt
-	 */
-	for (i = 0; i < 8; i++)
+	return chnl_tbl[CHNL_IDX(slave_id, ppid_address)];
+}
+#endif
+
+/* Route the interrupts of a PMIC peripheral to handler.
+ * periph: peripheral base address, including the slave id.
+ * The peripheral itself still has to be configured to raise them.
+ */
+int spmi_register_periph_irq(uint32_t periph, int_handler handler, void *arg)
+{
+#if SPMI_CORE_V2
+	uint32_t chnl = spmi_periph_chnl(periph);
+	int i, slot = -1;
+
+	for (i = 0; i < SPMI_MAX_PERIPH_IRQS; i++)
 	{
-		status = readl(SPMI_PIC_OWNERm_ACC_STATUSn(pmic_arb_owner_id, i));
-		if (status)
-			if (!spmi_acc_irq(i, status))
-				/* Not the correct interrupt, continue to wait */
-				return;
+		if (periph_irqs[i].handler && periph_irqs[i].chnl == chnl)
+			return ERR_ALREADY_EXISTS;
+		if (!periph_irqs[i].handler && slot < 0)
+			slot = i;
 	}
-	mask_interrupt(EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ);
+	if (slot < 0)
+		return ERR_NO_MEMORY;
+
+	enter_critical_section();
+	periph_irqs[slot].chnl = chnl;
+	periph_irqs[slot].arg = arg;
+	periph_irqs[slot].handler = handler;
+
+	if (!periph_irq_registered)
+	{
+		register_int_handler(EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ, spmi_irq, NULL);
+		periph_irq_registered = true;
+	}
+	exit_critical_section();
+
+	writel(BIT(0), SPMI_PIC_ACC_ENABLEn(chnl));
+	unmask_interrupt(EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ);
+
+	return NO_ERROR;
+#else
+	/* v1 arbiters have no lookup table to find the channel */
+	return ERR_NOT_SUPPORTED;
+#endif
 }
 
-/* Enable interrupts on a particular peripheral: periph_id */
-void spmi_enable_periph_interrupts(uint8_t periph_id)
+void spmi_unregister_periph_irq(uint32_t periph)
 {
-	pmic_irq_perph_id = periph_id;
+#if SPMI_CORE_V2
+	uint32_t chnl = spmi_periph_chnl(periph);
+	bool in_use = false;
+	int i;
 
-	register_int_handler(EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ , spmi_irq, 0);
-	unmask_interrupt(EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ);
+	writel(0, SPMI_PIC_ACC_ENABLEn(chnl));
 
+	enter_critical_section();
+	for (i = 0; i < SPMI_MAX_PERIPH_IRQS; i++)
+	{
+		if (periph_irqs[i].handler && periph_irqs[i].chnl == chnl)
+			periph_irqs[i].handler = NULL;
+		in_use |= !!periph_irqs[i].handler;
+	}
+	exit_critical_section();
+
+	if (!in_use)
+		mask_interrupt(EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ);
+#endif
 }
 
 void spmi_uninit()
 {
 	mask_interrupt(EE0_KRAIT_HLOS_SPMI_PERIPH_IRQ);
 }
+
+/* Remember the number of round trips so far when reaching a boot phase */
+void spmi_stats_mark(enum bs_entry bs_id)
+{
+	if (bs_id >= BS_MAX)
+		return;
+
+	spmi_stats_phase[bs_id] = spmi_stats;
+	spmi_stats_phase_valid[bs_id] = true;
+}
+
+#if WITH_LIB_CONSOLE
+
+#include <lib/console.h>
+
+static const char *spmi_stats_phase_name[BS_MAX] = {
+	[BS_BL_START] = "bl_start",
+	[BS_KERNEL_ENTRY] = "kernel_entry",
+	[BS_SPLASH_SCREEN_DISPLAY] = "splash",
+	[BS_KERNEL_LOAD_TIME] = "kernel_load_time",
+	[BS_KERNEL_LOAD_START] = "kernel_load_start",
+	[BS_KERNEL_LOAD_DONE] = "kernel_load_done",
+};
+
+static int cmd_spmi_stats(int argc, const cmd_args *argv)
+{
+	int i;
+
+	printf("%-18s %8s %8s %8s\n", "phase", "reads", "writes", "bytes");
+	for (i = 0; i < BS_MAX; i++) {
+		if (!spmi_stats_phase_valid[i])
+			continue;
+		printf("%-18s %8u %8u %8u\n", spmi_stats_phase_name[i],
+		       spmi_stats_phase[i].reads, spmi_stats_phase[i].writes,
+		       spmi_stats_phase[i].bytes);
+	}
+	printf("%-18s %8u %8u %8u\n", "now", spmi_stats.reads,
+	       spmi_stats.writes, spmi_stats.bytes);
+
+	return 0;
+}
+
+STATIC_COMMAND_START
+	{ "spmi_stats", "SPMI arbiter round trips per boot phase", &cmd_spmi_stats },
+STATIC_COMMAND_END(spmi_stats);
+
+#endif
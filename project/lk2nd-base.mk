@@ -7,6 +7,14 @@ MODULES += lk2nd
 DEBUG := 2
 DEFINES += LK_LOG_BUF_SIZE=16384
 
+# Set LK_LOG_RAM_BASE (and optionally LK_LOG_RAM_SIZE, a power of two) to keep
+# the log in reserved RAM that survives warm reboots. It is passed to the
+# kernel as ramoops region, so the log shows up in /sys/fs/pstore.
+ifneq ($(LK_LOG_RAM_BASE),)
+LK_LOG_RAM_SIZE ?= 0x40000
+DEFINES += LK_LOG_RAM_BASE=$(LK_LOG_RAM_BASE) LK_LOG_RAM_SIZE=$(LK_LOG_RAM_SIZE)
+endif
+
 # Disable various stupid stuff that we don't really want or need
 DEFINES += DEFAULT_UNLOCK=1 DISABLE_LOCK=1 DISABLE_DEVINFO=1
 DISABLE_RECOVERY_MESSAGES := 1
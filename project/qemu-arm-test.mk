@@ -5,5 +5,14 @@ LOCAL_DIR := $(GET_LOCAL_DIR)
 TARGET := qemu-arm
 MODULES += \
 	app/tests \
-	app/shell
+	app/shell \
+	lib/workpool \
+	lib/bio \
+	lib/bcache \
+	lib/partition \
+	lib/fs \
+	lib/fs/ext2 \
+	lib/zlib_inflate \
+	lib/sparse \
+	lib/libfdt
  
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-only
+"""
+Generate the disk image fixture used by storage_tests in app/tests.
+
+The image is a small GPT disk with a single ext2 partition that contains
+a text file. It is stored gzip compressed in a C array so the test can
+exercise inflate, bio, the GPT parser and ext2 on it.
+
+Usage: mkstoragetestimg.py > app/tests/storage_tests_image.c
+       mkstoragetestimg.py --check app/tests/storage_tests_image.c
+
+Requires mke2fs and debugfs from e2fsprogs. All mke2fs inputs are pinned
+below and the e2fsprogs version is recorded in the output, --check
+regenerates the image and fails if it differs from the checked in one.
+"""
+import gzip
+import io
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import uuid
+import zlib
+
+SECTOR = 512
+DISK_SECTORS = 2048			# 1 MiB disk
+PART_FIRST = 64
+PART_SECTORS = 512			# 256 KiB ext2 partition
+ENTRIES = 128
+ENTRY_SIZE = 128
+
+# Keep in sync with storage_tests.c
+TEST_FILE = "test.txt"
+TEST_LINES = 2048
+TEST_LINE = "lk2nd storage test line %05u\n"
+
+# Fixed GUIDs and timestamps keep the output reproducible
+DISK_GUID = uuid.UUID("6c6b326e-6400-4000-8000-000000000001")
+PART_GUID = uuid.UUID("6c6b326e-6400-4000-8000-000000000002")
+LINUX_DATA_GUID = uuid.UUID("0fc63daf-8483-4772-8e79-3d69d8477de4")
+
+EXT2_FEATURES = "ext_attr,resize_inode,dir_index,filetype,sparse_super,large_file"
+
+
+def make_ext2(files, sectors=PART_SECTORS, label="lk2nd-test"):
+	"""Create an ext2 image with 1 KiB blocks that contains files."""
+	with tempfile.TemporaryDirectory() as tmp:
+		root = os.path.join(tmp, "root")
+		os.mkdir(root)
+		for name, data in files.items():
+			with open(os.path.join(root, name), "wb") as f:
+				f.write(data)
+			os.utime(os.path.join(root, name), (0, 0))
+		os.utime(root, (0, 0))
+
+		img = os.path.join(tmp, "ext2.img")
+		with open(img, "wb") as f:
+			f.truncate(sectors * SECTOR)
+		# Ignore the host's mke2fs.conf and spell out everything it would
+		# otherwise pick, so the image only depends on these arguments
+		env = dict(os.environ, E2FSPROGS_FAKE_TIME="1", SOURCE_DATE_EPOCH="1",
+			   MKE2FS_CONFIG=os.devnull)
+		subprocess.run(["mke2fs", "-q", "-F", "-t", "ext2", "-b", "1024",
+				"-O", "none," + EXT2_FEATURES, "-I", "256",
+				"-N", "32", "-m", "5", "-o", "Linux", "-T", "default",
+				"-L", label, "-U", str(PART_GUID),
+				"-E", "hash_seed=" + str(DISK_GUID) +
+				",root_owner=0:0",
+				"-d", root, img, str(sectors * SECTOR // 1024)],
+			       check=True, env=env)
+
+		# mke2fs copies the ctime of the source files, which can't be set
+		for name in files:
+			subprocess.run(["debugfs", "-w", "-R",
+					"sif /%s ctime @0" % name, img],
+				       check=True, env=env, stderr=subprocess.DEVNULL)
+
+		with open(img, "rb") as f:
+			return f.read()
+
+
+def gpt_header(current, backup, entries_lba, entries_crc, disk_sectors):
+	hdr = struct.pack("<8sIIIIQQQQ16sQIII",
+			  b"EFI PART", 0x00010000, 92, 0, 0,
+			  current, backup, 34, disk_sectors - 34,
+			  DISK_GUID.bytes_le, entries_lba, ENTRIES,
+			  ENTRY_SIZE, entries_crc)
+	crc = zlib.crc32(hdr)
+	hdr = hdr[:16] + struct.pack("<I", crc) + hdr[20:]
+	return hdr.ljust(SECTOR, b"\0")
+
+
+def make_disk(part, disk_sectors=DISK_SECTORS, part_first=PART_FIRST,
+	      part_name="userdata"):
+	"""Create a GPT disk with part as its only partition."""
+	disk = bytearray(disk_sectors * SECTOR)
+	part_sectors = (len(part) + SECTOR - 1) // SECTOR
+
+	# Protective MBR
+	mbr = struct.pack("<B3sB3sII", 0, b"\0\2\0", 0xee, b"\xff\xff\xff",
+			  1, disk_sectors - 1)
+	disk[446:446 + len(mbr)] = mbr
+	disk[510:512] = b"\x55\xaa"
+
+	entry = struct.pack("<16s16sQQQ72s", LINUX_DATA_GUID.bytes_le,
+			    PART_GUID.bytes_le, part_first,
+			    part_first + part_sectors - 1, 0,
+			    part_name.encode("utf-16-le"))
+	entries = entry.ljust(ENTRIES * ENTRY_SIZE, b"\0")
+	entries_crc = zlib.crc32(entries)
+	entries_sectors = len(entries) // SECTOR
+
+	disk[SECTOR:2 * SECTOR] = gpt_header(1, disk_sectors - 1, 2, entries_crc,
+					     disk_sectors)
+	disk[2 * SECTOR:2 * SECTOR + len(entries)] = entries
+
+	backup_entries = disk_sectors - 1 - entries_sectors
+	disk[backup_entries * SECTOR:(disk_sectors - 1) * SECTOR] = entries
+	disk[(disk_sectors - 1) * SECTOR:] = gpt_header(disk_sectors - 1, 1,
+							backup_entries,
+							entries_crc,
+							disk_sectors)
+
+	disk[part_first * SECTOR:part_first * SECTOR + len(part)] = part
+	return bytes(disk)
+
+
+def e2fsprogs_version():
+	res = subprocess.run(["mke2fs", "-V"], check=True, text=True,
+			     stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+	return res.stderr.split()[1]
+
+
+def generate(out):
+	text = "".join(TEST_LINE % i for i in range(TEST_LINES))
+	disk = make_disk(make_ext2({TEST_FILE: text.encode()}))
+	gz = gzip.compress(disk, compresslevel=9, mtime=0)
+
+	out.write("// SPDX-License-Identifier: GPL-2.0-only\n")
+	out.write("/* Generated by scripts/mkstoragetestimg.py with e2fsprogs %s,"
+		  " do not edit */\n" % e2fsprogs_version())
+	out.write("#include <sys/types.h>\n\n")
+	out.write("const unsigned int storage_test_image_size = %u;\n" % len(disk))
+	out.write("const unsigned int storage_test_image_gz_size = %u;\n" % len(gz))
+	out.write("const unsigned char storage_test_image_gz[] = {\n")
+	for i in range(0, len(gz), 12):
+		out.write("\t" + " ".join("0x%02x," % b for b in gz[i:i + 12]) + "\n")
+	out.write("};\n")
+
+
+def main():
+	if len(sys.argv) == 3 and sys.argv[1] == "--check":
+		out = io.StringIO()
+		generate(out)
+		with open(sys.argv[2]) as f:
+			if f.read() != out.getvalue():
+				sys.exit("%s is out of date" % sys.argv[2])
+		return
+
+	generate(sys.stdout)
+
+
+if __name__ == "__main__":
+	main()
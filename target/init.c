@@ -227,6 +227,19 @@ __WEAK uint32_t target_get_pmic()
 	return PMIC_IS_UNKNOWN;
 }
 
+__WEAK int target_keys_irq_enable(int_handler handler, void *arg)
+{
+	return ERR_NOT_SUPPORTED;
+}
+
+__WEAK void target_keys_irq_ack(void)
+{
+}
+
+__WEAK void target_keys_irq_disable(void)
+{
+}
+
 /* Check battery if it's exist */
 bool target_battery_is_present()
 {
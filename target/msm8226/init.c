@@ -427,6 +427,8 @@ void reboot_device(unsigned reboot_reason)
 	if (ret)
 		dprintf(CRITICAL , "Failed to halt pmic arbiter: %d\n", ret);
 
+	lk_log_flush();
+
 	/* Drop PS_HOLD for MSM */
 	writel(0x00, MPM2_MPM_PS_HOLD);
 
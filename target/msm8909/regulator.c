@@ -85,10 +85,13 @@ static uint32_t ldo17[][11]=
 
 void regulator_enable()
 {
-	rpm_send_data(&ldo2[GENERIC_ENABLE][0], 36, RPM_REQUEST_TYPE);
+	int ids[3];
 
-	rpm_send_data(&ldo17[GENERIC_ENABLE][0], 36, RPM_REQUEST_TYPE);
-
-	rpm_send_data(&ldo6[GENERIC_ENABLE][0], 36, RPM_REQUEST_TYPE);
+	/* Queue all votes back to back and wait for the ACKs together */
+	ids[0] = rpm_send_data_async(&ldo2[GENERIC_ENABLE][0], 36);
+	ids[1] = rpm_send_data_async(&ldo17[GENERIC_ENABLE][0], 36);
+	ids[2] = rpm_send_data_async(&ldo6[GENERIC_ENABLE][0], 36);
 
+	if (rpm_wait_for_ack(ids, ARRAY_SIZE(ids)))
+		dprintf(CRITICAL, "Failed to enable regulators\n");
 }
@@ -544,6 +544,8 @@ void reboot_device(unsigned reboot_reason)
 	else
 		pm8x41_reset_configure(reset_type);
 
+	lk_log_flush();
+
 	/* Drop PS_HOLD for MSM */
 	writel(0x00, MPM2_MPM_PS_HOLD);
 
@@ -29,6 +29,7 @@
 
 #include <regulator.h>
 #include <rpm-smd.h>
+#include <debug.h>
 
 static uint32_t ldo2[][11]=
 {
@@ -101,13 +102,16 @@ static uint32_t ldo28[][11]=
 
 void regulator_enable()
 {
-	rpm_send_data(&ldo2[GENERIC_ENABLE][0], 36, RPM_REQUEST_TYPE);
+	int ids[4];
 
-	rpm_send_data(&ldo12[GENERIC_ENABLE][0], 36, RPM_REQUEST_TYPE);
+	/* Queue all votes back to back and wait for the ACKs together */
+	ids[0] = rpm_send_data_async(&ldo2[GENERIC_ENABLE][0], 36);
+	ids[1] = rpm_send_data_async(&ldo12[GENERIC_ENABLE][0], 36);
+	ids[2] = rpm_send_data_async(&ldo14[GENERIC_ENABLE][0], 36);
+	ids[3] = rpm_send_data_async(&ldo28[GENERIC_ENABLE][0], 36);
 
-	rpm_send_data(&ldo14[GENERIC_ENABLE][0], 36, RPM_REQUEST_TYPE);
-
-	rpm_send_data(&ldo28[GENERIC_ENABLE][0], 36, RPM_REQUEST_TYPE);
+	if (rpm_wait_for_ack(ids, ARRAY_SIZE(ids)))
+		dprintf(CRITICAL, "Failed to enable regulators\n");
 }
 
 void regulator_disable()